@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <sml/basicFunctions.hpp>
+#include <sml/basicFunctionsBatch.hpp>
+#include <sml/constants.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of basic functions for given Real type.
+/*!
+ * Each iteration calls the function for an array of inputs, so that the time per iteration
+ * includes the benefit of auto-vectorization, if the compiler manages to vectorize the loop.
+ *
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+void registerBasicFunctionBenchmarks()
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t size = 1024;
+    const std::vector<Real> angles
+        = createRandomData<Real>(size, static_cast<Real>(-100.0), static_cast<Real>(100.0));
+
+    registerBenchmark("computeModulo", "scalar", real, size, [angles](std::size_t iterations)
+    {
+        const Real divisor = twoPi<Real>;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(angles.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < angles.size(); j++)
+            {
+                sum += computeModulo(angles[j], divisor);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("convertRadiansToDegrees", "scalar", real, size,
+                      [angles](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(angles.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < angles.size(); j++)
+            {
+                sum += convertRadiansToDegrees(angles[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("convertDegreesToRadians", "scalar", real, size,
+                      [angles](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(angles.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < angles.size(); j++)
+            {
+                sum += convertDegreesToRadians(angles[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("computeModulo", "batch", real, size, [angles](std::size_t iterations)
+    {
+        const Real divisor = twoPi<Real>;
+        std::vector<Real> results(angles.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            computeModulo(angles, divisor, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("computeModuloFast", "batch", real, size, [angles](std::size_t iterations)
+    {
+        const Real divisor = twoPi<Real>;
+        std::vector<Real> results(angles.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            computeModuloFast(angles, divisor, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("convertRadiansToDegrees", "batch", real, size,
+                      [angles](std::size_t iterations)
+    {
+        std::vector<Real> results(angles.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            convertRadiansToDegrees<Real>(angles, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("convertRadiansToWrappedDegrees", "scalar", real, size,
+                      [angles](std::size_t iterations)
+    {
+        const Real divisor = twoPi<Real>;
+        std::vector<Real> results(angles.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(angles.data());
+            for (std::size_t j = 0; j < angles.size(); j++)
+            {
+                results[j] = convertRadiansToDegrees(computeModulo(angles[j], divisor));
+            }
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("convertRadiansToWrappedDegrees", "batch", real, size,
+                      [angles](std::size_t iterations)
+    {
+        std::vector<Real> results(angles.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            convertRadiansToWrappedDegrees<Real>(angles, results);
+            doNotOptimize(results.data());
+        }
+    });
+}
+
+//! Register benchmarks of basic functions.
+void registerBasicFunctionBenchmarks()
+{
+    registerBasicFunctionBenchmarks<float>();
+    registerBasicFunctionBenchmarks<double>();
+}
+
+static Registrar basicFunctionsRegistrar(&registerBasicFunctionBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
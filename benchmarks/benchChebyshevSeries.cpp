@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/chebyshevSeries.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of piecewise Chebyshev series for given Real type.
+/*!
+ * Each iteration evaluates a piecewise Chebyshev series of order 13 with 64 segments, fitted to a
+ * sampled sine, at an array of sorted queries, either one query at a time or in one batch.
+ *
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+void registerChebyshevSeriesBenchmarks()
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t size = 1024;
+    std::vector<Real> xData(64 * 16 + 1);
+    std::vector<Real> yData(xData.size());
+    for (std::size_t i = 0; i < xData.size(); i++)
+    {
+        xData[i] = static_cast<Real>(i) / 16;
+        yData[i] = std::sin(xData[i]);
+    }
+    const ChebyshevSeries<Real> series(xData, yData, 64, 13);
+    std::vector<Real> queries
+        = createRandomData<Real>(size, static_cast<Real>(0.0), static_cast<Real>(64.0));
+    std::sort(queries.begin(), queries.end());
+
+    registerBenchmark("ChebyshevSeries::evaluate", "scalar", real, size,
+                      [series, queries](std::size_t iterations)
+    {
+        std::vector<Real> values(queries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            for (std::size_t j = 0; j < queries.size(); j++)
+            {
+                values[j] = series.evaluate(queries[j]);
+            }
+            doNotOptimize(values.data());
+        }
+    });
+
+    registerBenchmark("ChebyshevSeries::evaluate", "batch", real, size,
+                      [series, queries](std::size_t iterations)
+    {
+        std::vector<Real> values(queries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            series.evaluate(queries, values);
+            doNotOptimize(values.data());
+        }
+    });
+
+    registerBenchmark("ChebyshevSeries::evaluate (derivative)", "scalar", real, size,
+                      [series, queries](std::size_t iterations)
+    {
+        std::vector<Real> values(queries.size());
+        std::vector<Real> derivatives(queries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            for (std::size_t j = 0; j < queries.size(); j++)
+            {
+                values[j] = series.evaluate(queries[j], derivatives[j]);
+            }
+            doNotOptimize(values.data());
+            doNotOptimize(derivatives.data());
+        }
+    });
+
+    registerBenchmark("ChebyshevSeries::evaluate (derivative)", "batch", real, size,
+                      [series, queries](std::size_t iterations)
+    {
+        std::vector<Real> values(queries.size());
+        std::vector<Real> derivatives(queries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            series.evaluate(queries, values, derivatives);
+            doNotOptimize(values.data());
+            doNotOptimize(derivatives.data());
+        }
+    });
+}
+
+//! Register benchmarks of piecewise Chebyshev series.
+void registerChebyshevSeriesBenchmarks()
+{
+    registerChebyshevSeriesBenchmarks<float>();
+    registerChebyshevSeriesBenchmarks<double>();
+}
+
+static Registrar chebyshevSeriesRegistrar(&registerChebyshevSeriesBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/cubicSpline.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of cubic splines for given Real type.
+/*!
+ * Benchmarks construction of a not-a-knot CubicSpline, as well as interpolation for random
+ * queries (binary search) and ascending queries (batch, streaming through the table). Each
+ * iteration interpolates at a batch of queries.
+ *
+ * @tparam Real       Floating-point type
+ * @param  tableSize  Number of table entries N
+ */
+template <typename Real>
+void registerCubicSplineBenchmarks(const std::size_t tableSize)
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t queryCount = 1024;
+
+    std::vector<Real> xData(tableSize);
+    std::vector<Real> yData(tableSize);
+    for (std::size_t i = 0; i < tableSize; i++)
+    {
+        xData[i] = static_cast<Real>(i) / static_cast<Real>(tableSize - 1);
+        yData[i] = std::sin(static_cast<Real>(3.0) * xData[i]);
+    }
+    const CubicSpline<Real> spline(xData, yData, SplineBoundary::notAKnot);
+
+    const std::vector<Real> randomQueries
+        = createRandomData<Real>(queryCount, static_cast<Real>(0.0), static_cast<Real>(1.0));
+    std::vector<Real> sortedQueries = randomQueries;
+    std::sort(sortedQueries.begin(), sortedQueries.end());
+
+    registerBenchmark("CubicSpline::CubicSpline", "std::vector", real, tableSize,
+                      [xData, yData](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(xData.data());
+            const CubicSpline<Real> result(xData, yData, SplineBoundary::notAKnot);
+            doNotOptimize(result.getCoefficients().data());
+        }
+    });
+
+    registerBenchmark("CubicSpline::interpolate(random)", "std::vector", real, tableSize,
+                      [spline, randomQueries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(randomQueries.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < randomQueries.size(); j++)
+            {
+                sum += spline.interpolate(randomQueries[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("CubicSpline::interpolate(sorted batch)", "std::vector", real, tableSize,
+                      [spline, sortedQueries](std::size_t iterations)
+    {
+        std::vector<Real> results(sortedQueries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(sortedQueries.data());
+            spline.interpolate(sortedQueries, results);
+            doNotOptimize(results.data());
+        }
+    });
+}
+
+//! Register benchmarks of cubic splines.
+void registerCubicSplineBenchmarks()
+{
+    const std::size_t tableSizes[] = {1024, 1048576};
+    for (std::size_t i = 0; i < sizeof(tableSizes) / sizeof(tableSizes[0]); i++)
+    {
+        registerCubicSplineBenchmarks<float>(tableSizes[i]);
+        registerCubicSplineBenchmarks<double>(tableSizes[i]);
+    }
+}
+
+static Registrar cubicSplineRegistrar(&registerCubicSplineBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
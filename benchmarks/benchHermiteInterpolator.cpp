@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/hermiteInterpolator.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of Hermite interpolation in large tables for given Real type.
+/*!
+ * Benchmarks HermiteTableInterpolator with a 4-point stencil (degree 7, the same order of
+ * accuracy as LagrangeTableInterpolator with an 8-point stencil), for random queries (binary
+ * search) and ascending queries (hunting from the previous interval). Each iteration interpolates
+ * at a batch of queries.
+ *
+ * @tparam Real       Floating-point type
+ * @param  tableSize  Number of table entries N
+ */
+template <typename Real>
+void registerHermiteTableInterpolatorBenchmarks(const std::size_t tableSize)
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t queryCount = 1024;
+
+    std::vector<Real> xData(tableSize);
+    std::vector<Real> yData(tableSize);
+    std::vector<Real> dyData(tableSize);
+    for (std::size_t i = 0; i < tableSize; i++)
+    {
+        xData[i] = static_cast<Real>(i) / static_cast<Real>(tableSize - 1);
+        yData[i] = std::sin(static_cast<Real>(3.0) * xData[i]);
+        dyData[i] = static_cast<Real>(3.0) * std::cos(static_cast<Real>(3.0) * xData[i]);
+    }
+    const HermiteTableInterpolator<Real> interpolator(xData, yData, dyData, 4);
+
+    const std::vector<Real> randomQueries
+        = createRandomData<Real>(queryCount, static_cast<Real>(0.0), static_cast<Real>(1.0));
+    std::vector<Real> sortedQueries = randomQueries;
+    std::sort(sortedQueries.begin(), sortedQueries.end());
+
+    registerBenchmark("HermiteTableInterpolator::interpolate(random)", "std::vector", real,
+                      tableSize, [interpolator, randomQueries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(randomQueries.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < randomQueries.size(); j++)
+            {
+                sum += interpolator.interpolate(randomQueries[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("HermiteTableInterpolator::interpolate(sorted batch)", "std::vector", real,
+                      tableSize, [interpolator, sortedQueries](std::size_t iterations)
+    {
+        std::vector<Real> results(sortedQueries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(sortedQueries.data());
+            interpolator.interpolate(sortedQueries, results);
+            doNotOptimize(results.data());
+        }
+    });
+}
+
+//! Register benchmarks of Hermite interpolation.
+void registerHermiteInterpolatorBenchmarks()
+{
+    const std::size_t tableSizes[] = {1024, 1048576};
+    for (std::size_t i = 0; i < sizeof(tableSizes) / sizeof(tableSizes[0]); i++)
+    {
+        registerHermiteTableInterpolatorBenchmarks<float>(tableSizes[i]);
+        registerHermiteTableInterpolatorBenchmarks<double>(tableSizes[i]);
+    }
+}
+
+static Registrar hermiteInterpolatorRegistrar(&registerHermiteInterpolatorBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sml/interpolationTable.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Temporary table file, removed when the benchmarks are destroyed at program exit.
+struct TemporaryFile
+{
+    //! Path to file.
+    std::string path;
+
+    //! Remove file.
+    ~TemporaryFile()
+    {
+        std::remove(path.c_str());
+    }
+};
+
+//! Register benchmarks of interpolation table functions for given Real type and table size.
+/*!
+ * Benchmarks writing a table with 4 y-columns, and opening it with and without validation of the
+ * data. The table is written to the working directory. Barycentric weights are not stored, since
+ * computing them costs O(N^2) operations, which dominates the time to write large tables.
+ *
+ * @tparam Real      Floating-point type
+ * @param  rowCount  Number of rows N in table
+ */
+template <typename Real>
+void registerInterpolationTableBenchmarks(const std::size_t rowCount)
+{
+    const std::string real = getRealName<Real>();
+    const std::string container = "sml::MappedInterpolationTable";
+
+    std::vector<Real> xData(rowCount);
+    std::vector<std::vector<Real> > yColumns(4, std::vector<Real>(rowCount));
+    for (std::size_t i = 0; i < rowCount; i++)
+    {
+        xData[i] = static_cast<Real>(i) / static_cast<Real>(rowCount - 1);
+        for (std::size_t k = 0; k < yColumns.size(); k++)
+        {
+            yColumns[k][i] = std::sin(static_cast<Real>(k + 1) * xData[i]);
+        }
+    }
+
+    std::shared_ptr<TemporaryFile> file(new TemporaryFile);
+    file->path = "sml_bench_table_" + real + "_" + std::to_string(rowCount) + ".bin";
+
+    registerBenchmark("writeInterpolationTable", container, real, rowCount,
+                      [file, xData, yColumns](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            writeInterpolationTable<Real>(file->path, xData, yColumns);
+        }
+    });
+
+    registerBenchmark("MappedInterpolationTable(validated)", container, real, rowCount,
+                      [file, xData, yColumns](std::size_t iterations)
+    {
+        writeInterpolationTable<Real>(file->path, xData, yColumns);
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            const MappedInterpolationTable<Real> table(file->path, true);
+            doNotOptimize(table.getXData().data());
+        }
+    });
+
+    registerBenchmark("MappedInterpolationTable(unvalidated)", container, real, rowCount,
+                      [file, xData, yColumns](std::size_t iterations)
+    {
+        writeInterpolationTable<Real>(file->path, xData, yColumns);
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            const MappedInterpolationTable<Real> table(file->path, false);
+            doNotOptimize(table.getXData().data());
+        }
+    });
+}
+
+//! Register benchmarks of interpolation table functions.
+void registerInterpolationTableBenchmarks()
+{
+    const std::size_t rowCounts[] = {1024, 1048576};
+    for (std::size_t i = 0; i < sizeof(rowCounts) / sizeof(rowCounts[0]); i++)
+    {
+        registerInterpolationTableBenchmarks<float>(rowCounts[i]);
+        registerInterpolationTableBenchmarks<double>(rowCounts[i]);
+    }
+}
+
+static Registrar interpolationTableRegistrar(&registerInterpolationTableBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/basicFunctions.hpp>
+#include <sml/constants.hpp>
+#include <sml/keplerEquation.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of Kepler equation solvers for given Real type.
+/*!
+ * Each iteration solves Kepler's equation for an array of orbits. For comparison, the eccentric
+ * anomalies are also computed with a scalar Newton iteration that stops when the correction is
+ * below 1e-12 (1e-6 for float), using std::sin() and std::cos().
+ *
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+void registerKeplerEquationBenchmarks()
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t size = 1024;
+    const std::vector<Real> meanAnomalies
+        = createRandomData<Real>(size, static_cast<Real>(-100.0), static_cast<Real>(100.0));
+    const std::vector<Real> eccentricities
+        = createRandomData<Real>(size, static_cast<Real>(0.0), static_cast<Real>(0.95));
+    std::vector<Real> hyperbolicEccentricities = eccentricities;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hyperbolicEccentricities[i] += static_cast<Real>(1.05);
+    }
+
+    registerBenchmark("computeEccentricAnomaly", "scalar Newton", real, size,
+                      [meanAnomalies, eccentricities](std::size_t iterations)
+    {
+        const Real tolerance = sizeof(Real) > 4 ? static_cast<Real>(1.0e-12)
+                                                : static_cast<Real>(1.0e-6);
+        std::vector<Real> results(meanAnomalies.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(meanAnomalies.data());
+            for (std::size_t j = 0; j < meanAnomalies.size(); j++)
+            {
+                const Real m = computeModulo(meanAnomalies[j], twoPi<Real>);
+                const Real e = eccentricities[j];
+                Real anomaly = e < static_cast<Real>(0.8) ? m : pi<Real>;
+                for (int k = 0; k < 50; k++)
+                {
+                    const Real correction = (anomaly - e * std::sin(anomaly) - m)
+                                            / (1 - e * std::cos(anomaly));
+                    anomaly -= correction;
+                    if (std::fabs(correction) < tolerance)
+                    {
+                        break;
+                    }
+                }
+                results[j] = anomaly;
+            }
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("computeEccentricAnomaly", "sml", real, size,
+                      [meanAnomalies, eccentricities](std::size_t iterations)
+    {
+        std::vector<Real> results(meanAnomalies.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(meanAnomalies.data());
+            computeEccentricAnomaly<Real>(meanAnomalies, eccentricities, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("computeTrueAnomaly", "sml", real, size,
+                      [meanAnomalies, eccentricities](std::size_t iterations)
+    {
+        std::vector<Real> results(meanAnomalies.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(meanAnomalies.data());
+            computeTrueAnomaly<Real>(meanAnomalies, eccentricities, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("computeHyperbolicAnomaly", "sml", real, size,
+                      [meanAnomalies, hyperbolicEccentricities](std::size_t iterations)
+    {
+        std::vector<Real> results(meanAnomalies.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(meanAnomalies.data());
+            computeHyperbolicAnomaly<Real>(meanAnomalies, hyperbolicEccentricities, results);
+            doNotOptimize(results.data());
+        }
+    });
+}
+
+//! Register benchmarks of Kepler equation solvers.
+void registerKeplerEquationBenchmarks()
+{
+    registerKeplerEquationBenchmarks<float>();
+    registerKeplerEquationBenchmarks<double>();
+}
+
+static Registrar keplerEquationRegistrar(&registerKeplerEquationBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
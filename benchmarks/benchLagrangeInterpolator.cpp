@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sml/lagrangeInterpolator.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of Lagrange interpolation for given Real type and number of nodes.
+/*!
+ * Benchmarks interpolation of a smooth function at N nodes, using lagrangeInterpolate() with
+ * function data stored in a std::map and in a sorted std::vector of pairs, as well as
+ * LagrangeInterpolator (precomputed barycentric weights). Each iteration interpolates at a batch of
+ * queries that lie between the nodes.
+ *
+ * @tparam Real       Floating-point type
+ * @param  nodeCount  Number of interpolation nodes N
+ */
+template <typename Real>
+void registerLagrangeInterpolateBenchmarks(const std::size_t nodeCount)
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t queryCount = 256;
+
+    std::map<Real, Real> mapData;
+    std::vector<std::pair<Real, Real> > vectorData;
+    std::vector<Real> xData(nodeCount);
+    std::vector<Real> yData(nodeCount);
+    for (std::size_t i = 0; i < nodeCount; i++)
+    {
+        xData[i] = static_cast<Real>(i) / static_cast<Real>(nodeCount - 1);
+        yData[i] = std::sin(static_cast<Real>(3.0) * xData[i]);
+        mapData[xData[i]] = yData[i];
+        vectorData.push_back(std::make_pair(xData[i], yData[i]));
+    }
+    std::vector<Real> queries = createRandomData<Real>(
+        queryCount, static_cast<Real>(0.25), static_cast<Real>(0.75));
+
+    registerBenchmark("lagrangeInterpolate", "std::map", real, nodeCount,
+                      [mapData, queries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < queries.size(); j++)
+            {
+                sum += lagrangeInterpolate(mapData, queries[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("lagrangeInterpolate", "std::vector<std::pair>", real, nodeCount,
+                      [vectorData, queries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < queries.size(); j++)
+            {
+                sum += lagrangeInterpolate(vectorData, queries[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("computeBarycentricWeights", "std::vector", real, nodeCount,
+                      [xData](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(xData.data());
+            const std::vector<Real> weights = computeBarycentricWeights<Real>(xData);
+            doNotOptimize(weights.data());
+        }
+    });
+
+    const LagrangeInterpolator<Real> interpolator(xData, yData);
+    registerBenchmark("LagrangeInterpolator::interpolate", "std::vector", real, nodeCount,
+                      [interpolator, queries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < queries.size(); j++)
+            {
+                sum += interpolator.interpolate(queries[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("LagrangeInterpolator::interpolate(batch)", "std::vector", real, nodeCount,
+                      [interpolator, queries](std::size_t iterations)
+    {
+        std::vector<Real> results(queries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            interpolator.interpolate(queries, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    // Interpolate 4 columns of y-values that share the same nodes.
+    const std::vector<Real> weights = computeBarycentricWeights<Real>(xData);
+    const std::vector<std::vector<Real> > yColumns(4, yData);
+    registerBenchmark("barycentricInterpolateBatch(4 columns)", "std::vector", real, nodeCount,
+                      [xData, yColumns, weights, queries](std::size_t iterations)
+    {
+        std::vector<std::vector<Real> > results(
+            yColumns.size(), std::vector<Real>(queries.size()));
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(queries.data());
+            barycentricInterpolateBatch<Real>(xData, yColumns, weights, queries, results);
+            doNotOptimize(results[0].data());
+        }
+    });
+}
+
+//! Register benchmarks of local Lagrange interpolation in large tables for given Real type.
+/*!
+ * Benchmarks LagrangeTableInterpolator with an 8-point stencil, for random queries (binary search)
+ * and ascending queries (hunting from the previous interval), as well as adaptive-order Neville
+ * interpolation to a tolerance of 1000 machine epsilon for random queries. Each iteration
+ * interpolates at a batch of queries.
+ *
+ * @tparam Real       Floating-point type
+ * @param  tableSize  Number of table entries N
+ */
+template <typename Real>
+void registerLagrangeTableInterpolatorBenchmarks(const std::size_t tableSize)
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t queryCount = 1024;
+
+    std::vector<Real> xData(tableSize);
+    std::vector<Real> yData(tableSize);
+    for (std::size_t i = 0; i < tableSize; i++)
+    {
+        xData[i] = static_cast<Real>(i) / static_cast<Real>(tableSize - 1);
+        yData[i] = std::sin(static_cast<Real>(3.0) * xData[i]);
+    }
+    const LagrangeTableInterpolator<Real> interpolator(xData, yData, 8);
+
+    const std::vector<Real> randomQueries
+        = createRandomData<Real>(queryCount, static_cast<Real>(0.0), static_cast<Real>(1.0));
+    std::vector<Real> sortedQueries = randomQueries;
+    std::sort(sortedQueries.begin(), sortedQueries.end());
+
+    registerBenchmark("LagrangeTableInterpolator::interpolate(random)", "std::vector", real,
+                      tableSize, [interpolator, randomQueries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(randomQueries.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < randomQueries.size(); j++)
+            {
+                sum += interpolator.interpolate(randomQueries[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("LagrangeTableInterpolator::interpolate(sorted batch)", "std::vector", real,
+                      tableSize, [interpolator, sortedQueries](std::size_t iterations)
+    {
+        std::vector<Real> results(sortedQueries.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(sortedQueries.data());
+            interpolator.interpolate(sortedQueries, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    const Real tolerance = 1000 * std::numeric_limits<Real>::epsilon();
+    registerBenchmark("nevilleInterpolate(random)", "std::vector", real, tableSize,
+                      [xData, yData, randomQueries, tolerance](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(randomQueries.data());
+            Real sum = 0;
+            for (std::size_t j = 0; j < randomQueries.size(); j++)
+            {
+                sum += nevilleInterpolate(xData, yData, randomQueries[j], tolerance).value;
+            }
+            doNotOptimize(sum);
+        }
+    });
+}
+
+//! Register benchmarks of Lagrange interpolation.
+void registerLagrangeInterpolatorBenchmarks()
+{
+    const std::size_t nodeCounts[] = {4, 8, 16, 32};
+    for (std::size_t i = 0; i < sizeof(nodeCounts) / sizeof(nodeCounts[0]); i++)
+    {
+        registerLagrangeInterpolateBenchmarks<float>(nodeCounts[i]);
+        registerLagrangeInterpolateBenchmarks<double>(nodeCounts[i]);
+    }
+
+    const std::size_t tableSizes[] = {1024, 1048576};
+    for (std::size_t i = 0; i < sizeof(tableSizes) / sizeof(tableSizes[0]); i++)
+    {
+        registerLagrangeTableInterpolatorBenchmarks<float>(tableSizes[i]);
+        registerLagrangeTableInterpolatorBenchmarks<double>(tableSizes[i]);
+    }
+}
+
+static Registrar lagrangeInterpolatorRegistrar(&registerLagrangeInterpolatorBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sml/arena.hpp>
+#include <sml/fixedVector.hpp>
+#include <sml/linearAlgebra.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Fill vector with random numbers.
+/*!
+ * @tparam Real    Floating-point type
+ * @tparam Vector  Vector type
+ * @param  vector  Vector to fill (resized beforehand to required size)
+ * @param  offset  Offset added to random numbers, to ensure that vectors differ
+ */
+template <typename Real, typename Vector>
+void fillRandom(Vector& vector, const Real offset)
+{
+    const std::vector<Real> data
+        = createRandomData<Real>(vector.size(), static_cast<Real>(-1.0), static_cast<Real>(1.0));
+    for (std::size_t i = 0; i < vector.size(); i++)
+    {
+        vector[i] = data[i] + offset;
+    }
+}
+
+//! Register benchmarks of linear algebra functions that operate on vectors of arbitrary size.
+/*!
+ * Each iteration calls the function once, so that the time per iteration includes any dynamic
+ * memory allocation of the result.
+ *
+ * @tparam Real       Floating-point type
+ * @tparam Vector     Vector type
+ * @param  container  Name of container type
+ * @param  vector1    First vector (size N)
+ * @param  vector2    Second vector (size N)
+ */
+template <typename Real, typename Vector>
+void registerVectorBenchmarks(const std::string& container,
+                              const Vector& vector1,
+                              const Vector& vector2)
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t size = vector1.size();
+
+    registerBenchmark("dot", container, real, size, [vector1, vector2](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            doNotOptimize(dot<Real>(vector1, vector2));
+        }
+    });
+
+    registerBenchmark("squaredNorm", container, real, size, [vector1](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            doNotOptimize(squaredNorm<Real>(vector1));
+        }
+    });
+
+    registerBenchmark("norm", container, real, size, [vector1](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            doNotOptimize(norm<Real>(vector1));
+        }
+    });
+
+    registerBenchmark("normalize", container, real, size, [vector1](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            const Vector result = normalize<Real>(vector1);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("multiply", container, real, size, [vector1](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            const Vector result = multiply<Real>(vector1, static_cast<Real>(1.5));
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("add(scalar)", container, real, size, [vector1](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            const Vector result = add<Real>(vector1, static_cast<Real>(1.5));
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("add(vector)", container, real, size,
+                      [vector1, vector2](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            const Vector result = add(vector1, vector2);
+            doNotOptimize(result);
+        }
+    });
+
+    // Output-parameter and in-place forms, which do not allocate memory.
+    registerBenchmark("normalize(output)", container, real, size, [vector1](std::size_t iterations)
+    {
+        Vector result = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            normalize<Real>(vector1, result);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("normalizeInPlace", container, real, size, [vector1](std::size_t iterations)
+    {
+        Vector vector = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            normalizeInPlace<Real>(vector);
+            doNotOptimize(vector);
+        }
+    });
+
+    registerBenchmark("multiply(output)", container, real, size, [vector1](std::size_t iterations)
+    {
+        Vector result = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            multiply(vector1, static_cast<Real>(1.5), result);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("multiplyInPlace", container, real, size, [vector1](std::size_t iterations)
+    {
+        Vector vector = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            multiplyInPlace(vector, static_cast<Real>(-1.0));
+            doNotOptimize(vector);
+        }
+    });
+
+    registerBenchmark("add(scalar, output)", container, real, size,
+                      [vector1](std::size_t iterations)
+    {
+        Vector result = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            add(vector1, static_cast<Real>(1.5), result);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("addInPlace(scalar)", container, real, size, [vector1](std::size_t iterations)
+    {
+        Vector vector = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            addInPlace(vector, static_cast<Real>(0.5));
+            doNotOptimize(vector);
+        }
+    });
+
+    registerBenchmark("add(vector, output)", container, real, size,
+                      [vector1, vector2](std::size_t iterations)
+    {
+        Vector result = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            add(vector1, vector2, result);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("addInPlace(vector)", container, real, size,
+                      [vector1, vector2](std::size_t iterations)
+    {
+        Vector vector = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            addInPlace(vector, vector2);
+            doNotOptimize(vector);
+        }
+    });
+}
+
+//! Register benchmarks of linear algebra functions that operate on 3-vectors.
+/*!
+ * @tparam Real       Floating-point type
+ * @tparam Vector3    3-vector type
+ * @param  container  Name of container type
+ * @param  vector1    First 3-vector
+ * @param  vector2    Second 3-vector
+ */
+template <typename Real, typename Vector3>
+void registerVector3Benchmarks(const std::string& container,
+                               const Vector3& vector1,
+                               const Vector3& vector2)
+{
+    const std::string real = getRealName<Real>();
+
+    registerBenchmark("cross", container, real, 3, [vector1, vector2](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            const Vector3 result = cross(vector1, vector2);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("cross(output)", container, real, 3,
+                      [vector1, vector2](std::size_t iterations)
+    {
+        Vector3 result = vector1;
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            cross(vector1, vector2, result);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("getXUnitVector", container, real, 3, [](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            const Vector3 result = getXUnitVector<Vector3>();
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("getYUnitVector", container, real, 3, [](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            const Vector3 result = getYUnitVector<Vector3>();
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("getZUnitVector", container, real, 3, [](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            const Vector3 result = getZUnitVector<Vector3>();
+            doNotOptimize(result);
+        }
+    });
+
+    registerVectorBenchmarks<Real>(container, vector1, vector2);
+}
+
+//! Register benchmarks of linear algebra functions for fixed-size container of given size.
+/*!
+ * @tparam Real       Floating-point type
+ * @tparam Vector     Fixed-size vector type
+ * @param  container  Name of container type
+ */
+template <typename Real, typename Vector>
+void registerFixedSizeBenchmarks(const std::string& container)
+{
+    Vector vector1;
+    Vector vector2;
+    fillRandom(vector1, static_cast<Real>(0.0));
+    fillRandom(vector2, static_cast<Real>(0.5));
+    registerVectorBenchmarks<Real>(container, vector1, vector2);
+}
+
+//! Register benchmarks of allocator-extended linear algebra functions.
+/*!
+ * Each iteration creates the results of a chain of element-wise operations from a monotonic
+ * arena, which is reset at the end of the iteration, e.g., once per time step. The default-
+ * allocated results of the same chain are benchmarked for comparison.
+ *
+ * @tparam Real  Floating-point type
+ * @param  size  Number of elements N
+ */
+template <typename Real>
+void registerArenaBenchmarks(const std::size_t size)
+{
+    typedef std::vector<Real, ArenaAllocator<Real> > ArenaVector;
+    const std::string real = getRealName<Real>();
+    std::vector<Real> vector1(size);
+    std::vector<Real> vector2(size);
+    fillRandom(vector1, static_cast<Real>(0.0));
+    fillRandom(vector2, static_cast<Real>(0.5));
+
+    registerBenchmark("add(multiply(vector), vector)", "std::vector", real, size,
+                      [vector1, vector2](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vector1);
+            const std::vector<Real> product = multiply<Real>(vector1, static_cast<Real>(1.5));
+            const std::vector<Real> result = add(product, vector2);
+            doNotOptimize(result);
+        }
+    });
+
+    registerBenchmark("add(multiply(vector), vector)", "std::vector+ArenaAllocator", real, size,
+                      [vector1, vector2](std::size_t iterations)
+    {
+        MonotonicArena arena(4 * vector1.size() * sizeof(Real));
+        const ArenaAllocator<Real> allocator(arena);
+        const ArenaVector arenaVector1(vector1.begin(), vector1.end(), allocator);
+        const ArenaVector arenaVector2(vector2.begin(), vector2.end(), allocator);
+        MonotonicArena stepArena(4 * vector1.size() * sizeof(Real));
+        const ArenaAllocator<Real> stepAllocator(stepArena);
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(arenaVector1);
+            const ArenaVector product = multiply(
+                std::allocator_arg, stepAllocator, arenaVector1, static_cast<Real>(1.5));
+            const ArenaVector result
+                = add(std::allocator_arg, stepAllocator, product, arenaVector2);
+            doNotOptimize(result);
+            stepArena.reset();
+        }
+    });
+}
+
+//! Register benchmarks of linear algebra functions for given Real type.
+/*!
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+void registerLinearAlgebraBenchmarks()
+{
+    // 3-vectors for all container types.
+    std::vector<Real> vector1(3);
+    std::vector<Real> vector2(3);
+    fillRandom(vector1, static_cast<Real>(0.0));
+    fillRandom(vector2, static_cast<Real>(0.5));
+    registerVector3Benchmarks<Real>("std::vector", vector1, vector2);
+
+    std::array<Real, 3> array1;
+    std::array<Real, 3> array2;
+    fillRandom(array1, static_cast<Real>(0.0));
+    fillRandom(array2, static_cast<Real>(0.5));
+    registerVector3Benchmarks<Real>("std::array", array1, array2);
+
+    FixedVector<Real, 3> fixedVector1;
+    FixedVector<Real, 3> fixedVector2;
+    fillRandom(fixedVector1, static_cast<Real>(0.0));
+    fillRandom(fixedVector2, static_cast<Real>(0.5));
+    registerVector3Benchmarks<Real>("sml::FixedVector", fixedVector1, fixedVector2);
+
+    // N-vectors, ranging from cache-resident to memory-bound sizes.
+    const std::size_t sizes[] = {64, 4096, 262144};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        std::vector<Real> largeVector1(sizes[i]);
+        std::vector<Real> largeVector2(sizes[i]);
+        fillRandom(largeVector1, static_cast<Real>(0.0));
+        fillRandom(largeVector2, static_cast<Real>(0.5));
+        registerVectorBenchmarks<Real>("std::vector", largeVector1, largeVector2);
+    }
+    registerFixedSizeBenchmarks<Real, std::array<Real, 64> >("std::array");
+    registerFixedSizeBenchmarks<Real, std::array<Real, 4096> >("std::array");
+
+    registerArenaBenchmarks<Real>(64);
+    registerArenaBenchmarks<Real>(4096);
+}
+
+//! Register benchmarks of linear algebra functions.
+void registerLinearAlgebraBenchmarks()
+{
+    registerLinearAlgebraBenchmarks<float>();
+    registerLinearAlgebraBenchmarks<double>();
+}
+
+static Registrar linearAlgebraRegistrar(&registerLinearAlgebraBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/matrix3.hpp>
+#include <sml/vector3Batch.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of 3x3 matrix functions for given Real type and batch size.
+/*!
+ * Each iteration rotates N 3-vectors, either by one matrix or by one matrix per 3-vector. For
+ * comparison, the rotations are also benchmarked for an array-of-structures layout (std::vector
+ * of std::array and of Matrix3).
+ *
+ * @tparam Real  Floating-point type
+ * @param  size  Number of 3-vectors N
+ */
+template <typename Real>
+void registerMatrix3Benchmarks(const std::size_t size)
+{
+    typedef std::array<Real, 3> Vector3;
+    const std::string real = getRealName<Real>();
+
+    const std::vector<Real> data
+        = createRandomData<Real>(4 * size, static_cast<Real>(-1.0), static_cast<Real>(1.0));
+    std::vector<Vector3> vectors(size);
+    std::vector<Matrix3<Real> > matrices(size);
+    Matrix3Batch<Real> matrixBatch(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        vectors[i] = {{data[3 * i], data[3 * i + 1], data[3 * i + 2]}};
+        matrices[i] = multiply(getZRotationMatrix(data[3 * size + i]),
+                               getXRotationMatrix(static_cast<Real>(0.4)));
+        matrixBatch.set(i, matrices[i]);
+    }
+    const Vector3Batch<Real> batch = convertToStructureOfArrays<Real>(vectors);
+    const Matrix3<Real> matrix = matrices[0];
+
+    registerBenchmark("multiply(matrix)", "std::vector<std::array>", real, size,
+                      [matrix, vectors](std::size_t iterations)
+    {
+        std::vector<Vector3> results(vectors.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vectors.data());
+            for (std::size_t j = 0; j < vectors.size(); j++)
+            {
+                results[j] = multiply(matrix, vectors[j]);
+            }
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("multiply(matrix)", "sml::Vector3Batch", real, size,
+                      [matrix, batch](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch.getX());
+            multiply(matrix, batch, result);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("multiply(matrices)", "std::vector<std::array>", real, size,
+                      [matrices, vectors](std::size_t iterations)
+    {
+        std::vector<Vector3> results(vectors.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vectors.data());
+            for (std::size_t j = 0; j < vectors.size(); j++)
+            {
+                results[j] = multiply(matrices[j], vectors[j]);
+            }
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("multiply(matrices)", "sml::Vector3Batch", real, size,
+                      [matrixBatch, batch](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch.getX());
+            multiply(matrixBatch, batch, result);
+            doNotOptimize(result.getX());
+        }
+    });
+}
+
+//! Register benchmarks of 3x3 matrix functions.
+void registerMatrix3Benchmarks()
+{
+    const std::size_t sizes[] = {1024, 262144};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        registerMatrix3Benchmarks<float>(sizes[i]);
+        registerMatrix3Benchmarks<double>(sizes[i]);
+    }
+}
+
+static Registrar matrix3Registrar(&registerMatrix3Benchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/quaternion.hpp>
+#include <sml/vector3Batch.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of quaternion functions for given Real type and batch size.
+/*!
+ * Each iteration rotates N 3-vectors by one unit quaternion. For comparison, the rotation is also
+ * benchmarked for an array-of-structures layout (std::vector of std::array), rotating one
+ * 3-vector at a time.
+ *
+ * @tparam Real  Floating-point type
+ * @param  size  Number of 3-vectors N
+ */
+template <typename Real>
+void registerQuaternionBenchmarks(const std::size_t size)
+{
+    typedef std::array<Real, 3> Vector3;
+    const std::string real = getRealName<Real>();
+
+    const std::vector<Real> data
+        = createRandomData<Real>(3 * size, static_cast<Real>(-1.0), static_cast<Real>(1.0));
+    std::vector<Vector3> vectors(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        vectors[i] = {{data[3 * i], data[3 * i + 1], data[3 * i + 2]}};
+    }
+    const Vector3Batch<Real> batch = convertToStructureOfArrays<Real>(vectors);
+    const Vector3 axis = {{static_cast<Real>(0.6), static_cast<Real>(0.0), static_cast<Real>(0.8)}};
+    const Quaternion<Real> quaternion
+        = convertAxisAngleToQuaternion(axis, static_cast<Real>(0.4));
+
+    registerBenchmark("rotate", "std::vector<std::array>", real, size,
+                      [quaternion, vectors](std::size_t iterations)
+    {
+        std::vector<Vector3> results(vectors.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vectors.data());
+            for (std::size_t j = 0; j < vectors.size(); j++)
+            {
+                results[j] = rotate(quaternion, vectors[j]);
+            }
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("rotate", "sml::Vector3Batch", real, size,
+                      [quaternion, batch](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch.getX());
+            rotate(quaternion, batch, result);
+            doNotOptimize(result.getX());
+        }
+    });
+}
+
+//! Register benchmarks of quaternion functions.
+void registerQuaternionBenchmarks()
+{
+    const std::size_t sizes[] = {1024, 262144};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        registerQuaternionBenchmarks<float>(sizes[i]);
+        registerQuaternionBenchmarks<double>(sizes[i]);
+    }
+}
+
+static Registrar quaternionRegistrar(&registerQuaternionBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
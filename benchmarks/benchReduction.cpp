@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/executionPolicy.hpp>
+#include <sml/linearAlgebra.hpp>
+#include <sml/linearAlgebraBatch.hpp>
+#include <sml/reduction.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of summation methods for given Real type and vector size.
+/*!
+ * @tparam Real  Floating-point type
+ * @param  size  Number of elements N
+ */
+template <typename Real>
+void registerReductionBenchmarks(const std::size_t size)
+{
+    const std::string real = getRealName<Real>();
+    const std::vector<Real> vector1
+        = createRandomData<Real>(size, static_cast<Real>(-1.0), static_cast<Real>(1.0));
+    const std::vector<Real> vector2
+        = createRandomData<Real>(size, static_cast<Real>(0.0), static_cast<Real>(1.0));
+
+    const SummationMethod methods[] = {SummationMethod::sequential,
+                                       SummationMethod::pairwise,
+                                       SummationMethod::kahan};
+    const std::string names[] = {"dot(sequential)", "dot(pairwise)", "dot(kahan)"};
+    const std::string sumNames[] = {"sum(sequential)", "sum(pairwise)", "sum(kahan)"};
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        const SummationMethod method = methods[i];
+        registerBenchmark(sumNames[i], "std::vector", real, size,
+                          [vector1, method](std::size_t iterations)
+        {
+            for (std::size_t j = 0; j < iterations; j++)
+            {
+                doNotOptimize(vector1.data());
+                doNotOptimize(sum<Real>(vector1, method));
+            }
+        });
+
+        registerBenchmark(names[i], "std::vector", real, size,
+                          [vector1, vector2, method](std::size_t iterations)
+        {
+            for (std::size_t j = 0; j < iterations; j++)
+            {
+                doNotOptimize(vector1.data());
+                doNotOptimize(dot<Real>(vector1, vector2, method));
+            }
+        });
+    }
+
+    registerBenchmark("dot(pairwise,parallel)", "std::vector", real, size,
+                      [vector1, vector2](std::size_t iterations)
+    {
+        for (std::size_t j = 0; j < iterations; j++)
+        {
+            doNotOptimize(vector1.data());
+            doNotOptimize(dot<Real>(
+                vector1, vector2, SummationMethod::pairwise, ExecutionMode::parallel));
+        }
+    });
+}
+
+//! Register benchmarks of reductions.
+void registerReductionBenchmarks()
+{
+    const std::size_t sizes[] = {4096, 262144, 4194304};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        registerReductionBenchmarks<float>(sizes[i]);
+        registerReductionBenchmarks<double>(sizes[i]);
+    }
+}
+
+static Registrar reductionRegistrar(&registerReductionBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/tableSearch.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of table search functions for given Real type and table size.
+/*!
+ * Each iteration searches for a batch of random queries (binary search) or sorted queries
+ * (hunting from the previous interval).
+ *
+ * @tparam Real       Floating-point type
+ * @param  tableSize  Number of table entries N
+ */
+template <typename Real>
+void registerTableSearchBenchmarks(const std::size_t tableSize)
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t queryCount = 1024;
+
+    std::vector<Real> xData(tableSize);
+    for (std::size_t i = 0; i < tableSize; i++)
+    {
+        xData[i] = static_cast<Real>(i) / static_cast<Real>(tableSize - 1);
+    }
+    const std::vector<Real> randomQueries
+        = createRandomData<Real>(queryCount, static_cast<Real>(0.0), static_cast<Real>(1.0));
+    std::vector<Real> sortedQueries = randomQueries;
+    std::sort(sortedQueries.begin(), sortedQueries.end());
+
+    registerBenchmark("findInterval", "std::vector", real, tableSize,
+                      [xData, randomQueries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(randomQueries.data());
+            std::size_t sum = 0;
+            for (std::size_t j = 0; j < randomQueries.size(); j++)
+            {
+                sum += findInterval(xData, randomQueries[j]);
+            }
+            doNotOptimize(sum);
+        }
+    });
+
+    registerBenchmark("huntInterval(sorted)", "std::vector", real, tableSize,
+                      [xData, sortedQueries](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(sortedQueries.data());
+            std::size_t cursor = 0;
+            for (std::size_t j = 0; j < sortedQueries.size(); j++)
+            {
+                cursor = huntInterval(xData, sortedQueries[j], cursor);
+            }
+            doNotOptimize(cursor);
+        }
+    });
+
+    registerBenchmark("getStencilStart", "scalar", real, tableSize,
+                      [tableSize](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            std::size_t interval = i % (tableSize - 1);
+            doNotOptimize(interval);
+            doNotOptimize(getStencilStart(interval, 8, tableSize));
+        }
+    });
+}
+
+//! Register benchmarks of table search functions.
+void registerTableSearchBenchmarks()
+{
+    const std::size_t tableSizes[] = {1024, 1048576};
+    for (std::size_t i = 0; i < sizeof(tableSizes) / sizeof(tableSizes[0]); i++)
+    {
+        registerTableSearchBenchmarks<float>(tableSizes[i]);
+        registerTableSearchBenchmarks<double>(tableSizes[i]);
+    }
+}
+
+static Registrar tableSearchRegistrar(&registerTableSearchBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/trigonometry.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of trigonometric functions for given Real type.
+/*!
+ * Each iteration computes the sines and cosines (or arctangents) of an array of inputs, with
+ * std::sin()/std::cos()/std::atan2() for comparison.
+ *
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+void registerTrigonometryBenchmarks()
+{
+    const std::string real = getRealName<Real>();
+    const std::size_t size = 1024;
+    const std::vector<Real> angles
+        = createRandomData<Real>(size, static_cast<Real>(-100.0), static_cast<Real>(100.0));
+    const std::vector<Real> y
+        = createRandomData<Real>(size, static_cast<Real>(-1.0), static_cast<Real>(1.0));
+    const std::vector<Real> x
+        = createRandomData<Real>(size, static_cast<Real>(-1.0), static_cast<Real>(1.0));
+
+    registerBenchmark("computeSineAndCosine", "std::sin/std::cos", real, size,
+                      [angles](std::size_t iterations)
+    {
+        std::vector<Real> sines(angles.size());
+        std::vector<Real> cosines(angles.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(angles.data());
+            for (std::size_t j = 0; j < angles.size(); j++)
+            {
+                sines[j] = std::sin(angles[j]);
+                cosines[j] = std::cos(angles[j]);
+            }
+            doNotOptimize(sines.data());
+            doNotOptimize(cosines.data());
+        }
+    });
+
+    const TrigonometricAccuracy accuracies[] = {TrigonometricAccuracy::precise,
+                                                TrigonometricAccuracy::coarse};
+    const char* const accuracyNames[] = {"precise", "coarse"};
+    for (std::size_t k = 0; k < 2; k++)
+    {
+        const TrigonometricAccuracy accuracy = accuracies[k];
+        registerBenchmark("computeSine", accuracyNames[k], real, size,
+                          [angles, accuracy](std::size_t iterations)
+        {
+            std::vector<Real> sines(angles.size());
+            for (std::size_t i = 0; i < iterations; i++)
+            {
+                doNotOptimize(angles.data());
+                computeSine<Real>(angles, sines, accuracy);
+                doNotOptimize(sines.data());
+            }
+        });
+
+        registerBenchmark("computeSineAndCosine", accuracyNames[k], real, size,
+                          [angles, accuracy](std::size_t iterations)
+        {
+            std::vector<Real> sines(angles.size());
+            std::vector<Real> cosines(angles.size());
+            for (std::size_t i = 0; i < iterations; i++)
+            {
+                doNotOptimize(angles.data());
+                computeSineAndCosine<Real>(angles, sines, cosines, accuracy);
+                doNotOptimize(sines.data());
+                doNotOptimize(cosines.data());
+            }
+        });
+
+        registerBenchmark("computeArcTangent2", accuracyNames[k], real, size,
+                          [y, x, accuracy](std::size_t iterations)
+        {
+            std::vector<Real> results(y.size());
+            for (std::size_t i = 0; i < iterations; i++)
+            {
+                doNotOptimize(y.data());
+                computeArcTangent2<Real>(y, x, results, accuracy);
+                doNotOptimize(results.data());
+            }
+        });
+    }
+
+    registerBenchmark("computeArcTangent2", "std::atan2", real, size,
+                      [y, x](std::size_t iterations)
+    {
+        std::vector<Real> results(y.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(y.data());
+            for (std::size_t j = 0; j < y.size(); j++)
+            {
+                results[j] = std::atan2(y[j], x[j]);
+            }
+            doNotOptimize(results.data());
+        }
+    });
+}
+
+//! Register benchmarks of trigonometric functions.
+void registerTrigonometryBenchmarks()
+{
+    registerTrigonometryBenchmarks<float>();
+    registerTrigonometryBenchmarks<double>();
+}
+
+static Registrar trigonometryRegistrar(&registerTrigonometryBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
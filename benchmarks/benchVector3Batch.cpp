@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/linearAlgebra.hpp>
+#include <sml/vector3Batch.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of Vector3Batch functions for given Real type and batch size.
+/*!
+ * Each iteration processes the whole batch of N 3-vectors. For comparison, the cross product is
+ * also benchmarked for an array-of-structures layout (std::vector of std::array).
+ *
+ * @tparam Real  Floating-point type
+ * @param  size  Number of 3-vectors N in batch
+ */
+template <typename Real>
+void registerVector3BatchBenchmarks(const std::size_t size)
+{
+    typedef std::array<Real, 3> Vector3;
+    const std::string real = getRealName<Real>();
+    const std::string container = "sml::Vector3Batch";
+
+    const std::vector<Real> data1
+        = createRandomData<Real>(3 * size, static_cast<Real>(-1.0), static_cast<Real>(1.0));
+    const std::vector<Real> data2
+        = createRandomData<Real>(3 * size, static_cast<Real>(0.0), static_cast<Real>(2.0));
+    std::vector<Vector3> vectors1(size);
+    std::vector<Vector3> vectors2(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        for (std::size_t j = 0; j < 3; j++)
+        {
+            vectors1[i][j] = data1[3 * i + j];
+            vectors2[i][j] = data2[3 * i + j];
+        }
+    }
+    const Vector3Batch<Real> batch1 = convertToStructureOfArrays<Real>(vectors1);
+    const Vector3Batch<Real> batch2 = convertToStructureOfArrays<Real>(vectors2);
+
+    registerBenchmark("cross", "std::vector<std::array>", real, size,
+                      [vectors1, vectors2](std::size_t iterations)
+    {
+        std::vector<Vector3> results(vectors1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vectors1.data());
+            for (std::size_t j = 0; j < vectors1.size(); j++)
+            {
+                results[j] = cross(vectors1[j], vectors2[j]);
+            }
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("cross", container, real, size, [batch1, batch2](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            cross(batch1, batch2, result);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("dot", container, real, size, [batch1, batch2](std::size_t iterations)
+    {
+        std::vector<Real> results(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            dot(batch1, batch2, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("squaredNorm", container, real, size, [batch1](std::size_t iterations)
+    {
+        std::vector<Real> results(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            squaredNorm(batch1, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("norm", container, real, size, [batch1](std::size_t iterations)
+    {
+        std::vector<Real> results(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            norm(batch1, results);
+            doNotOptimize(results.data());
+        }
+    });
+
+    registerBenchmark("normalize", container, real, size, [batch1](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            normalize(batch1, result);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("normalize(parallel)", container, real, size, [batch1](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            normalize(batch1, result, ExecutionMode::parallelVectorized);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("multiply", container, real, size, [batch1](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            multiply(batch1, static_cast<Real>(1.5), result);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("add(scalar)", container, real, size, [batch1](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            add(batch1, static_cast<Real>(1.5), result);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("add(vector)", container, real, size,
+                      [batch1, batch2](std::size_t iterations)
+    {
+        Vector3Batch<Real> result(batch1.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            add(batch1, batch2, result);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("getXUnitVectors", container, real, size, [size](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            const Vector3Batch<Real> result = getXUnitVectors<Real>(size);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("convertToStructureOfArrays", container, real, size,
+                      [vectors1](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(vectors1.data());
+            const Vector3Batch<Real> result = convertToStructureOfArrays<Real>(vectors1);
+            doNotOptimize(result.getX());
+        }
+    });
+
+    registerBenchmark("convertToArrayOfStructures", container, real, size,
+                      [batch1](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(batch1.getX());
+            const std::vector<Vector3> result = convertToArrayOfStructures<Vector3>(batch1);
+            doNotOptimize(result.data());
+        }
+    });
+}
+
+//! Register benchmarks of Vector3Batch functions.
+void registerVector3BatchBenchmarks()
+{
+    const std::size_t sizes[] = {1024, 262144};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        registerVector3BatchBenchmarks<float>(sizes[i]);
+        registerVector3BatchBenchmarks<double>(sizes[i]);
+    }
+}
+
+static Registrar vector3BatchRegistrar(&registerVector3BatchBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sml/linearAlgebra.hpp>
+#include <sml/vectorExpression.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Register benchmarks of vector expressions for given Real type and vector size.
+/*!
+ * Benchmarks the chain add(multiply(v, dt), add(r, w)), evaluated eagerly (with temporaries) and
+ * lazily (fused into a single loop).
+ *
+ * @tparam Real  Floating-point type
+ * @param  size  Number of elements N
+ */
+template <typename Real>
+void registerVectorExpressionBenchmarks(const std::size_t size)
+{
+    const std::string real = getRealName<Real>();
+    const Real dt = static_cast<Real>(0.01);
+    const std::vector<Real> v
+        = createRandomData<Real>(size, static_cast<Real>(-1.0), static_cast<Real>(1.0));
+    const std::vector<Real> r
+        = createRandomData<Real>(size, static_cast<Real>(0.0), static_cast<Real>(10.0));
+    const std::vector<Real> w
+        = createRandomData<Real>(size, static_cast<Real>(-0.1), static_cast<Real>(0.1));
+
+    registerBenchmark("add(multiply(v, dt), add(r, w))", "std::vector", real, size,
+                      [v, r, w, dt](std::size_t iterations)
+    {
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(v.data());
+            const std::vector<Real> result = add(multiply<Real>(v, dt), add(r, w));
+            doNotOptimize(result.data());
+        }
+    });
+
+    registerBenchmark("evaluate(add(multiply(v, dt), add(r, w)))", "std::vector", real, size,
+                      [v, r, w, dt](std::size_t iterations)
+    {
+        std::vector<Real> result(v.size());
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            doNotOptimize(v.data());
+            evaluate(expression::add(expression::multiply<Real>(v, dt), expression::add(r, w)),
+                     result);
+            doNotOptimize(result.data());
+        }
+    });
+}
+
+//! Register benchmarks of vector expressions.
+void registerVectorExpressionBenchmarks()
+{
+    const std::size_t sizes[] = {64, 4096, 262144};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        registerVectorExpressionBenchmarks<float>(sizes[i]);
+        registerVectorExpressionBenchmarks<double>(sizes[i]);
+    }
+}
+
+static Registrar vectorExpressionRegistrar(&registerVectorExpressionBenchmarks);
+
+} // namespace benchmarks
+} // namespace sml
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Benchmark case.
+/*!
+ * Describes a single benchmark case: a function, benchmarked for a specific container type,
+ * Real type and problem size. The body executes the operation being benchmarked a given number of
+ * times.
+ */
+struct Benchmark
+{
+    //! Name of function being benchmarked.
+    std::string function;
+
+    //! Name of container type.
+    std::string container;
+
+    //! Name of Real type.
+    std::string real;
+
+    //! Problem size, e.g., vector length or number of interpolation nodes.
+    std::size_t size;
+
+    //! Body that executes the operation being benchmarked a given number of times.
+    std::function<void(std::size_t)> body;
+
+    //! Get unique name of benchmark case.
+    /*!
+     * @return  Name of benchmark case: function/container/real/size
+     */
+    std::string getName() const
+    {
+        return function + "/" + container + "/" + real + "/" + std::to_string(size);
+    }
+};
+
+//! Get registry of benchmark cases.
+/*!
+ * @return  Reference to collection of all registered benchmark cases
+ */
+inline std::vector<Benchmark>& getRegistry()
+{
+    static std::vector<Benchmark> registry;
+    return registry;
+}
+
+//! Register benchmark case.
+/*!
+ * @param  function   Name of function being benchmarked
+ * @param  container  Name of container type
+ * @param  real       Name of Real type
+ * @param  size       Problem size
+ * @param  body       Body that executes the operation a given number of times
+ */
+inline void registerBenchmark(const std::string& function,
+                              const std::string& container,
+                              const std::string& real,
+                              const std::size_t size,
+                              const std::function<void(std::size_t)>& body)
+{
+    Benchmark benchmark = {function, container, real, size, body};
+    getRegistry().push_back(benchmark);
+}
+
+//! Registrar that registers benchmark cases during static initialization.
+/*!
+ * Each benchmark source file defines a function that registers its benchmark cases, and a static
+ * instance of this class that calls it.
+ */
+struct Registrar
+{
+    //! Call registration function.
+    /*!
+     * @param  registration  Function that registers benchmark cases
+     */
+    explicit Registrar(void (*registration)())
+    {
+        registration();
+    }
+};
+
+//! Prevent compiler from optimizing away value.
+/*!
+ * @tparam T      Type of value
+ * @param  value  Value that must be computed
+ */
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+//! Prevent compiler from assuming that memory has not changed.
+inline void clobberMemory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+//! Create vector of uniformly distributed random numbers.
+/*!
+ * Creates a vector of uniformly distributed random numbers, using a fixed seed so that the input
+ * data is identical across runs and builds.
+ *
+ * @tparam Real   Floating-point type
+ * @param  size   Number of random numbers
+ * @param  lower  Lower bound of distribution
+ * @param  upper  Upper bound of distribution
+ * @return        Vector of random numbers
+ */
+template <typename Real>
+std::vector<Real> createRandomData(const std::size_t size, const Real lower, const Real upper)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<Real> distribution(lower, upper);
+    std::vector<Real> data(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        data[i] = distribution(generator);
+    }
+    return data;
+}
+
+//! Name of Real type.
+/*!
+ * @tparam Real  Real type
+ * @return       Name of Real type
+ */
+template <typename Real>
+std::string getRealName();
+
+template <>
+inline std::string getRealName<float>() { return "float"; }
+
+template <>
+inline std::string getRealName<double>() { return "double"; }
+
+} // namespace benchmarks
+} // namespace sml
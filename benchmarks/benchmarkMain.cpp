@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sml/simd.hpp>
+
+#include "benchmark.hpp"
+
+namespace sml
+{
+namespace benchmarks
+{
+
+//! Benchmark settings, set from command-line arguments.
+struct Settings
+{
+    //! Substring that names of benchmark cases must contain to be run.
+    std::string filter;
+
+    //! Path to JSON output file (empty to only write to console).
+    std::string outputPath;
+
+    //! Path to JSON file with baseline results to compare against (empty to not compare).
+    std::string baselinePath;
+
+    //! Minimum time per repetition [s].
+    double minimumTime;
+
+    //! Number of repetitions; the fastest repetition is reported.
+    std::size_t repetitions;
+
+    //! Relative slowdown with respect to baseline that is reported as regression.
+    double threshold;
+};
+
+//! Result of benchmark case.
+struct Result
+{
+    //! Benchmark case.
+    const Benchmark* benchmark;
+
+    //! Number of iterations per repetition.
+    std::size_t iterations;
+
+    //! Time per iteration of fastest repetition [ns].
+    double nanosecondsPerIteration;
+};
+
+//! Time iterations of benchmark body.
+/*!
+ * @param  benchmark   Benchmark case
+ * @param  iterations  Number of iterations
+ * @return             Elapsed time [s]
+ */
+double timeIterations(const Benchmark& benchmark, const std::size_t iterations)
+{
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point start = Clock::now();
+    benchmark.body(iterations);
+    const Clock::time_point end = Clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+//! Run benchmark case.
+/*!
+ * Runs benchmark case, by first calibrating the number of iterations such that a repetition takes
+ * at least the minimum time, and then timing the given number of repetitions. The fastest
+ * repetition is reported, since it is least affected by other processes running on the machine.
+ *
+ * @param  benchmark  Benchmark case
+ * @param  settings   Benchmark settings
+ * @return            Result of benchmark case
+ */
+Result runBenchmark(const Benchmark& benchmark, const Settings& settings)
+{
+    std::size_t iterations = 1;
+    double elapsed = timeIterations(benchmark, iterations);
+    while (elapsed < settings.minimumTime)
+    {
+        const double factor = elapsed > 0.0 ? 1.4 * settings.minimumTime / elapsed : 10.0;
+        iterations = static_cast<std::size_t>(
+            static_cast<double>(iterations) * std::min(std::max(factor, 2.0), 10.0));
+        elapsed = timeIterations(benchmark, iterations);
+    }
+
+    double fastest = elapsed;
+    for (std::size_t i = 1; i < settings.repetitions; ++i)
+    {
+        fastest = std::min(fastest, timeIterations(benchmark, iterations));
+    }
+
+    Result result = {&benchmark, iterations, fastest * 1.0e9 / static_cast<double>(iterations)};
+    return result;
+}
+
+//! Get name of instruction set.
+/*!
+ * @param  instructionSet  Instruction set
+ * @return                 Name of instruction set
+ */
+std::string getInstructionSetName(const InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+        case InstructionSet::avx512:
+            return "avx512";
+        case InstructionSet::avx2:
+            return "avx2";
+        default:
+            return "generic";
+    }
+}
+
+//! Get name of compiler.
+/*!
+ * @return  Name and version of compiler used to build benchmarks
+ */
+std::string getCompilerName()
+{
+    std::ostringstream name;
+#if defined(__clang__)
+    name << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined(__GNUC__)
+    name << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined(_MSC_VER)
+    name << "msvc " << _MSC_VER;
+#else
+    name << "unknown";
+#endif
+    return name.str();
+}
+
+//! Write results as JSON.
+/*!
+ * Writes results as a JSON document, with one benchmark case per line, so that result files can
+ * also be compared using line-based tools, e.g., diff.
+ *
+ * @param  results  Results of benchmark cases
+ * @param  stream   Output stream
+ */
+void writeJson(const std::vector<Result>& results, std::ostream& stream)
+{
+    stream << "{\n"
+           << "  \"context\": {\"library\": \"sml\", \"compiler\": \"" << getCompilerName()
+           << "\", \"instruction_set\": \"" << getInstructionSetName(getInstructionSet())
+           << "\"},\n"
+           << "  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const Benchmark& benchmark = *results[i].benchmark;
+        stream << "    {\"name\": \"" << benchmark.getName()
+               << "\", \"function\": \"" << benchmark.function
+               << "\", \"container\": \"" << benchmark.container
+               << "\", \"real\": \"" << benchmark.real
+               << "\", \"size\": " << benchmark.size
+               << ", \"iterations\": " << results[i].iterations
+               << ", \"ns_per_iteration\": " << std::setprecision(6)
+               << results[i].nanosecondsPerIteration
+               << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    stream << "  ]\n"
+           << "}\n";
+}
+
+//! Read baseline results from JSON.
+/*!
+ * Reads names and times per iteration of benchmark cases from a JSON file written by writeJson().
+ *
+ * @param  path  Path to JSON file
+ * @return       Map of benchmark names to times per iteration [ns]
+ */
+std::map<std::string, double> readBaseline(const std::string& path)
+{
+    std::ifstream file(path.c_str());
+    if (!file)
+    {
+        throw std::runtime_error("ERROR: Could not open baseline file " + path);
+    }
+
+    const std::string nameKey = "\"name\": \"";
+    const std::string timeKey = "\"ns_per_iteration\": ";
+    std::map<std::string, double> baseline;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        const std::size_t namePosition = line.find(nameKey);
+        const std::size_t timePosition = line.find(timeKey);
+        if (namePosition == std::string::npos || timePosition == std::string::npos)
+        {
+            continue;
+        }
+        const std::size_t nameStart = namePosition + nameKey.size();
+        const std::string name = line.substr(nameStart, line.find('"', nameStart) - nameStart);
+        baseline[name] = std::atof(line.c_str() + timePosition + timeKey.size());
+    }
+    return baseline;
+}
+
+//! Compare results against baseline.
+/*!
+ * Prints the ratio of the time per iteration to the baseline for each benchmark case that is
+ * present in both, and flags cases that are slower than the baseline by more than the threshold.
+ *
+ * @param  results   Results of benchmark cases
+ * @param  baseline  Map of benchmark names to baseline times per iteration [ns]
+ * @param  settings  Benchmark settings
+ * @return           Number of regressions
+ */
+std::size_t compareToBaseline(const std::vector<Result>& results,
+                              const std::map<std::string, double>& baseline,
+                              const Settings& settings)
+{
+    std::size_t regressions = 0;
+    std::cout << "\nComparison to baseline " << settings.baselinePath << " (ratio = new / old):\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const std::string name = results[i].benchmark->getName();
+        const std::map<std::string, double>::const_iterator old = baseline.find(name);
+        if (old == baseline.end() || old->second <= 0.0)
+        {
+            continue;
+        }
+        const double ratio = results[i].nanosecondsPerIteration / old->second;
+        const bool isRegression = ratio > 1.0 + settings.threshold;
+        regressions += isRegression ? 1 : 0;
+        std::cout << std::left << std::setw(64) << name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(8) << ratio
+                  << (isRegression ? "  REGRESSION" : "") << "\n";
+    }
+    std::cout << regressions << " regression(s) beyond " << settings.threshold * 100.0 << "%\n";
+    return regressions;
+}
+
+//! Print usage.
+void printUsage()
+{
+    std::cout << "Usage: sml_bench [options]\n"
+              << "  --filter <substring>  run benchmarks whose name contains substring\n"
+              << "  --output <file>       write results as JSON to file\n"
+              << "  --baseline <file>     compare results to JSON file written by --output\n"
+              << "  --threshold <ratio>   relative slowdown reported as regression (default 0.1)\n"
+              << "  --min-time <seconds>  minimum time per repetition (default 0.05)\n"
+              << "  --repetitions <n>     number of repetitions (default 5)\n"
+              << "  --instruction-set <generic|avx2|avx512>  instruction set to dispatch to\n"
+              << "  --list                list benchmark names and exit\n";
+}
+
+} // namespace benchmarks
+} // namespace sml
+
+int main(int argc, char* argv[])
+{
+    using namespace sml::benchmarks;
+    using sml::InstructionSet;
+
+    Settings settings = {"", "", "", 0.05, 5, 0.1};
+    bool isListOnly = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (argument == "--filter" && hasValue)
+        {
+            settings.filter = argv[++i];
+        }
+        else if (argument == "--output" && hasValue)
+        {
+            settings.outputPath = argv[++i];
+        }
+        else if (argument == "--baseline" && hasValue)
+        {
+            settings.baselinePath = argv[++i];
+        }
+        else if (argument == "--threshold" && hasValue)
+        {
+            settings.threshold = std::atof(argv[++i]);
+        }
+        else if (argument == "--min-time" && hasValue)
+        {
+            settings.minimumTime = std::atof(argv[++i]);
+        }
+        else if (argument == "--repetitions" && hasValue)
+        {
+            settings.repetitions = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (argument == "--instruction-set" && hasValue)
+        {
+            const std::string name = argv[++i];
+            const InstructionSet instructionSet
+                = name == "avx512" ? InstructionSet::avx512
+                : name == "avx2" ? InstructionSet::avx2 : InstructionSet::generic;
+            if (getInstructionSetName(instructionSet) != name
+                || !sml::setInstructionSet(instructionSet))
+            {
+                std::cerr << "ERROR: Instruction set " << name << " is not supported" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (argument == "--list")
+        {
+            isListOnly = true;
+        }
+        else
+        {
+            printUsage();
+            return argument == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    std::vector<Result> results;
+    const std::vector<Benchmark>& registry = getRegistry();
+    for (std::size_t i = 0; i < registry.size(); ++i)
+    {
+        const std::string name = registry[i].getName();
+        if (name.find(settings.filter) == std::string::npos)
+        {
+            continue;
+        }
+        if (isListOnly)
+        {
+            std::cout << name << "\n";
+            continue;
+        }
+        results.push_back(runBenchmark(registry[i], settings));
+        std::cout << std::left << std::setw(64) << name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(14)
+                  << results.back().nanosecondsPerIteration << " ns" << std::endl;
+    }
+
+    if (isListOnly)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    if (!settings.outputPath.empty())
+    {
+        std::ofstream file(settings.outputPath.c_str());
+        if (!file)
+        {
+            std::cerr << "ERROR: Could not open output file " << settings.outputPath << std::endl;
+            return EXIT_FAILURE;
+        }
+        writeJson(results, file);
+    }
+
+    if (!settings.baselinePath.empty())
+    {
+        try
+        {
+            const std::size_t regressions
+                = compareToBaseline(results, readBaseline(settings.baselinePath), settings);
+            return regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+        catch (const std::exception& error)
+        {
+            std::cerr << error.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
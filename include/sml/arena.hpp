@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace sml
+{
+
+//! Monotonic memory arena.
+/*!
+ * Arena that hands out memory by bumping an offset into a buffer, which makes allocation cheap
+ * and free of contention between threads, since each thread can own its own arena. Individual
+ * deallocations are ignored; instead, all memory is released at once by calling reset(), e.g.,
+ * once per time step of a simulation.
+ *
+ * If the buffer is exhausted, a new buffer of at least twice the size is allocated from the heap.
+ * On reset(), multiple buffers are replaced by a single buffer with their combined capacity, so
+ * that after the first reset, a workload with the same memory footprint is served from a single
+ * buffer without touching the heap.
+ *
+ * The arena is not thread-safe, and must outlive all memory allocated from it. Use ArenaAllocator
+ * to allocate the elements of standard containers, e.g., std::vector, from an arena. With C++17,
+ * std::pmr::monotonic_buffer_resource and std::pmr::polymorphic_allocator can be used instead in
+ * the same way.
+ *
+ * @sa ArenaAllocator
+ */
+class MonotonicArena
+{
+public:
+
+    //! Construct arena.
+    /*!
+     * @param  initialCapacity  Capacity of initial buffer in bytes
+     */
+    explicit MonotonicArena(const std::size_t initialCapacity = 65536)
+        : buffers(),
+          bufferCapacity(0),
+          capacity(0),
+          offset(0),
+          size(0)
+    {
+        addBuffer(initialCapacity);
+    }
+
+    //! Arenas are not copyable, since allocators refer to them by address.
+    MonotonicArena(const MonotonicArena&) = delete;
+
+    //! Arenas are not copyable, since allocators refer to them by address.
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    //! Allocate memory.
+    /*!
+     * @param  byteCount  Number of bytes to allocate
+     * @param  alignment  Alignment in bytes (power of 2)
+     * @return            Pointer to allocated memory
+     */
+    void* allocate(const std::size_t byteCount,
+                   const std::size_t alignment = alignof(std::max_align_t))
+    {
+        assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+        std::size_t padding = computePadding(alignment);
+        if (offset + padding + byteCount > bufferCapacity)
+        {
+            const std::size_t required = byteCount + alignment;
+            addBuffer(2 * bufferCapacity > required ? 2 * bufferCapacity : required);
+            padding = computePadding(alignment);
+        }
+        void* pointer = buffers.back().get() + offset + padding;
+        offset += padding + byteCount;
+        size += byteCount;
+        return pointer;
+    }
+
+    //! Deallocate memory.
+    /*!
+     * Does nothing, since memory is only released by reset().
+     *
+     * @param  pointer    Pointer to allocated memory
+     * @param  byteCount  Number of bytes allocated
+     */
+    void deallocate(void* pointer, const std::size_t byteCount)
+    {
+        static_cast<void>(pointer);
+        static_cast<void>(byteCount);
+    }
+
+    //! Release all memory allocated from arena.
+    /*!
+     * Makes all memory in the arena available again. All memory allocated from the arena
+     * (including the elements of containers that use it) becomes invalid.
+     */
+    void reset()
+    {
+        if (buffers.size() > 1)
+        {
+            const std::size_t totalCapacity = capacity;
+            buffers.clear();
+            capacity = 0;
+            addBuffer(totalCapacity);
+        }
+        offset = 0;
+        size = 0;
+    }
+
+    //! Get capacity.
+    /*!
+     * @return  Total capacity of all buffers in bytes
+     */
+    std::size_t getCapacity() const { return capacity; }
+
+    //! Get size.
+    /*!
+     * @return  Number of bytes allocated since construction or last reset
+     */
+    std::size_t getSize() const { return size; }
+
+private:
+
+    //! Compute padding required to align next allocation in current buffer.
+    /*!
+     * @param  alignment  Alignment in bytes (power of 2)
+     * @return            Number of padding bytes
+     */
+    std::size_t computePadding(const std::size_t alignment) const
+    {
+        const std::uintptr_t address
+            = reinterpret_cast<std::uintptr_t>(buffers.back().get() + offset);
+        return static_cast<std::size_t>((alignment - address % alignment) % alignment);
+    }
+
+    //! Add buffer, which becomes the current buffer.
+    /*!
+     * @param  someCapacity  Capacity of buffer in bytes
+     */
+    void addBuffer(const std::size_t someCapacity)
+    {
+        buffers.emplace_back(new unsigned char[someCapacity]);
+        bufferCapacity = someCapacity;
+        capacity += someCapacity;
+        offset = 0;
+    }
+
+    //! Buffers, of which the last one is the current buffer.
+    std::vector<std::unique_ptr<unsigned char[]> > buffers;
+
+    //! Capacity of current buffer in bytes.
+    std::size_t bufferCapacity;
+
+    //! Total capacity of all buffers in bytes.
+    std::size_t capacity;
+
+    //! Offset of first free byte in current buffer.
+    std::size_t offset;
+
+    //! Number of bytes allocated since construction or last reset.
+    std::size_t size;
+};
+
+//! Allocator that allocates from monotonic arena.
+/*!
+ * Standard-conforming allocator that allocates memory from a MonotonicArena, e.g., for use with
+ * std::vector<Real, ArenaAllocator<Real>>. Such vectors can be passed to the allocator-extended
+ * functions in sml, e.g., normalize(std::allocator_arg, allocator, vector), so that the results
+ * are allocated from the arena as well.
+ *
+ * @sa MonotonicArena
+ * @tparam T  Element type
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+
+    //! Element type.
+    typedef T value_type;
+
+    //! Construct allocator.
+    /*!
+     * @param  someArena  Arena to allocate from, which must outlive the allocator
+     */
+    ArenaAllocator(MonotonicArena& someArena)
+        : arena(&someArena)
+    { }
+
+    //! Construct allocator from allocator for different element type.
+    /*!
+     * @tparam U      Element type of other allocator
+     * @param  other  Allocator to copy arena from
+     */
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other)
+        : arena(other.getArena())
+    { }
+
+    //! Allocate memory.
+    /*!
+     * @param  count  Number of elements to allocate
+     * @return        Pointer to allocated elements
+     */
+    T* allocate(const std::size_t count)
+    {
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    //! Deallocate memory.
+    /*!
+     * @param  pointer  Pointer to allocated elements
+     * @param  count    Number of elements allocated
+     */
+    void deallocate(T* pointer, const std::size_t count)
+    {
+        arena->deallocate(pointer, count * sizeof(T));
+    }
+
+    //! Get arena.
+    /*!
+     * @return  Pointer to arena that memory is allocated from
+     */
+    MonotonicArena* getArena() const { return arena; }
+
+private:
+
+    //! Arena that memory is allocated from.
+    MonotonicArena* arena;
+};
+
+//! Compare allocators for equality.
+/*!
+ * @return  True if both allocators allocate from the same arena
+ */
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& allocator1, const ArenaAllocator<U>& allocator2)
+{
+    return allocator1.getArena() == allocator2.getArena();
+}
+
+//! Compare allocators for inequality.
+/*!
+ * @return  True if allocators allocate from different arenas
+ */
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& allocator1, const ArenaAllocator<U>& allocator2)
+{
+    return !(allocator1 == allocator2);
+}
+
+} // namespace sml
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+namespace sml
+{
+
+//! Array view.
+/*!
+ * Non-owning view of a contiguous array of N elements, e.g., a memory-mapped column of a table,
+ * or a sub-range of a std::vector.
+ *
+ * The view provides the element access operator and .size() function, so that it can be passed
+ * to the generic functions in sml that operate on vectors without copying the data. Copying a
+ * view is cheap, since only the pointer and size are copied. The caller must ensure that the data
+ * outlives the view.
+ *
+ * @tparam T  Element type, e.g., const double for a read-only view
+ */
+template <typename T>
+class ArrayView
+{
+public:
+
+    //! Element type.
+    typedef T value_type;
+
+    //! Construct empty view.
+    ArrayView()
+        : pointer(nullptr),
+          length(0)
+    { }
+
+    //! Construct view of array.
+    /*!
+     * @param  somePointer  Pointer to first element of array
+     * @param  someLength   Number of elements N in array
+     */
+    ArrayView(T* somePointer, const std::size_t someLength)
+        : pointer(somePointer),
+          length(someLength)
+    { }
+
+    //! Construct view of contiguous container.
+    /*!
+     * Constructs view of all elements of a contiguous container, e.g., std::vector or std::array.
+     *
+     * @tparam Container  Container type that supports .data() and .size()
+     * @param  container  Container to view
+     */
+    template <typename Container>
+    ArrayView(Container& container)
+        : pointer(container.data()),
+          length(container.size())
+    { }
+
+    //! Access element.
+    /*!
+     * @param  index  Index of element (< N)
+     * @return        Reference to element
+     */
+    T& operator[](const std::size_t index) const
+    {
+        assert(index < length);
+        return pointer[index];
+    }
+
+    //! Get number of elements.
+    /*!
+     * @return  Number of elements N in view
+     */
+    std::size_t size() const { return length; }
+
+    //! Check if view is empty.
+    /*!
+     * @return  True if view has no elements
+     */
+    bool empty() const { return length == 0; }
+
+    //! Get pointer to data.
+    /*!
+     * @return  Pointer to first element
+     */
+    T* data() const { return pointer; }
+
+    //! Get iterator to first element.
+    /*!
+     * @return  Pointer to first element
+     */
+    T* begin() const { return pointer; }
+
+    //! Get iterator past last element.
+    /*!
+     * @return  Pointer past last element
+     */
+    T* end() const { return pointer + length; }
+
+    //! Get view of sub-range.
+    /*!
+     * @param  offset  Index of first element of sub-range
+     * @param  count   Number of elements in sub-range
+     * @return         View of elements [offset, offset + count)
+     */
+    ArrayView subview(const std::size_t offset, const std::size_t count) const
+    {
+        assert(offset + count <= length);
+        return ArrayView(pointer + offset, count);
+    }
+
+private:
+
+    //! Pointer to first element.
+    T* pointer;
+
+    //! Number of elements.
+    std::size_t length;
+};
+
+} // namespace sml
@@ -7,12 +7,47 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 
 #include "sml/constants.hpp"
 
 namespace sml
 {
 
+namespace detail
+{
+
+//! Compute floor of real number at compile time.
+/*!
+ * Computes the largest integer not greater than a real number. Unlike std::floor(), this function
+ * can be used in constant expressions. Numbers smaller in magnitude than 1/epsilon (2^52 for
+ * double) are truncated by converting them to an integer, and corrected if they were rounded up.
+ * Larger numbers, infinities and NaN are returned unchanged, since they are already integers (or
+ * not numbers). The result is identical to std::floor(), including for negative zero.
+ *
+ * @sa computeBranchFreeFloor
+ * @tparam Real   Real type
+ * @param  value  Number to round down
+ * @return        Floor of number
+ */
+template <typename Real>
+constexpr Real computeFloor(const Real value)
+{
+    const Real limit = Real(1) / std::numeric_limits<Real>::epsilon();
+    if (!(value > -limit && value < limit))
+    {
+        return value;
+    }
+    const Real truncated = static_cast<Real>(static_cast<long long>(value));
+    if (truncated == value)
+    {
+        return value;
+    }
+    return truncated > value ? truncated - Real(1) : truncated;
+}
+
+} // namespace detail
+
 //! Compute modulo.
 /*!
  * Computes the remainder of division of one real number by another.
@@ -29,9 +64,9 @@ namespace sml
  * @return           Remainder of division of dividend by divisor
  */
 template <typename Real>
-Real computeModulo(const Real dividend, const Real divisor)
+constexpr Real computeModulo(const Real dividend, const Real divisor)
 {
-    return dividend - divisor * std::floor(dividend / divisor);
+    return dividend - divisor * detail::computeFloor(dividend / divisor);
 }
 
 //! Convert angle in radians to degrees.
@@ -42,14 +77,16 @@ Real computeModulo(const Real dividend, const Real divisor)
  *      \theta_{deg} = \theta_{rad} * \frac{180}{\pi}
  * \f]
  *
+ * The conversion is computed in the precision of the Real type, e.g., float.
+ *
  * @tparam Real            Real type
  * @param  angleInRadians  Angle in radians
  * @return                 Angle in degrees
  */
 template <typename Real>
-Real convertRadiansToDegrees(const Real angleInRadians)
+constexpr Real convertRadiansToDegrees(const Real angleInRadians)
 {
-    return angleInRadians / SML_PI * 180.0;
+    return angleInRadians / pi<Real> * Real(180);
 }
 
 //! Convert angle in degrees to radians.
@@ -60,14 +97,16 @@ Real convertRadiansToDegrees(const Real angleInRadians)
  *      \theta_{rad} = \theta_{deg} * \frac{\pi}{180}
  * \f]
  *
+ * The conversion is computed in the precision of the Real type, e.g., float.
+ *
  * @tparam Real            Real type
  * @param  angleInDegrees  Angle in degrees
  * @return                 Angle in radians
  */
 template <typename Real>
-Real convertDegreesToRadians(const Real angleInDegrees)
+constexpr Real convertDegreesToRadians(const Real angleInDegrees)
 {
-    return angleInDegrees * SML_PI / 180.0;
+    return angleInDegrees * pi<Real> / Real(180);
 }
 
 } // namespace sml
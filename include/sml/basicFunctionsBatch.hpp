@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "sml/basicFunctions.hpp"
+#include "sml/constants.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+
+// Batch counterparts of the functions in basicFunctions.hpp, which process vectors of N numbers
+// with SIMD kernels according to an execution policy. They are kept out of basicFunctions.hpp, so
+// that code that only uses the scalar functions does not depend on the thread pool.
+
+namespace sml
+{
+
+namespace detail
+{
+
+//! Compute floor of real number, without branches.
+/*!
+ * Computes the largest integer not greater than a real number, using only additions, comparisons
+ * and selects, so that loops calling it can be vectorized. GCC only vectorizes std::floor() if
+ * floating-point exceptions are ignored (e.g., -fno-trapping-math), since the SIMD rounding
+ * instructions do not raise the same exceptions.
+ *
+ * Numbers smaller in magnitude than 1/epsilon (2^52 for double) are rounded to an integer by
+ * adding and subtracting 1/epsilon, and corrected if they were rounded up. Larger numbers are
+ * already integers, and are returned unchanged. The result is identical to std::floor(),
+ * including for negative zero, infinities and NaN, but the rounding trick is defeated by compiler
+ * options that allow reassociation of floating-point operations. Hence, std::floor() is used if
+ * -ffast-math is enabled (which also allows the compiler to vectorize it).
+ *
+ * @sa computeFloor
+ * @tparam Real   Real type
+ * @param  value  Number to round down
+ * @return        Floor of number
+ */
+template <typename Real>
+SML_FORCE_INLINE Real computeBranchFreeFloor(const Real value)
+{
+#if defined(__FAST_MATH__)
+    return std::floor(value);
+#else
+    // The selects only choose between constants, and their results are added afterwards, so that
+    // GCC does not turn them into branches, which prevent vectorization.
+    const Real limit = Real(1) / std::numeric_limits<Real>::epsilon();
+    const Real magic = std::fabs(value) < limit ? std::copysign(limit, value) : Real(0);
+    const Real rounded = (value + magic) - magic;
+    const Real correction = rounded > value ? Real(-1) : Real(0);
+    return std::copysign(correction + rounded, value);
+#endif
+}
+
+//! Wrap real number to range [0, divisor) using reciprocal of divisor.
+/*!
+ * Computes the modulo of a real number, multiplying by the reciprocal of the divisor instead of
+ * dividing by the divisor. Since the rounded reciprocal can make the quotient differ from the
+ * exact quotient by one unit in the last place, the floor of the quotient can be off by one for
+ * dividends within a few units in the last place of a multiple of the divisor. Such results are
+ * corrected with (branch-free) selects, so that the result is always in the range [0, divisor).
+ *
+ * @tparam Real            Real type
+ * @param  dividend        Number to be divided
+ * @param  divisor         Number that divides dividend (> 0)
+ * @param  inverseDivisor  Reciprocal of divisor
+ * @return                 Remainder of division of dividend by divisor, in range [0, divisor)
+ */
+template <typename Real>
+SML_FORCE_INLINE Real wrapWithReciprocal(const Real dividend,
+                                         const Real divisor,
+                                         const Real inverseDivisor)
+{
+    // The corrections are selected first and added afterwards, as in computeBranchFreeFloor().
+    const Real remainder = dividend - divisor * computeBranchFreeFloor(dividend * inverseDivisor);
+    const Real raise = remainder < Real(0) ? divisor : Real(0);
+    const Real positiveRemainder = raise + remainder;
+    const Real lower = positiveRemainder >= divisor ? -divisor : Real(0);
+    return lower + positiveRemainder;
+}
+
+//! Kernel computing modulo of batch of real numbers.
+template <typename Real>
+struct ModuloKernel
+{
+    const Real* dividends;
+    Real divisor;
+    Real* results;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            results[i] = dividends[i] - divisor * computeBranchFreeFloor(dividends[i] / divisor);
+        }
+    }
+};
+
+//! Kernel computing modulo of batch of real numbers using reciprocal of divisor.
+template <typename Real>
+struct FastModuloKernel
+{
+    const Real* dividends;
+    Real divisor;
+    Real inverseDivisor;
+    Real* results;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            results[i] = wrapWithReciprocal(dividends[i], divisor, inverseDivisor);
+        }
+    }
+};
+
+//! Kernel converting batch of angles between radians and degrees.
+template <typename Real, bool isRadiansToDegrees>
+struct AngleConversionKernel
+{
+    const Real* angles;
+    Real* results;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            results[i] = isRadiansToDegrees ? convertRadiansToDegrees(angles[i])
+                                            : convertDegreesToRadians(angles[i]);
+        }
+    }
+};
+
+//! Kernel converting batch of angles between radians and degrees, and wrapping to one revolution.
+template <typename Real, bool isRadiansToDegrees>
+struct WrappedAngleConversionKernel
+{
+    const Real* angles;
+    Real revolution;
+    Real inverseRevolution;
+    Real* results;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Real angle = isRadiansToDegrees ? convertRadiansToDegrees(angles[i])
+                                                  : convertDegreesToRadians(angles[i]);
+            results[i] = wrapWithReciprocal(angle, revolution, inverseRevolution);
+        }
+    }
+};
+
+} // namespace detail
+
+//! Compute modulo of batch of real numbers.
+/*!
+ * Computes the remainders of division of a vector of N real numbers by a divisor element-wise,
+ * using the same equation as computeModulo(dividend, divisor). The batch is dispatched at runtime
+ * to the best instruction set supported by the CPU (see getInstructionSet()). Since wider
+ * instruction sets can fuse multiplications and additions, results may differ in the last bit from
+ * the scalar function.
+ *
+ * The results can be written to the vector of dividends, i.e., the modulo can be computed
+ * in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeModulo, computeModuloFast
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result
+ * @param  dividends     A vector of N numbers to be divided
+ * @param  divisor       Number that divides dividends
+ * @param  results       A vector of N remainders (sized by caller)
+ * @param  policy        Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeModulo(const Vector& dividends,
+                   const Real divisor,
+                   ResultVector& results,
+                   const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeModulo", dividends.size());
+    assert(results.size() == dividends.size());
+    const detail::ModuloKernel<Real> kernel = {dividends.data(), divisor, results.data()};
+    detail::executeKernel(kernel, dividends.size(), 2 * sizeof(Real), policy);
+}
+
+//! Compute modulo of batch of real numbers using reciprocal of divisor.
+/*!
+ * Computes the remainders of division of a vector of N real numbers by a fixed divisor
+ * element-wise, e.g., to wrap angles to the range [0, 2pi). The reciprocal of the divisor is
+ * computed once, and the dividends are multiplied by it, which avoids SIMD divisions (these have a
+ * much lower throughput than multiplications on most CPUs, in particular for double).
+ *
+ * The remainders can differ from those computed by computeModulo() for dividends within a few
+ * units in the last place of a multiple of the divisor, since the rounded reciprocal can cause
+ * the floor of the quotient to be off by one. Such remainders are corrected, so that, unlike
+ * computeModulo(), the remainders are guaranteed to be in the range [0, divisor).
+ *
+ * The results can be written to the vector of dividends, i.e., the modulo can be computed
+ * in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeModulo
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result
+ * @param  dividends     A vector of N numbers to be divided
+ * @param  divisor       Number that divides dividends (> 0)
+ * @param  results       A vector of N remainders in range [0, divisor) (sized by caller)
+ * @param  policy        Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeModuloFast(const Vector& dividends,
+                       const Real divisor,
+                       ResultVector& results,
+                       const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeModuloFast", dividends.size());
+    assert(divisor > Real(0));
+    assert(results.size() == dividends.size());
+    const detail::FastModuloKernel<Real> kernel
+        = {dividends.data(), divisor, Real(1) / divisor, results.data()};
+    detail::executeKernel(kernel, dividends.size(), 2 * sizeof(Real), policy);
+}
+
+//! Convert batch of angles in radians to degrees.
+/*!
+ * Converts a vector of N angles in radians to degrees element-wise, using the same equation as
+ * convertRadiansToDegrees(angleInRadians). The results can be written to the vector of angles,
+ * i.e., the conversion can be done in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa convertRadiansToDegrees, convertRadiansToWrappedDegrees
+ * @tparam Real              Real type
+ * @tparam Vector            Vector type
+ * @tparam ResultVector      Vector type of result
+ * @param  anglesInRadians   A vector of N angles in radians
+ * @param  anglesInDegrees   A vector of N angles in degrees (sized by caller)
+ * @param  policy            Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void convertRadiansToDegrees(const Vector& anglesInRadians,
+                             ResultVector& anglesInDegrees,
+                             const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("convertRadiansToDegrees", anglesInRadians.size());
+    assert(anglesInDegrees.size() == anglesInRadians.size());
+    const detail::AngleConversionKernel<Real, true> kernel
+        = {anglesInRadians.data(), anglesInDegrees.data()};
+    detail::executeKernel(kernel, anglesInRadians.size(), 2 * sizeof(Real), policy);
+}
+
+//! Convert batch of angles in degrees to radians.
+/*!
+ * Converts a vector of N angles in degrees to radians element-wise, using the same equation as
+ * convertDegreesToRadians(angleInDegrees). The results can be written to the vector of angles,
+ * i.e., the conversion can be done in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa convertDegreesToRadians, convertDegreesToWrappedRadians
+ * @tparam Real              Real type
+ * @tparam Vector            Vector type
+ * @tparam ResultVector      Vector type of result
+ * @param  anglesInDegrees   A vector of N angles in degrees
+ * @param  anglesInRadians   A vector of N angles in radians (sized by caller)
+ * @param  policy            Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void convertDegreesToRadians(const Vector& anglesInDegrees,
+                             ResultVector& anglesInRadians,
+                             const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("convertDegreesToRadians", anglesInDegrees.size());
+    assert(anglesInRadians.size() == anglesInDegrees.size());
+    const detail::AngleConversionKernel<Real, false> kernel
+        = {anglesInDegrees.data(), anglesInRadians.data()};
+    detail::executeKernel(kernel, anglesInDegrees.size(), 2 * sizeof(Real), policy);
+}
+
+//! Convert batch of angles in radians to degrees, wrapped to [0, 360).
+/*!
+ * Converts a vector of N angles in radians to degrees and wraps them to the range [0, 360)
+ * element-wise, in a single pass over memory. The result is equivalent to wrapping the angles to
+ * the range [0, 2pi) and converting them to degrees, but the wrap is done after the conversion,
+ * since 360 is exactly representable, whereas 2pi is not.
+ *
+ * The wrap uses the reciprocal of 360, with the same precision trade-off as computeModuloFast():
+ * angles within a few units in the last place of a multiple of 360 degrees can be wrapped to 0
+ * instead of just below 360 (or vice versa), but results are guaranteed to be in [0, 360).
+ *
+ * The results can be written to the vector of angles, i.e., the conversion can be done in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa convertRadiansToDegrees, computeModuloFast
+ * @tparam Real              Real type
+ * @tparam Vector            Vector type
+ * @tparam ResultVector      Vector type of result
+ * @param  anglesInRadians   A vector of N angles in radians
+ * @param  anglesInDegrees   A vector of N angles in degrees in range [0, 360) (sized by caller)
+ * @param  policy            Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void convertRadiansToWrappedDegrees(const Vector& anglesInRadians,
+                                    ResultVector& anglesInDegrees,
+                                    const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("convertRadiansToWrappedDegrees", anglesInRadians.size());
+    assert(anglesInDegrees.size() == anglesInRadians.size());
+    const detail::WrappedAngleConversionKernel<Real, true> kernel
+        = {anglesInRadians.data(), Real(360), Real(1) / Real(360), anglesInDegrees.data()};
+    detail::executeKernel(kernel, anglesInRadians.size(), 2 * sizeof(Real), policy);
+}
+
+//! Convert batch of angles in degrees to radians, wrapped to [0, 2pi).
+/*!
+ * Converts a vector of N angles in degrees to radians and wraps them to the range [0, 2pi)
+ * element-wise, in a single pass over memory, where 2pi is rounded to the Real type.
+ *
+ * The wrap uses the reciprocal of 2pi, with the same precision trade-off as computeModuloFast():
+ * angles within a few units in the last place of a multiple of 2pi can be wrapped to 0 instead of
+ * just below 2pi (or vice versa), but results are guaranteed to be in [0, 2pi).
+ *
+ * The results can be written to the vector of angles, i.e., the conversion can be done in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa convertDegreesToRadians, computeModuloFast
+ * @tparam Real              Real type
+ * @tparam Vector            Vector type
+ * @tparam ResultVector      Vector type of result
+ * @param  anglesInDegrees   A vector of N angles in degrees
+ * @param  anglesInRadians   A vector of N angles in radians in range [0, 2pi) (sized by caller)
+ * @param  policy            Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void convertDegreesToWrappedRadians(const Vector& anglesInDegrees,
+                                    ResultVector& anglesInRadians,
+                                    const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("convertDegreesToWrappedRadians", anglesInDegrees.size());
+    assert(anglesInRadians.size() == anglesInDegrees.size());
+    const Real revolution = twoPi<Real>;
+    const detail::WrappedAngleConversionKernel<Real, false> kernel
+        = {anglesInDegrees.data(), revolution, Real(1) / revolution, anglesInRadians.data()};
+    detail::executeKernel(kernel, anglesInDegrees.size(), 2 * sizeof(Real), policy);
+}
+
+} // namespace sml
@@ -0,0 +1,652 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "sml/arrayView.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+
+namespace sml
+{
+
+//! Evaluate Chebyshev series.
+/*!
+ * Evaluates a Chebyshev series of order N-1, as given by:
+ *
+ * \f[
+ *      f(t) = \sum_{k=0}^{N-1} c_{k} T_{k}(t)
+ * \f]
+ *
+ * where \f$T_{k}\f$ is the Chebyshev polynomial of the first kind of degree k, using Clenshaw's
+ * recurrence. The series is defined on the normalized interval \f$-1 \leq t \leq 1\f$; t-values
+ * outside of this interval extrapolate the series. The evaluation costs O(N) operations.
+ *
+ * See Press et al. (2007), Numerical Recipes, section 5.8 for more background information.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa fitChebyshevSeries, ChebyshevSeries
+ * @tparam Real          Floating-point type
+ * @tparam Vector        Vector type
+ * @param  coefficients  A vector of N >= 1 Chebyshev coefficients, in order of ascending degree
+ * @param  t             Normalized t-value to evaluate series at
+ * @return               Value of series
+ */
+template <typename Real, typename Vector>
+Real evaluateChebyshevSeries(const Vector& coefficients, const Real t)
+{
+    assert(coefficients.size() > 0);
+    const Real twoT = 2 * t;
+    Real b1 = 0;
+    Real b2 = 0;
+    for (std::size_t k = coefficients.size() - 1; k > 0; k--)
+    {
+        const Real b0 = coefficients[k] + twoT * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return coefficients[0] + t * b1 - b2;
+}
+
+//! Evaluate Chebyshev series and its derivative.
+/*!
+ * Evaluates a Chebyshev series of order N-1 and its derivative with respect to t in the same
+ * pass. The derivative is obtained by differentiating Clenshaw's recurrence:
+ *
+ * \f[
+ *      b_{k}' = 2 b_{k+1} + 2 t b_{k+1}' - b_{k+2}'
+ * \f]
+ *
+ * which runs alongside the recurrence for the value, so that the derivative costs only a few
+ * additional operations per coefficient, and no separate set of derivative coefficients is needed.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa evaluateChebyshevSeries
+ * @tparam Real          Floating-point type
+ * @tparam Vector        Vector type
+ * @param  coefficients  A vector of N >= 1 Chebyshev coefficients, in order of ascending degree
+ * @param  t             Normalized t-value to evaluate series at
+ * @param  derivative    Derivative of series with respect to t
+ * @return               Value of series
+ */
+template <typename Real, typename Vector>
+Real evaluateChebyshevSeries(const Vector& coefficients, const Real t, Real& derivative)
+{
+    assert(coefficients.size() > 0);
+    const Real twoT = 2 * t;
+    Real b1 = 0;
+    Real b2 = 0;
+    Real d1 = 0;
+    Real d2 = 0;
+    for (std::size_t k = coefficients.size() - 1; k > 0; k--)
+    {
+        const Real d0 = 2 * b1 + twoT * d1 - d2;
+        const Real b0 = coefficients[k] + twoT * b1 - b2;
+        d2 = d1;
+        d1 = d0;
+        b2 = b1;
+        b1 = b0;
+    }
+    derivative = b1 + t * d1 - d2;
+    return coefficients[0] + t * b1 - b2;
+}
+
+//! Fit Chebyshev series to sampled data.
+/*!
+ * Computes the coefficients of the Chebyshev series of given order that fits a set of M samples
+ * (t,y) in the least-squares sense. The t-values must be normalized to the interval
+ * \f$-1 \leq t \leq 1\f$. If M is equal to the number of coefficients, the series interpolates
+ * the samples. Sampling at the Chebyshev nodes, \f$t_{i} = \cos(\pi (i + 1/2) / M)\f$, yields the
+ * best approximation for a given number of samples.
+ *
+ * The least-squares problem is solved using Householder QR decomposition of the M x (order+1)
+ * matrix of Chebyshev polynomials evaluated at the t-values, which costs O(M order^2) operations.
+ *
+ * Throws std::invalid_argument if there are fewer samples than coefficients, or if the samples
+ * have fewer distinct t-values than coefficients.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa evaluateChebyshevSeries, ChebyshevSeries
+ * @tparam Real    Floating-point type
+ * @tparam Vector  Vector type
+ * @param  tData   A vector of M normalized t-values
+ * @param  yData   A vector of M y-values
+ * @param  order   Order (highest degree) of Chebyshev series
+ * @return         Vector of order+1 Chebyshev coefficients, in order of ascending degree
+ */
+template <typename Real, typename Vector>
+std::vector<Real> fitChebyshevSeries(const Vector& tData,
+                                     const Vector& yData,
+                                     const std::size_t order)
+{
+    SML_PROFILE("fitChebyshevSeries", tData.size());
+    assert(tData.size() == yData.size());
+    const std::size_t rowCount = tData.size();
+    const std::size_t columnCount = order + 1;
+    if (rowCount < columnCount)
+    {
+        throw std::invalid_argument("Chebyshev series fit requires at least order + 1 samples");
+    }
+
+    // Matrix of Chebyshev polynomials, stored column by column.
+    std::vector<Real> matrix(rowCount * columnCount);
+    std::vector<Real> rightHandSide(rowCount);
+    for (std::size_t i = 0; i < rowCount; i++)
+    {
+        const Real t = tData[i];
+        matrix[i] = 1;
+        if (columnCount > 1)
+        {
+            matrix[rowCount + i] = t;
+        }
+        for (std::size_t k = 2; k < columnCount; k++)
+        {
+            matrix[k * rowCount + i]
+                = 2 * t * matrix[(k - 1) * rowCount + i] - matrix[(k - 2) * rowCount + i];
+        }
+        rightHandSide[i] = yData[i];
+    }
+
+    // Householder QR decomposition, applying the reflections to the right-hand side on the fly.
+    std::vector<Real> diagonal(columnCount);
+    for (std::size_t j = 0; j < columnCount; j++)
+    {
+        Real* column = matrix.data() + j * rowCount;
+        Real norm = 0;
+        for (std::size_t i = j; i < rowCount; i++)
+        {
+            norm += column[i] * column[i];
+        }
+        norm = std::sqrt(norm);
+
+        // The Chebyshev polynomials are bounded by 1, so a column whose remaining norm is of the
+        // order of the rounding error is linearly dependent on the preceding columns.
+        if (!(norm > std::numeric_limits<Real>::epsilon() * static_cast<Real>(rowCount)))
+        {
+            throw std::invalid_argument(
+                "Chebyshev series fit requires at least order + 1 distinct samples");
+        }
+        const Real pivot = column[j];
+        const Real alpha = pivot > 0 ? -norm : norm;
+        column[j] = pivot - alpha;
+        const Real scale = 1 / (norm * (norm + std::fabs(pivot)));
+        for (std::size_t l = j + 1; l <= columnCount; l++)
+        {
+            Real* target = l < columnCount ? matrix.data() + l * rowCount : rightHandSide.data();
+            Real product = 0;
+            for (std::size_t i = j; i < rowCount; i++)
+            {
+                product += column[i] * target[i];
+            }
+            product *= scale;
+            for (std::size_t i = j; i < rowCount; i++)
+            {
+                target[i] -= product * column[i];
+            }
+        }
+        diagonal[j] = alpha;
+    }
+
+    // Back-substitution with upper-triangular factor.
+    std::vector<Real> coefficients(columnCount);
+    for (std::size_t j = columnCount; j-- > 0;)
+    {
+        Real sum = rightHandSide[j];
+        for (std::size_t l = j + 1; l < columnCount; l++)
+        {
+            sum -= matrix[l * rowCount + j] * coefficients[l];
+        }
+        coefficients[j] = sum / diagonal[j];
+    }
+    return coefficients;
+}
+
+namespace detail
+{
+
+//! Number of queries processed per block in batch Chebyshev series kernels.
+const std::size_t chebyshevQueryBlockSize = 32;
+
+//! Evaluate piecewise Chebyshev series for batch of queries.
+/*!
+ * Kernel for ChebyshevSeries::evaluate() that operates on contiguous arrays.
+ *
+ * The queries are processed in blocks of fixed size. For each block, the segments and normalized
+ * t-values are computed first, after which Clenshaw's recurrence is run for all queries in the
+ * block at once, one coefficient degree at a time. The inner loops run over the queries in the
+ * block, have a fixed trip count and no loop-carried dependencies, so that they are vectorized by
+ * the compiler. For sorted queries, the queries in a block mostly share the same coefficient
+ * block, which then stays in cache.
+ *
+ * The queries and values can be the same array (in-place evaluation).
+ *
+ * @tparam Real              Floating-point type
+ * @tparam hasDerivatives    Flag indicating if derivatives are computed
+ * @param  coefficients      Array of S blocks of N coefficients, one block per segment
+ * @param  segmentCount      Number of segments S
+ * @param  coefficientCount  Number of coefficients N per segment
+ * @param  start             Start of first segment
+ * @param  segmentLength     Length of segments
+ * @param  queries           Array of Q x-values to evaluate at
+ * @param  queryCount        Number of queries Q
+ * @param  values            Array of Q values
+ * @param  derivatives       Array of Q derivatives with respect to x (unused if !hasDerivatives)
+ */
+template <typename Real, bool hasDerivatives>
+void evaluateChebyshevSeriesKernel(const Real* SML_RESTRICT coefficients,
+                                   const std::size_t segmentCount,
+                                   const std::size_t coefficientCount,
+                                   const Real start,
+                                   const Real segmentLength,
+                                   const Real* queries,
+                                   const std::size_t queryCount,
+                                   Real* values,
+                                   Real* derivatives)
+{
+    const std::size_t blockSize = chebyshevQueryBlockSize;
+    const Real inverseLength = 1 / segmentLength;
+    const Real inverseHalfLength = 2 / segmentLength;
+    const Real lastSegment = static_cast<Real>(segmentCount - 1);
+
+    std::size_t offsets[blockSize];
+    Real ts[blockSize];
+    Real b1[blockSize];
+    Real b2[blockSize];
+    Real d1[blockSize];
+    Real d2[blockSize];
+
+    for (std::size_t queryStart = 0; queryStart < queryCount; queryStart += blockSize)
+    {
+        // Pad last block by repeating last query, so that all blocks have the same size.
+        const std::size_t count
+            = queryCount - queryStart < blockSize ? queryCount - queryStart : blockSize;
+        for (std::size_t q = 0; q < blockSize; q++)
+        {
+            const Real x = queries[queryStart + (q < count ? q : count - 1)];
+            Real segment = std::floor((x - start) * inverseLength);
+            segment = segment > 0 ? segment : Real(0);
+            segment = segment < lastSegment ? segment : lastSegment;
+            offsets[q] = static_cast<std::size_t>(segment) * coefficientCount;
+            ts[q] = (x - (start + (segment + Real(0.5)) * segmentLength)) * inverseHalfLength;
+            b1[q] = 0;
+            b2[q] = 0;
+            d1[q] = 0;
+            d2[q] = 0;
+        }
+
+        for (std::size_t k = coefficientCount - 1; k > 0; k--)
+        {
+            SML_SIMD_LOOP
+            for (std::size_t q = 0; q < blockSize; q++)
+            {
+                const Real twoT = 2 * ts[q];
+                if (hasDerivatives)
+                {
+                    const Real d0 = 2 * b1[q] + twoT * d1[q] - d2[q];
+                    d2[q] = d1[q];
+                    d1[q] = d0;
+                }
+                const Real b0 = coefficients[offsets[q] + k] + twoT * b1[q] - b2[q];
+                b2[q] = b1[q];
+                b1[q] = b0;
+            }
+        }
+
+        for (std::size_t q = 0; q < count; q++)
+        {
+            values[queryStart + q] = coefficients[offsets[q]] + ts[q] * b1[q] - b2[q];
+            if (hasDerivatives)
+            {
+                derivatives[queryStart + q] = (b1[q] + ts[q] * d1[q] - d2[q]) * inverseHalfLength;
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+//! Piecewise Chebyshev series.
+/*!
+ * Piecewise Chebyshev approximation of a smooth function, e.g., an ephemeris, as used in the JPL
+ * planetary ephemerides. The x-range is divided into S segments of equal length, and the function
+ * is approximated on each segment by a Chebyshev series of fixed order in the normalized variable:
+ *
+ * \f[
+ *      t = \frac{2 (x - x_{mid})}{L}
+ * \f]
+ *
+ * where \f$x_{mid}\f$ is the midpoint of the segment and L is the segment length. Since the
+ * segments have equal length, the segment that contains an x-value is found in O(1) operations,
+ * and each query costs O(order) operations, independent of the number of segments. x-values
+ * outside of the x-range are extrapolated using the first or last segment.
+ *
+ * The coefficients of all segments are stored in one contiguous vector, with the order+1
+ * coefficients of each segment in a contiguous block (in order of ascending degree), so that a
+ * query touches a single block of memory, and ascending queries stream through the blocks.
+ *
+ * The series can be fitted to sampled data, or constructed from precomputed coefficients, e.g.,
+ * read from an ephemeris file.
+ *
+ * @sa fitChebyshevSeries, evaluateChebyshevSeries
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+class ChebyshevSeries
+{
+public:
+
+    //! Construct series by fitting sampled data.
+    /*!
+     * Constructs piecewise Chebyshev series by fitting the samples in each segment in the
+     * least-squares sense, using fitChebyshevSeries(). The x-range spans the first to the last
+     * x-value. Samples that lie on the boundary between two segments are used for both segments,
+     * which improves the continuity of the approximation at the boundaries.
+     *
+     * Throws std::invalid_argument if the x- and y-data differ in length, if the x-values are not
+     * strictly ascending, if the number of segments is zero, or if a segment contains fewer than
+     * order+1 samples.
+     *
+     * @param  xData              A vector of strictly ascending x-values
+     * @param  yData              A vector of y-values
+     * @param  someSegmentCount   Number of segments S
+     * @param  someOrder          Order (highest degree) of Chebyshev series per segment
+     */
+    ChebyshevSeries(const std::vector<Real>& xData,
+                    const std::vector<Real>& yData,
+                    const std::size_t someSegmentCount,
+                    const std::size_t someOrder)
+        : start(0),
+          segmentLength(0),
+          segmentCount(someSegmentCount),
+          order(someOrder),
+          coefficients()
+    {
+        if (xData.size() != yData.size() || xData.size() < 2)
+        {
+            throw std::invalid_argument(
+                "Chebyshev series data must have equal length and at least 2 samples");
+        }
+        for (std::size_t i = 1; i < xData.size(); i++)
+        {
+            if (!(xData[i - 1] < xData[i]))
+            {
+                throw std::invalid_argument("Chebyshev series x-values must be strictly ascending");
+            }
+        }
+        if (segmentCount == 0)
+        {
+            throw std::invalid_argument("Chebyshev series must have at least 1 segment");
+        }
+
+        start = xData.front();
+        segmentLength = (xData.back() - start) / static_cast<Real>(segmentCount);
+        coefficients.resize(segmentCount * (order + 1));
+
+        std::vector<Real> tData;
+        std::vector<Real> segmentYData;
+        std::size_t first = 0;
+        for (std::size_t s = 0; s < segmentCount; s++)
+        {
+            const Real lower = start + static_cast<Real>(s) * segmentLength;
+            const Real upper = s + 1 < segmentCount
+                               ? start + static_cast<Real>(s + 1) * segmentLength : xData.back();
+            const Real midpoint = start + (static_cast<Real>(s) + Real(0.5)) * segmentLength;
+            const Real inverseHalfLength = 2 / segmentLength;
+
+            while (first < xData.size() && xData[first] < lower)
+            {
+                first++;
+            }
+            tData.clear();
+            segmentYData.clear();
+            for (std::size_t i = first; i < xData.size() && xData[i] <= upper; i++)
+            {
+                tData.push_back((xData[i] - midpoint) * inverseHalfLength);
+                segmentYData.push_back(yData[i]);
+            }
+            if (tData.size() < order + 1)
+            {
+                throw std::invalid_argument(
+                    "Chebyshev series segment must contain at least order + 1 samples");
+            }
+
+            const std::vector<Real> segmentCoefficients
+                = fitChebyshevSeries<Real>(tData, segmentYData, order);
+            std::copy(segmentCoefficients.begin(),
+                      segmentCoefficients.end(),
+                      coefficients.begin() + s * (order + 1));
+        }
+    }
+
+    //! Construct series from precomputed coefficients.
+    /*!
+     * Constructs piecewise Chebyshev series from S contiguous blocks of order+1 coefficients, one
+     * block per segment, in order of ascending degree.
+     *
+     * @param  someStart          Start of first segment
+     * @param  someSegmentLength  Length of segments (> 0)
+     * @param  someOrder          Order (highest degree) of Chebyshev series per segment
+     * @param  someCoefficients   A vector of S (order+1) Chebyshev coefficients
+     */
+    ChebyshevSeries(const Real someStart,
+                    const Real someSegmentLength,
+                    const std::size_t someOrder,
+                    const std::vector<Real>& someCoefficients)
+        : start(someStart),
+          segmentLength(someSegmentLength),
+          segmentCount(someCoefficients.size() / (someOrder + 1)),
+          order(someOrder),
+          coefficients(someCoefficients)
+    {
+        assert(segmentLength > 0);
+        assert(segmentCount > 0 && coefficients.size() == segmentCount * (order + 1));
+    }
+
+    //! Evaluate series at specified x-value.
+    /*!
+     * @param  x  x-value to evaluate at
+     * @return    Value of series
+     */
+    Real evaluate(const Real x) const
+    {
+        SML_PROFILE("ChebyshevSeries::evaluate", order + 1);
+        Real t = 0;
+        const Real* block = getBlock(x, t);
+        return evaluateChebyshevSeries(ArrayView<const Real>(block, order + 1), t);
+    }
+
+    //! Evaluate series and its derivative at specified x-value.
+    /*!
+     * Computes the value and the derivative with respect to x in the same pass.
+     *
+     * @param  x           x-value to evaluate at
+     * @param  derivative  Derivative of series with respect to x
+     * @return             Value of series
+     */
+    Real evaluate(const Real x, Real& derivative) const
+    {
+        SML_PROFILE("ChebyshevSeries::evaluate", order + 1);
+        Real t = 0;
+        const Real* block = getBlock(x, t);
+        const Real value
+            = evaluateChebyshevSeries(ArrayView<const Real>(block, order + 1), t, derivative);
+        derivative *= 2 / segmentLength;
+        return value;
+    }
+
+    //! Evaluate series at batch of x-values.
+    /*!
+     * Computes values at a batch of Q x-values in one pass. Sorted queries are the most efficient,
+     * since successive queries then share coefficient blocks.
+     *
+     * @sa detail::evaluateChebyshevSeriesKernel
+     * @param  queries  A vector of Q x-values to evaluate at
+     * @param  values   A vector of Q values (resized if necessary)
+     * @param  policy   Execution policy
+     */
+    void evaluate(const std::vector<Real>& queries,
+                  std::vector<Real>& values,
+                  const ExecutionPolicy& policy = ExecutionPolicy()) const
+    {
+        SML_PROFILE("ChebyshevSeries::evaluate(batch)", queries.size());
+        values.resize(queries.size());
+        detail::executeInChunks([&](const std::size_t begin, const std::size_t end)
+        {
+            detail::evaluateChebyshevSeriesKernel<Real, false>(coefficients.data(),
+                                                               segmentCount,
+                                                               order + 1,
+                                                               start,
+                                                               segmentLength,
+                                                               queries.data() + begin,
+                                                               end - begin,
+                                                               values.data() + begin,
+                                                               nullptr);
+        }, queries.size(), (order + 3) * sizeof(Real), policy);
+    }
+
+    //! Evaluate series and its derivative at batch of x-values.
+    /*!
+     * Computes values and derivatives with respect to x at a batch of Q x-values in one pass.
+     *
+     * @sa detail::evaluateChebyshevSeriesKernel
+     * @param  queries      A vector of Q x-values to evaluate at
+     * @param  values       A vector of Q values (resized if necessary)
+     * @param  derivatives  A vector of Q derivatives with respect to x (resized if necessary)
+     * @param  policy       Execution policy
+     */
+    void evaluate(const std::vector<Real>& queries,
+                  std::vector<Real>& values,
+                  std::vector<Real>& derivatives,
+                  const ExecutionPolicy& policy = ExecutionPolicy()) const
+    {
+        SML_PROFILE("ChebyshevSeries::evaluate(batch)", queries.size());
+        values.resize(queries.size());
+        derivatives.resize(queries.size());
+        detail::executeInChunks([&](const std::size_t begin, const std::size_t end)
+        {
+            detail::evaluateChebyshevSeriesKernel<Real, true>(coefficients.data(),
+                                                              segmentCount,
+                                                              order + 1,
+                                                              start,
+                                                              segmentLength,
+                                                              queries.data() + begin,
+                                                              end - begin,
+                                                              values.data() + begin,
+                                                              derivatives.data() + begin);
+        }, queries.size(), (order + 4) * sizeof(Real), policy);
+    }
+
+    //! Evaluate series at specified x-value.
+    /*!
+     * @sa evaluate
+     * @param  x  x-value to evaluate at
+     * @return    Value of series
+     */
+    Real operator()(const Real x) const
+    {
+        return evaluate(x);
+    }
+
+    //! Get start of first segment.
+    /*!
+     * @return  Start of first segment
+     */
+    Real getStart() const { return start; }
+
+    //! Get segment length.
+    /*!
+     * @return  Length of segments
+     */
+    Real getSegmentLength() const { return segmentLength; }
+
+    //! Get number of segments.
+    /*!
+     * @return  Number of segments
+     */
+    std::size_t getSegmentCount() const { return segmentCount; }
+
+    //! Get order of series.
+    /*!
+     * @return  Order (highest degree) of Chebyshev series per segment
+     */
+    std::size_t getOrder() const { return order; }
+
+    //! Get coefficients.
+    /*!
+     * @return  Vector of contiguous blocks of order+1 Chebyshev coefficients, one per segment
+     */
+    const std::vector<Real>& getCoefficients() const { return coefficients; }
+
+private:
+
+    //! Get coefficient block and normalized t-value for specified x-value.
+    /*!
+     * @param  x  x-value
+     * @param  t  Normalized t-value in segment that contains x-value (clamped to first or last)
+     * @return    Pointer to coefficient block of segment
+     */
+    const Real* getBlock(const Real x, Real& t) const
+    {
+        Real segment = std::floor((x - start) / segmentLength);
+        segment = segment > 0 ? segment : Real(0);
+        segment = segment < static_cast<Real>(segmentCount - 1)
+                  ? segment : static_cast<Real>(segmentCount - 1);
+        t = (x - (start + (segment + Real(0.5)) * segmentLength)) * (2 / segmentLength);
+        return coefficients.data() + static_cast<std::size_t>(segment) * (order + 1);
+    }
+
+    //! Start of first segment.
+    Real start;
+
+    //! Length of segments.
+    Real segmentLength;
+
+    //! Number of segments.
+    std::size_t segmentCount;
+
+    //! Order (highest degree) of Chebyshev series per segment.
+    std::size_t order;
+
+    //! Contiguous blocks of order+1 Chebyshev coefficients, one per segment.
+    std::vector<Real> coefficients;
+};
+
+//! Explicitly instantiate Chebyshev series for given Real type.
+#define SML_INSTANTIATE_CHEBYSHEV_SERIES(qualifier, Real) \
+    qualifier template Real evaluateChebyshevSeries<Real, std::vector<Real> >( \
+        const std::vector<Real>&, const Real); \
+    qualifier template std::vector<Real> fitChebyshevSeries<Real, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, const std::size_t); \
+    qualifier template class ChebyshevSeries<Real>;
+
+//! Explicitly instantiate Chebyshev series for common types (see sml_compiled).
+#define SML_INSTANTIATE_CHEBYSHEV_SERIES_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_CHEBYSHEV_SERIES(qualifier, double) \
+    SML_INSTANTIATE_CHEBYSHEV_SERIES(qualifier, float)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_CHEBYSHEV_SERIES_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
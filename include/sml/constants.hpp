@@ -9,7 +9,35 @@
 namespace sml
 {
 
+// Mathematical constants are defined as variable templates, so that they can be used at compile
+// time and are rounded once, directly to the precision of the Real type, e.g., pi<float>, instead
+// of being computed in double and converted.
+
+//! \f$\pi\f$ to 20 decimal places, rounded to Real type.
+template <typename Real>
+constexpr Real pi = static_cast<Real>(3.14159265358979323846L);
+
+//! \f$2\pi\f$ (one revolution in radians) to 20 decimal places, rounded to Real type.
+template <typename Real>
+constexpr Real twoPi = static_cast<Real>(6.28318530717958647693L);
+
+//! \f$\pi/2\f$ to 20 decimal places, rounded to Real type.
+template <typename Real>
+constexpr Real halfPi = static_cast<Real>(1.57079632679489661923L);
+
+//! Number of degrees per radian, \f$180/\pi\f$, to 20 significant digits, rounded to Real type.
+template <typename Real>
+constexpr Real degreesPerRadian = static_cast<Real>(57.295779513082320877L);
+
+//! Number of radians per degree, \f$\pi/180\f$, to 20 significant digits, rounded to Real type.
+template <typename Real>
+constexpr Real radiansPerDegree = static_cast<Real>(0.017453292519943295769L);
+
 //! \f$\pi\f$ to 20 decimal places.
-static const double SML_PI = 3.14159265358979323846;
+/*!
+ * Equal to pi<double>. Since it is a compile-time constant, no storage is allocated for it,
+ * unless its address is taken.
+ */
+constexpr double SML_PI = pi<double>;
 
 } // namespace sml
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "sml/arrayView.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+#include "sml/tableSearch.hpp"
+
+namespace sml
+{
+
+//! Boundary conditions of cubic splines.
+enum class SplineBoundary
+{
+    natural,    //!< Zero second derivative at both ends
+    clamped,    //!< Prescribed first derivative at both ends
+    notAKnot    //!< Continuous third derivative at second and second-to-last x-values
+};
+
+namespace detail
+{
+
+//! Number of queries processed per block in batch cubic spline kernels.
+const std::size_t splineQueryBlockSize = 32;
+
+//! Evaluate cubic spline for batch of queries.
+/*!
+ * Kernel for CubicSpline::interpolate() that operates on contiguous arrays.
+ *
+ * The queries are processed in blocks of fixed size. For each block, the bracketing intervals are
+ * found first by hunting from the interval of the previous query, so that sorted queries stream
+ * through the table in one pass. The cubic polynomials are then evaluated for all queries in the
+ * block at once, in a loop without branches that is vectorized by the compiler.
+ *
+ * The queries and results can be the same array (in-place evaluation).
+ *
+ * @tparam Real          Floating-point type
+ * @param  xData         Array of N strictly ascending x-values
+ * @param  xCount        Number of x-values N
+ * @param  coefficients  Array of N-1 blocks of 4 polynomial coefficients, one block per interval
+ * @param  queries       Array of Q x-values to interpolate at
+ * @param  queryCount    Number of queries Q
+ * @param  results       Array of Q interpolated y-values
+ */
+template <typename Real>
+void interpolateCubicSplineKernel(const Real* SML_RESTRICT xData,
+                                  const std::size_t xCount,
+                                  const Real* SML_RESTRICT coefficients,
+                                  const Real* queries,
+                                  const std::size_t queryCount,
+                                  Real* results)
+{
+    const std::size_t blockSize = splineQueryBlockSize;
+    const ArrayView<const Real> table(xData, xCount);
+
+    std::size_t intervals[blockSize];
+    std::size_t cursor = 0;
+    for (std::size_t queryStart = 0; queryStart < queryCount; queryStart += blockSize)
+    {
+        const std::size_t count
+            = queryCount - queryStart < blockSize ? queryCount - queryStart : blockSize;
+        for (std::size_t q = 0; q < count; q++)
+        {
+            cursor = huntInterval(table, queries[queryStart + q], cursor);
+            intervals[q] = cursor;
+        }
+
+        SML_SIMD_LOOP
+        for (std::size_t q = 0; q < count; q++)
+        {
+            const std::size_t interval = intervals[q];
+            const Real* block = coefficients + 4 * interval;
+            const Real t = queries[queryStart + q] - xData[interval];
+            results[queryStart + q] = block[0] + t * (block[1] + t * (block[2] + t * block[3]));
+        }
+    }
+}
+
+} // namespace detail
+
+//! Cubic spline interpolator.
+/*!
+ * Cubic spline interpolator for tables of (x,y) values with strictly ascending x-values. On each
+ * interval \f$[x_{i}, x_{i+1}]\f$, the function is approximated by a cubic polynomial:
+ *
+ * \f[
+ *      s_{i}(x) = a_{i} + b_{i} t + c_{i} t^{2} + d_{i} t^{3}, \qquad t = x - x_{i}
+ * \f]
+ *
+ * such that the spline and its first and second derivatives are continuous. Unlike a global
+ * interpolating polynomial, the spline does not oscillate for large N. The two remaining degrees
+ * of freedom are fixed by the boundary conditions (natural, clamped or not-a-knot).
+ *
+ * The spline is constructed by solving a tridiagonal system of equations for the second
+ * derivatives at the x-values, which costs O(N) operations. The coefficients
+ * \f$(a_{i}, b_{i}, c_{i}, d_{i})\f$ of each interval are stored in a contiguous block. Each query
+ * costs O(log N) operations to find the bracketing interval using binary search, or O(1)
+ * operations when hunting from a cursor for successive queries that are close together. x-values
+ * outside of the table are extrapolated using the polynomial of the first or last interval.
+ *
+ * See Press et al. (2007), Numerical Recipes, section 3.3 for more background information.
+ *
+ * @sa findInterval, huntInterval, SplineBoundary
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+class CubicSpline
+{
+public:
+
+    //! Construct spline from x- and y-data.
+    /*!
+     * Constructs cubic spline from two equal-length vectors of x- and y-values. For not-a-knot
+     * splines through 3 points, the spline reduces to the interpolating parabola, and for any
+     * natural or not-a-knot spline through 2 points, to a straight line.
+     *
+     * Throws std::invalid_argument if the x- and y-data differ in length, if there are fewer than
+     * 2 x-values, or if the x-values are not strictly ascending.
+     *
+     * @param  someXData   A vector of N strictly ascending x-values
+     * @param  yData       A vector of N y-values
+     * @param  boundary    Boundary conditions
+     * @param  startSlope  Derivative at first x-value (clamped splines only)
+     * @param  endSlope    Derivative at last x-value (clamped splines only)
+     */
+    CubicSpline(const std::vector<Real>& someXData,
+                const std::vector<Real>& yData,
+                const SplineBoundary boundary = SplineBoundary::natural,
+                const Real startSlope = 0,
+                const Real endSlope = 0)
+        : xData(someXData),
+          coefficients()
+    {
+        const std::size_t n = xData.size();
+        if (n != yData.size() || n < 2)
+        {
+            throw std::invalid_argument(
+                "Cubic spline data must have equal length and at least 2 values");
+        }
+        for (std::size_t i = 1; i < n; i++)
+        {
+            if (!(xData[i - 1] < xData[i]))
+            {
+                throw std::invalid_argument("Cubic spline x-values must be strictly ascending");
+            }
+        }
+
+        std::vector<Real> steps(n - 1);
+        std::vector<Real> slopes(n - 1);
+        for (std::size_t i = 0; i + 1 < n; i++)
+        {
+            steps[i] = xData[i + 1] - xData[i];
+            slopes[i] = (yData[i + 1] - yData[i]) / steps[i];
+        }
+
+        // Tridiagonal system for second derivatives: lower[i] M[i-1] + diagonal[i] M[i]
+        // + upper[i] M[i+1] = moments[i], which is overwritten by the solution.
+        std::vector<Real> lower(n, Real(0));
+        std::vector<Real> diagonal(n, Real(1));
+        std::vector<Real> upper(n, Real(0));
+        std::vector<Real> moments(n, Real(0));
+        for (std::size_t i = 1; i + 1 < n; i++)
+        {
+            lower[i] = steps[i - 1];
+            diagonal[i] = 2 * (steps[i - 1] + steps[i]);
+            upper[i] = steps[i];
+            moments[i] = 6 * (slopes[i] - slopes[i - 1]);
+        }
+
+        const bool isNotAKnot = boundary == SplineBoundary::notAKnot && n >= 4;
+        if (boundary == SplineBoundary::clamped)
+        {
+            diagonal[0] = 2 * steps[0];
+            upper[0] = steps[0];
+            moments[0] = 6 * (slopes[0] - startSlope);
+            lower[n - 1] = steps[n - 2];
+            diagonal[n - 1] = 2 * steps[n - 2];
+            moments[n - 1] = 6 * (endSlope - slopes[n - 2]);
+        }
+        else if (isNotAKnot)
+        {
+            // Eliminate first and last second derivative from adjacent rows, using the equality
+            // of the third derivatives across the second and second-to-last x-values.
+            const Real h0 = steps[0];
+            const Real h1 = steps[1];
+            lower[1] = 0;
+            diagonal[1] = (h0 + h1) * (h0 + 2 * h1) / h1;
+            upper[1] = (h1 * h1 - h0 * h0) / h1;
+
+            const Real hA = steps[n - 3];
+            const Real hB = steps[n - 2];
+            lower[n - 2] = (hA * hA - hB * hB) / hA;
+            diagonal[n - 2] = (hA + hB) * (2 * hA + hB) / hA;
+            upper[n - 2] = 0;
+        }
+
+        // Thomas algorithm (forward elimination and back-substitution).
+        for (std::size_t i = 1; i < n; i++)
+        {
+            const Real factor = lower[i] / diagonal[i - 1];
+            diagonal[i] -= factor * upper[i - 1];
+            moments[i] -= factor * moments[i - 1];
+        }
+        moments[n - 1] /= diagonal[n - 1];
+        for (std::size_t i = n - 1; i-- > 0;)
+        {
+            moments[i] = (moments[i] - upper[i] * moments[i + 1]) / diagonal[i];
+        }
+
+        if (isNotAKnot)
+        {
+            const Real h0 = steps[0];
+            const Real h1 = steps[1];
+            moments[0] = ((h0 + h1) * moments[1] - h0 * moments[2]) / h1;
+            const Real hA = steps[n - 3];
+            const Real hB = steps[n - 2];
+            moments[n - 1] = ((hA + hB) * moments[n - 2] - hB * moments[n - 3]) / hA;
+        }
+        else if (boundary == SplineBoundary::notAKnot && n == 3)
+        {
+            // Interpolating parabola has constant second derivative.
+            const Real curvature = 2 * (slopes[1] - slopes[0]) / (steps[0] + steps[1]);
+            moments[0] = curvature;
+            moments[1] = curvature;
+            moments[2] = curvature;
+        }
+
+        coefficients.resize(4 * (n - 1));
+        for (std::size_t i = 0; i + 1 < n; i++)
+        {
+            Real* block = coefficients.data() + 4 * i;
+            block[0] = yData[i];
+            block[1] = slopes[i] - steps[i] * (2 * moments[i] + moments[i + 1]) / 6;
+            block[2] = moments[i] / 2;
+            block[3] = (moments[i + 1] - moments[i]) / (6 * steps[i]);
+        }
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * Computes interpolated y-value at specified x-value. The bracketing interval is found using
+     * binary search.
+     *
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real interpolate(const Real x) const
+    {
+        SML_PROFILE("CubicSpline::interpolate", xData.size());
+        return evaluateInterval(findInterval(xData, x), x);
+    }
+
+    //! Interpolate at specified x-value, using cursor.
+    /*!
+     * Computes interpolated y-value at specified x-value. The bracketing interval is found by
+     * hunting from the cursor, which is updated to the index of the bracketing interval.
+     *
+     * The spline itself is not modified, so multiple threads can query the same spline, each with
+     * their own cursor.
+     *
+     * @param  x       x-value to interpolate at
+     * @param  cursor  Cursor (index of bracketing interval), e.g., initialized to 0 and reused
+     * @return         Interpolated y-value
+     */
+    Real interpolate(const Real x, std::size_t& cursor) const
+    {
+        SML_PROFILE("CubicSpline::interpolate", xData.size());
+        cursor = huntInterval(xData, x, cursor);
+        return evaluateInterval(cursor, x);
+    }
+
+    //! Interpolate at batch of x-values.
+    /*!
+     * Computes interpolated y-values at a batch of Q x-values. The bracketing intervals are found
+     * by hunting from the interval of the previous query, so that ascending queries stream through
+     * the coefficients in one pass, at a cost of O(N + Q) operations. Unsorted queries are also
+     * supported, but are less efficient.
+     *
+     * @sa detail::interpolateCubicSplineKernel
+     * @param  queries  A vector of Q x-values to interpolate at
+     * @param  results  A vector of Q interpolated y-values (resized if necessary)
+     * @param  policy   Execution policy
+     */
+    void interpolate(const std::vector<Real>& queries,
+                     std::vector<Real>& results,
+                     const ExecutionPolicy& policy = ExecutionPolicy()) const
+    {
+        SML_PROFILE("CubicSpline::interpolate(batch)", queries.size());
+        results.resize(queries.size());
+        detail::executeInChunks([&](const std::size_t begin, const std::size_t end)
+        {
+            detail::interpolateCubicSplineKernel<Real>(xData.data(),
+                                                       xData.size(),
+                                                       coefficients.data(),
+                                                       queries.data() + begin,
+                                                       end - begin,
+                                                       results.data() + begin);
+        }, queries.size(), 6 * sizeof(Real), policy);
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * @sa interpolate
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real operator()(const Real x) const
+    {
+        return interpolate(x);
+    }
+
+    //! Get x-data.
+    /*!
+     * @return  Vector of x-values
+     */
+    const std::vector<Real>& getXData() const { return xData; }
+
+    //! Get coefficients.
+    /*!
+     * @return  Vector of contiguous blocks of 4 polynomial coefficients (a, b, c, d), one block per
+     *          interval
+     */
+    const std::vector<Real>& getCoefficients() const { return coefficients; }
+
+private:
+
+    //! Evaluate polynomial of specified interval.
+    /*!
+     * @param  interval  Index of interval
+     * @param  x         x-value to evaluate at
+     * @return           Value of polynomial
+     */
+    Real evaluateInterval(const std::size_t interval, const Real x) const
+    {
+        const Real* block = coefficients.data() + 4 * interval;
+        const Real t = x - xData[interval];
+        return block[0] + t * (block[1] + t * (block[2] + t * block[3]));
+    }
+
+    //! Vector of x-values.
+    std::vector<Real> xData;
+
+    //! Contiguous blocks of 4 polynomial coefficients, one per interval.
+    std::vector<Real> coefficients;
+};
+
+//! Explicitly instantiate cubic splines for given Real type.
+#define SML_INSTANTIATE_CUBIC_SPLINE(qualifier, Real) \
+    qualifier template class CubicSpline<Real>;
+
+//! Explicitly instantiate cubic splines for common types (see sml_compiled).
+#define SML_INSTANTIATE_CUBIC_SPLINE_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_CUBIC_SPLINE(qualifier, double) \
+    SML_INSTANTIATE_CUBIC_SPLINE(qualifier, float)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_CUBIC_SPLINE_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
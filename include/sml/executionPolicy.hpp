@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include "sml/simd.hpp"
+#include "sml/threadPool.hpp"
+
+namespace sml
+{
+
+//! Execution modes of batch functions.
+enum class ExecutionMode
+{
+    sequential,         //!< Run on calling thread, dispatched to instruction set at runtime
+    parallel,           //!< Run chunks on threads, compiled for instruction set at compile time
+    parallelVectorized  //!< Run chunks on threads, dispatched to instruction set at runtime
+};
+
+//! Execution policy of batch functions.
+/*!
+ * Specifies how a batch function processes its N elements:
+ * - ExecutionMode::sequential: all elements are processed on the calling thread, with the kernel
+ *   dispatched to the instruction set selected at runtime (see getInstructionSet()). This is the
+ *   default, and is the same as calling the batch function without an execution policy.
+ * - ExecutionMode::parallel: the elements are split into chunks that are processed in parallel by
+ *   an Executor. Each chunk is processed by the kernel compiled for the instruction set selected
+ *   at compile time, so results do not depend on the CPU that the program runs on.
+ * - ExecutionMode::parallelVectorized: as ExecutionMode::parallel, but each chunk is dispatched
+ *   to the instruction set selected at runtime, as for ExecutionMode::sequential.
+ *
+ * Batch functions whose loops cannot be vectorized, e.g., table interpolation that hunts for the
+ * bracketing interval of each query, treat both parallel modes the same.
+ *
+ * By default, chunks run on the default thread pool (see getDefaultThreadPool()). To run them on
+ * another executor, e.g., a ThreadPool owned by the caller or an adapter to a thread pool of the
+ * application, pass a pointer to it; the executor must outlive the calls of batch functions.
+ *
+ * By default, the chunk size is chosen such that each chunk fits in half of the L2 cache, and
+ * that there are enough chunks to balance the load across threads (see computeChunkSize()).
+ *
+ * Since ExecutionPolicy can be implicitly constructed from ExecutionMode, an execution mode can
+ * be passed directly to batch functions, e.g., normalize(batch, result, ExecutionMode::parallel).
+ */
+class ExecutionPolicy
+{
+public:
+
+    //! Construct execution policy.
+    /*!
+     * @param  someMode       Execution mode
+     * @param  someExecutor   Executor to run chunks on, or null for the default thread pool
+     * @param  someChunkSize  Number of elements per chunk, or zero to choose automatically
+     */
+    constexpr ExecutionPolicy(const ExecutionMode someMode = ExecutionMode::sequential,
+                              Executor* someExecutor = nullptr,
+                              const std::size_t someChunkSize = 0)
+        : mode(someMode),
+          executor(someExecutor),
+          chunkSize(someChunkSize)
+    { }
+
+    //! Get execution mode.
+    /*!
+     * @return  Execution mode
+     */
+    constexpr ExecutionMode getMode() const { return mode; }
+
+    //! Get executor.
+    /*!
+     * @return  Executor to run chunks on (default thread pool if none was specified)
+     */
+    Executor& getExecutor() const
+    {
+        return executor != nullptr ? *executor : getDefaultThreadPool();
+    }
+
+    //! Get chunk size.
+    /*!
+     * @return  Number of elements per chunk, or zero to choose automatically
+     */
+    constexpr std::size_t getChunkSize() const { return chunkSize; }
+
+private:
+
+    //! Execution mode.
+    ExecutionMode mode;
+
+    //! Executor to run chunks on, or null for the default thread pool.
+    Executor* executor;
+
+    //! Number of elements per chunk, or zero to choose automatically.
+    std::size_t chunkSize;
+};
+
+namespace detail
+{
+
+//! Minimum number of bytes processed per chunk of parallel batch functions.
+const std::size_t minimumChunkByteCount = 32768;
+
+//! Number of elements that chunk sizes are rounded to, so chunks start on cache-line boundaries.
+const std::size_t chunkSizeMultiple = 64;
+
+//! Get size of L2 cache.
+/*!
+ * @return  Size of L2 cache of CPU in bytes, or 256 KiB if it cannot be detected
+ */
+inline std::size_t getL2CacheSize()
+{
+#if defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+    static const long detectedSize = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (detectedSize > 0)
+    {
+        return static_cast<std::size_t>(detectedSize);
+    }
+#endif
+    return 262144;
+}
+
+//! Compute number of elements per chunk of parallel batch function.
+/*!
+ * Computes the chunk size for a batch of N elements, such that:
+ * - the bytes processed per chunk fit in half of the L2 cache, so that kernels that make several
+ *   passes over a chunk, e.g., one per component, read it from cache;
+ * - there are at least 4 chunks per thread, so that work stealing can balance the load;
+ * - the bytes processed per chunk are at least minimumChunkByteCount, so that scheduling a chunk
+ *   costs little compared to processing it.
+ * The last condition takes precedence, and the chunk size is rounded up to a multiple of
+ * chunkSizeMultiple.
+ *
+ * @param  count            Number of elements N
+ * @param  bytesPerElement  Number of bytes read and written per element
+ * @param  concurrency      Number of threads that process chunks
+ * @return                  Number of elements per chunk
+ */
+inline std::size_t computeChunkSize(const std::size_t count,
+                                    const std::size_t bytesPerElement,
+                                    const std::size_t concurrency)
+{
+    const std::size_t cacheChunkSize = getL2CacheSize() / 2 / bytesPerElement;
+    const std::size_t balancedChunkSize = (count + 4 * concurrency - 1) / (4 * concurrency);
+    const std::size_t minimumChunkSize = minimumChunkByteCount / bytesPerElement;
+    std::size_t chunkSize
+        = balancedChunkSize < cacheChunkSize ? balancedChunkSize : cacheChunkSize;
+    chunkSize = chunkSize > minimumChunkSize ? chunkSize : minimumChunkSize;
+    chunkSize = chunkSize > 0 ? chunkSize : 1;
+    return (chunkSize + chunkSizeMultiple - 1) / chunkSizeMultiple * chunkSizeMultiple;
+}
+
+//! Execute function over range of elements in chunks, according to execution policy.
+/*!
+ * Calls function(begin, end) for chunks [begin, end) that together cover the range [0, N). With
+ * ExecutionMode::sequential, or if the range fits in a single chunk, the function is called once
+ * for the whole range on the calling thread.
+ *
+ * @tparam Function         Function type, with operator()(begin, end)
+ * @param  function         Function to execute
+ * @param  count            Number of elements N
+ * @param  bytesPerElement  Number of bytes read and written per element
+ * @param  policy           Execution policy
+ */
+template <typename Function>
+void executeInChunks(const Function& function,
+                     const std::size_t count,
+                     const std::size_t bytesPerElement,
+                     const ExecutionPolicy& policy)
+{
+    if (policy.getMode() == ExecutionMode::sequential)
+    {
+        function(0, count);
+        return;
+    }
+    Executor& executor = policy.getExecutor();
+    const std::size_t chunkSize = policy.getChunkSize() > 0
+        ? policy.getChunkSize()
+        : computeChunkSize(count, bytesPerElement, executor.getConcurrency());
+    const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    if (chunkCount <= 1)
+    {
+        function(0, count);
+        return;
+    }
+    executor.parallelFor(chunkCount, [&function, count, chunkSize](const std::size_t chunk)
+    {
+        const std::size_t begin = chunk * chunkSize;
+        function(begin, count - begin < chunkSize ? count : begin + chunkSize);
+    });
+}
+
+//! Execute kernel according to execution policy.
+/*!
+ * Executes a kernel (see executeKernel()) over the index range [0, N), in chunks that run in
+ * parallel if so specified by the execution policy.
+ *
+ * @tparam Kernel           Kernel type, with force-inlined operator()(begin, end)
+ * @param  kernel           Kernel to execute
+ * @param  count            Number of elements N
+ * @param  bytesPerElement  Number of bytes read and written per element
+ * @param  policy           Execution policy
+ */
+template <typename Kernel>
+void executeKernel(const Kernel& kernel,
+                   const std::size_t count,
+                   const std::size_t bytesPerElement,
+                   const ExecutionPolicy& policy)
+{
+    if (policy.getMode() == ExecutionMode::parallel)
+    {
+        executeInChunks(kernel, count, bytesPerElement, policy);
+        return;
+    }
+    executeInChunks([&kernel](const std::size_t begin, const std::size_t end)
+    {
+        executeKernel(kernel, begin, end);
+    }, count, bytesPerElement, policy);
+}
+
+} // namespace detail
+
+} // namespace sml
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace sml
+{
+
+//! Fixed-size vector.
+/*!
+ * Vector of N elements that are stored inline, i.e., without heap allocation. The vector is an
+ * aggregate and a literal type, so it can be brace-initialized and used in constant expressions:
+ *
+ * \code
+ *      constexpr FixedVector<double, 3> vector = {{1.0, 2.0, 3.0}};
+ * \endcode
+ *
+ * The vector supports the element access operator and .size() function, so it can be used with
+ * all of the generic linear algebra functions in sml. Since the size is known at compile time,
+ * loops over the elements are fully unrolled by the compiler.
+ *
+ * @tparam Real  Real type
+ * @tparam Size  Number of elements N
+ */
+template <typename Real, std::size_t Size>
+struct FixedVector
+{
+    //! Element type.
+    typedef Real value_type;
+
+    //! Access element.
+    /*!
+     * @param  index  Index of element (< N)
+     * @return        Reference to element
+     */
+    constexpr Real& operator[](const std::size_t index) { return elements[index]; }
+
+    //! Access element.
+    /*!
+     * @param  index  Index of element (< N)
+     * @return        Const reference to element
+     */
+    constexpr const Real& operator[](const std::size_t index) const { return elements[index]; }
+
+    //! Get number of elements.
+    /*!
+     * @return  Number of elements N
+     */
+    static constexpr std::size_t size() { return Size; }
+
+    //! Get pointer to data.
+    /*!
+     * @return  Pointer to first element
+     */
+    constexpr Real* data() { return elements; }
+
+    //! Get pointer to data.
+    /*!
+     * @return  Const pointer to first element
+     */
+    constexpr const Real* data() const { return elements; }
+
+    //! Get iterator to first element.
+    /*!
+     * @return  Pointer to first element
+     */
+    constexpr Real* begin() { return elements; }
+
+    //! Get iterator to first element.
+    /*!
+     * @return  Const pointer to first element
+     */
+    constexpr const Real* begin() const { return elements; }
+
+    //! Get iterator past last element.
+    /*!
+     * @return  Pointer past last element
+     */
+    constexpr Real* end() { return elements + Size; }
+
+    //! Get iterator past last element.
+    /*!
+     * @return  Const pointer past last element
+     */
+    constexpr const Real* end() const { return elements + Size; }
+
+    //! Elements of vector.
+    Real elements[Size];
+};
+
+//! Compare fixed-size vectors for equality.
+/*!
+ * @tparam Real     Real type
+ * @tparam Size     Number of elements N
+ * @param  vector1  A fixed-size vector
+ * @param  vector2  A fixed-size vector
+ * @return          True if all elements are equal
+ */
+template <typename Real, std::size_t Size>
+constexpr bool operator==(const FixedVector<Real, Size>& vector1,
+                          const FixedVector<Real, Size>& vector2)
+{
+    for (std::size_t i = 0; i < Size; i++)
+    {
+        if (vector1[i] != vector2[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Compare fixed-size vectors for inequality.
+/*!
+ * @tparam Real     Real type
+ * @tparam Size     Number of elements N
+ * @param  vector1  A fixed-size vector
+ * @param  vector2  A fixed-size vector
+ * @return          True if any element differs
+ */
+template <typename Real, std::size_t Size>
+constexpr bool operator!=(const FixedVector<Real, Size>& vector1,
+                          const FixedVector<Real, Size>& vector2)
+{
+    return !(vector1 == vector2);
+}
+
+} // namespace sml
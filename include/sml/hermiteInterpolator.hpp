@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/tableSearch.hpp"
+
+namespace sml
+{
+
+//! Compute Hermite interpolation on stencil.
+/*!
+ * Computes Hermite interpolation polynomial through a stencil of M consecutive entries of a table
+ * of (x,y,dy/dx) values, to obtain y-value for a specified x-value. The stencil consists of the
+ * entries [start, start + M). The interpolating polynomial has degree 2M-1 and matches both the
+ * y-values and the derivatives at the M nodes, so that M nodes with derivatives yield the same
+ * order of accuracy as 2M nodes without. The polynomial is evaluated in Lagrange form:
+ *
+ * \f[
+ *      H(x) = \sum_{j} \left[ y_{j} + (x - x_{j}) \left( y_{j}' - 2 y_{j} L_{j}'(x_{j}) \right)
+ *             \right] L_{j}(x)^{2}, \qquad
+ *      L_{j}'(x_{j}) = \sum_{k \neq j} \frac{1}{x_{j} - x_{k}}
+ * \f]
+ *
+ * where \f$L_{j}\f$ are the Lagrange basis polynomials of the stencil. The interpolation costs
+ * O(M^2) operations, independent of the size of the table.
+ *
+ * If x coincides with one of the nodes in the stencil, the corresponding y-value is returned
+ * exactly.
+ *
+ * See Burden & Faires (2010), Numerical Analysis, section 3.4 for more background information.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa getStencilStart, HermiteTableInterpolator, lagrangeInterpolateStencil
+ * @tparam Real         Floating-point type
+ * @tparam Vector       Vector type
+ * @param  xData        A vector of N distinct x-values
+ * @param  yData        A vector of N y-values
+ * @param  dyData       A vector of N derivatives dy/dx
+ * @param  start        Index of first entry of stencil
+ * @param  stencilSize  Number of entries M in stencil
+ * @param  x            x-value to interpolate at
+ * @return              Interpolated y-value
+ */
+template <typename Real, typename Vector>
+Real hermiteInterpolateStencil(const Vector& xData,
+                               const Vector& yData,
+                               const Vector& dyData,
+                               const std::size_t start,
+                               const std::size_t stencilSize,
+                               const Real x)
+{
+    assert(xData.size() == yData.size() && xData.size() == dyData.size());
+    assert(start + stencilSize <= xData.size());
+    const std::size_t end = start + stencilSize;
+    Real result = 0;
+    for (std::size_t j = start; j < end; j++)
+    {
+        const Real node = xData[j];
+        Real numerator = 1;
+        Real denominator = 1;
+        Real basisSlope = 0;
+        for (std::size_t k = start; k < end; k++)
+        {
+            if (k != j)
+            {
+                const Real difference = node - xData[k];
+                numerator *= x - xData[k];
+                denominator *= difference;
+                basisSlope += 1 / difference;
+            }
+        }
+        const Real basis = numerator / denominator;
+        result += (yData[j] + (x - node) * (dyData[j] - 2 * basisSlope * yData[j]))
+                  * (basis * basis);
+    }
+    return result;
+}
+
+//! Hermite table interpolator.
+/*!
+ * Hermite interpolator for large tables of (x,y,dy/dx) values with strictly ascending x-values,
+ * e.g., trajectories with positions and velocities. A polynomial of fixed degree 2M-1 is
+ * constructed through a stencil of M entries centred on the interval that brackets the x-value to
+ * interpolate at, matching both the y-values and the derivatives. Near the start and end of the
+ * table, the stencil is shifted so that it lies entirely in the table.
+ *
+ * Compared to LagrangeTableInterpolator, the same order of accuracy is obtained with half the
+ * number of entries in the stencil, which halves the memory traffic per query. The bracketing
+ * interval is found in the same way, using binary search (O(log N) operations) or by hunting from
+ * a cursor (O(1) operations for successive queries that are close together). The interpolation
+ * itself costs O(M^2) operations.
+ *
+ * By default, the interpolator stores copies of the data. Alternatively, the Vector type can be
+ * set to a non-owning view, e.g., ArrayView<const Real>, to interpolate directly on data that is
+ * owned elsewhere, such as a memory-mapped MappedInterpolationTable, without copying it.
+ *
+ * @sa findInterval, huntInterval, getStencilStart, hermiteInterpolateStencil
+ * @tparam Real    Floating-point type
+ * @tparam Vector  Vector type used to store x-, y- and dy/dx-data
+ */
+template <typename Real, typename Vector = std::vector<Real> >
+class HermiteTableInterpolator
+{
+public:
+
+    //! Construct interpolator from x-, y- and dy/dx-data.
+    /*!
+     * Constructs interpolator from three equal-length vectors of x-values, y-values and
+     * derivatives. The x-values must be strictly ascending.
+     *
+     * @param  someXData        A vector of N strictly ascending x-values
+     * @param  someYData        A vector of N y-values
+     * @param  someDyData       A vector of N derivatives dy/dx
+     * @param  someStencilSize  Number of entries M (2 <= M <= N) in interpolation stencil
+     */
+    HermiteTableInterpolator(const Vector& someXData,
+                             const Vector& someYData,
+                             const Vector& someDyData,
+                             const std::size_t someStencilSize)
+        : xData(someXData),
+          yData(someYData),
+          dyData(someDyData),
+          stencilSize(someStencilSize)
+    {
+        assert(xData.size() == yData.size() && xData.size() == dyData.size());
+        assert(stencilSize >= 2 && stencilSize <= xData.size());
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * Computes interpolated y-value at specified x-value. The bracketing interval is found using
+     * binary search.
+     *
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real interpolate(const Real x) const
+    {
+        SML_PROFILE("HermiteTableInterpolator::interpolate", xData.size());
+        return evaluateInterval(findInterval(xData, x), x);
+    }
+
+    //! Interpolate at specified x-value, using cursor.
+    /*!
+     * Computes interpolated y-value at specified x-value. The bracketing interval is found by
+     * hunting from the cursor, which is updated to the index of the bracketing interval.
+     *
+     * The interpolator itself is not modified, so multiple threads can query the same
+     * interpolator, each with their own cursor.
+     *
+     * @param  x       x-value to interpolate at
+     * @param  cursor  Cursor (index of bracketing interval), e.g., initialized to 0 and reused
+     * @return         Interpolated y-value
+     */
+    Real interpolate(const Real x, std::size_t& cursor) const
+    {
+        SML_PROFILE("HermiteTableInterpolator::interpolate", xData.size());
+        cursor = huntInterval(xData, x, cursor);
+        return evaluateInterval(cursor, x);
+    }
+
+    //! Interpolate at batch of x-values.
+    /*!
+     * Computes interpolated y-values at a batch of Q x-values. The bracketing intervals are found
+     * by hunting from the interval of the previous query, so ascending (or descending) queries
+     * are the most efficient.
+     *
+     * @param  queries  A vector of Q x-values to interpolate at
+     * @param  results  A vector of Q interpolated y-values (resized if necessary)
+     * @param  policy   Execution policy
+     */
+    void interpolate(const std::vector<Real>& queries,
+                     std::vector<Real>& results,
+                     const ExecutionPolicy& policy = ExecutionPolicy()) const
+    {
+        SML_PROFILE("HermiteTableInterpolator::interpolate(batch)", queries.size());
+        results.resize(queries.size());
+        detail::executeInChunks([&](const std::size_t begin, const std::size_t end)
+        {
+            std::size_t cursor = 0;
+            for (std::size_t i = begin; i < end; i++)
+            {
+                cursor = huntInterval(xData, queries[i], cursor);
+                results[i] = evaluateInterval(cursor, queries[i]);
+            }
+        }, queries.size(), 3 * stencilSize * sizeof(Real), policy);
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * @sa interpolate
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real operator()(const Real x) const
+    {
+        return interpolate(x);
+    }
+
+    //! Get x-data.
+    /*!
+     * @return  Vector of x-values
+     */
+    const Vector& getXData() const { return xData; }
+
+    //! Get y-data.
+    /*!
+     * @return  Vector of y-values
+     */
+    const Vector& getYData() const { return yData; }
+
+    //! Get dy/dx-data.
+    /*!
+     * @return  Vector of derivatives dy/dx
+     */
+    const Vector& getDyData() const { return dyData; }
+
+    //! Get stencil size.
+    /*!
+     * @return  Number of entries in interpolation stencil
+     */
+    std::size_t getStencilSize() const { return stencilSize; }
+
+private:
+
+    //! Evaluate Hermite interpolation polynomial of stencil around specified interval.
+    /*!
+     * @param  interval  Index of bracketing interval
+     * @param  x         x-value to interpolate at
+     * @return           Interpolated y-value
+     */
+    Real evaluateInterval(const std::size_t interval, const Real x) const
+    {
+        return hermiteInterpolateStencil(xData,
+                                         yData,
+                                         dyData,
+                                         getStencilStart(interval, stencilSize, xData.size()),
+                                         stencilSize,
+                                         x);
+    }
+
+    //! Vector of x-values.
+    Vector xData;
+
+    //! Vector of y-values.
+    Vector yData;
+
+    //! Vector of derivatives dy/dx.
+    Vector dyData;
+
+    //! Number of entries in interpolation stencil.
+    std::size_t stencilSize;
+};
+
+//! Explicitly instantiate Hermite interpolation for given Real type.
+#define SML_INSTANTIATE_HERMITE_INTERPOLATOR(qualifier, Real) \
+    qualifier template Real hermiteInterpolateStencil<Real, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, const std::vector<Real>&, \
+        const std::size_t, const std::size_t, const Real); \
+    qualifier template class HermiteTableInterpolator<Real>;
+
+//! Explicitly instantiate Hermite interpolation for common types (see sml_compiled).
+#define SML_INSTANTIATE_HERMITE_INTERPOLATOR_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_HERMITE_INTERPOLATOR(qualifier, double) \
+    SML_INSTANTIATE_HERMITE_INTERPOLATOR(qualifier, float)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_HERMITE_INTERPOLATOR_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
@@ -0,0 +1,505 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SML_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define SML_HAS_MMAP 0
+#endif
+
+#include "sml/arrayView.hpp"
+#include "sml/lagrangeInterpolator.hpp"
+
+namespace sml
+{
+
+// The binary interpolation table format is a columnar format that stores a table of N rows with
+// strictly ascending x-values, K columns of y-values and, optionally, the barycentric weights of
+// the x-values (only for tables of at most INTERPOLATION_TABLE_MAX_WEIGHTED_ROWS rows). All values
+// are stored in native byte order as the Real type used to write the table (float or double).
+//
+// The file consists of a header of 64 bytes, followed by the x-column, the K y-columns and the
+// optional weights column. Each column starts at an offset that is a multiple of 64 bytes, so
+// that the columns are aligned to cache lines when the file is memory-mapped.
+//
+// Header layout (offsets in bytes):
+//  0: magic number "SMLTABLE" (8 bytes)
+//  8: format version (uint32)
+// 12: size of Real type in bytes (uint32)
+// 16: number of rows N (uint64)
+// 24: number of y-columns K (uint64)
+// 32: flags (uint32); bit 0 is set if the table contains barycentric weights
+// 36: byte-order marker 0x01020304 (uint32)
+// 40: stride between columns in bytes (uint64)
+// 48: reserved (16 bytes, zero)
+
+//! Binary interpolation table format version.
+const std::uint32_t INTERPOLATION_TABLE_VERSION = 1;
+
+//! Flag set in header of binary interpolation table that contains barycentric weights.
+const std::uint32_t INTERPOLATION_TABLE_HAS_WEIGHTS = 1;
+
+//! Maximum number of rows of binary interpolation table that contains barycentric weights.
+/*!
+ * The weights are those of a single (global) interpolating polynomial through all N rows. They
+ * cost O(N^2) operations to compute and, for large N, underflow or overflow, in particular for
+ * float. Besides, a polynomial of high degree through equidistant nodes oscillates between the
+ * nodes (Runge's phenomenon). Large tables should be interpolated locally instead, e.g., with
+ * LagrangeTableInterpolator, which does not need stored weights.
+ */
+const std::uint64_t INTERPOLATION_TABLE_MAX_WEIGHTED_ROWS = 64;
+
+namespace detail
+{
+
+//! Header of binary interpolation table.
+struct InterpolationTableHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t realSize;
+    std::uint64_t rowCount;
+    std::uint64_t columnCount;
+    std::uint32_t flags;
+    std::uint32_t byteOrder;
+    std::uint64_t columnStride;
+    std::uint8_t reserved[16];
+};
+
+//! Size of header and alignment of columns in binary interpolation table.
+const std::size_t interpolationTableAlignment = 64;
+
+//! Magic number of binary interpolation table.
+const char interpolationTableMagic[8] = {'S', 'M', 'L', 'T', 'A', 'B', 'L', 'E'};
+
+//! Byte-order marker of binary interpolation table.
+const std::uint32_t interpolationTableByteOrder = 0x01020304;
+
+//! Compute stride between columns in binary interpolation table.
+/*!
+ * @param  rowCount  Number of rows N
+ * @param  realSize  Size of Real type in bytes
+ * @return           Column stride in bytes, rounded up to multiple of table alignment
+ */
+inline std::uint64_t computeInterpolationTableStride(const std::uint64_t rowCount,
+                                                     const std::uint64_t realSize)
+{
+    const std::uint64_t alignment = interpolationTableAlignment;
+    return (rowCount * realSize + alignment - 1) / alignment * alignment;
+}
+
+//! Validate header of binary interpolation table.
+/*!
+ * Checks that the header describes a table of the expected Real type that fits in a file of the
+ * given size. Throws std::runtime_error if the header is invalid.
+ *
+ * @tparam Real      Floating-point type
+ * @param  header    Header of table
+ * @param  fileSize  Size of file in bytes
+ * @param  path      Path to file (used in error messages)
+ */
+template <typename Real>
+void validateInterpolationTableHeader(const InterpolationTableHeader& header,
+                                      const std::uint64_t fileSize,
+                                      const std::string& path)
+{
+    if (std::memcmp(header.magic, interpolationTableMagic, sizeof(header.magic)) != 0)
+    {
+        throw std::runtime_error("Interpolation table " + path + " has invalid magic number");
+    }
+    if (header.version != INTERPOLATION_TABLE_VERSION)
+    {
+        throw std::runtime_error("Interpolation table " + path + " has unsupported version");
+    }
+    if (header.byteOrder != interpolationTableByteOrder)
+    {
+        throw std::runtime_error("Interpolation table " + path + " has foreign byte order");
+    }
+    if (header.realSize != sizeof(Real))
+    {
+        throw std::runtime_error("Interpolation table " + path + " has mismatched Real type");
+    }
+    if (header.rowCount < 2
+        || header.rowCount > fileSize / sizeof(Real)
+        || header.columnStride != computeInterpolationTableStride(header.rowCount, sizeof(Real)))
+    {
+        throw std::runtime_error("Interpolation table " + path + " has invalid dimensions");
+    }
+    const std::uint64_t columns
+        = 1 + header.columnCount + ((header.flags & INTERPOLATION_TABLE_HAS_WEIGHTS) ? 1 : 0);
+    if (header.columnCount > (fileSize - interpolationTableAlignment) / header.columnStride
+        || interpolationTableAlignment + columns * header.columnStride != fileSize)
+    {
+        throw std::runtime_error("Interpolation table " + path + " has invalid file size");
+    }
+}
+
+} // namespace detail
+
+//! Write binary interpolation table.
+/*!
+ * Writes a table of N rows with strictly ascending x-values and K columns of y-values to a file
+ * in the binary interpolation table format, which can be memory-mapped using
+ * MappedInterpolationTable. Optionally, the barycentric weights of the x-values are computed and
+ * stored, for use with barycentricInterpolate(). Weights can only be stored for tables of at most
+ * INTERPOLATION_TABLE_MAX_WEIGHTED_ROWS rows.
+ *
+ * Throws std::invalid_argument if the table is invalid, i.e., if it has less than 2 rows, if the
+ * x-values are not strictly ascending or if the columns are not all of length N, or if weights
+ * are requested for a table of more than INTERPOLATION_TABLE_MAX_WEIGHTED_ROWS rows. Throws
+ * std::runtime_error if the file cannot be written.
+ *
+ * Note that the Vector and Matrix types must support the following operation/functions:
+ * - [] (element access operator; for Matrix returning a column of type Vector)
+ * - .size() (vector length function)
+ *
+ * @sa MappedInterpolationTable, computeBarycentricWeights, INTERPOLATION_TABLE_MAX_WEIGHTED_ROWS
+ * @tparam Real            Floating-point type
+ * @tparam Vector          Vector type
+ * @tparam Matrix          Matrix type, stored as a collection of columns
+ * @param  path            Path to file to write
+ * @param  xData           A vector of N strictly ascending x-values
+ * @param  yColumns        A collection of K vectors of N y-values
+ * @param  includeWeights  Flag indicating if barycentric weights should be stored
+ */
+template <typename Real, typename Vector, typename Matrix>
+void writeInterpolationTable(const std::string& path,
+                             const Vector& xData,
+                             const Matrix& yColumns,
+                             const bool includeWeights = false)
+{
+    const std::size_t rowCount = xData.size();
+    if (rowCount < 2)
+    {
+        throw std::invalid_argument("Interpolation table must have at least 2 rows");
+    }
+    if (includeWeights && rowCount > INTERPOLATION_TABLE_MAX_WEIGHTED_ROWS)
+    {
+        throw std::invalid_argument("Interpolation table with weights has too many rows");
+    }
+    for (std::size_t i = 1; i < rowCount; i++)
+    {
+        if (!(xData[i - 1] < xData[i]))
+        {
+            throw std::invalid_argument("Interpolation table x-values must be strictly ascending");
+        }
+    }
+    for (std::size_t k = 0; k < yColumns.size(); k++)
+    {
+        if (yColumns[k].size() != rowCount)
+        {
+            throw std::invalid_argument("Interpolation table columns must have equal length");
+        }
+    }
+
+    detail::InterpolationTableHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, detail::interpolationTableMagic, sizeof(header.magic));
+    header.version = INTERPOLATION_TABLE_VERSION;
+    header.realSize = sizeof(Real);
+    header.rowCount = rowCount;
+    header.columnCount = yColumns.size();
+    header.flags = includeWeights ? INTERPOLATION_TABLE_HAS_WEIGHTS : 0;
+    header.byteOrder = detail::interpolationTableByteOrder;
+    header.columnStride = detail::computeInterpolationTableStride(rowCount, sizeof(Real));
+
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Could not open interpolation table " + path + " for writing");
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // Columns are copied into a buffer that is padded to the column stride.
+    std::vector<Real> column(header.columnStride / sizeof(Real), Real(0));
+    const std::streamsize columnBytes = static_cast<std::streamsize>(header.columnStride);
+    for (std::size_t i = 0; i < rowCount; i++)
+    {
+        column[i] = xData[i];
+    }
+    file.write(reinterpret_cast<const char*>(column.data()), columnBytes);
+    for (std::size_t k = 0; k < yColumns.size(); k++)
+    {
+        for (std::size_t i = 0; i < rowCount; i++)
+        {
+            column[i] = yColumns[k][i];
+        }
+        file.write(reinterpret_cast<const char*>(column.data()), columnBytes);
+    }
+    if (includeWeights)
+    {
+        std::vector<Real> nodes(rowCount);
+        for (std::size_t i = 0; i < rowCount; i++)
+        {
+            nodes[i] = xData[i];
+        }
+        const std::vector<Real> weights = computeBarycentricWeights<Real>(nodes);
+        std::copy(weights.begin(), weights.end(), column.begin());
+        file.write(reinterpret_cast<const char*>(column.data()), columnBytes);
+    }
+
+    if (!file)
+    {
+        throw std::runtime_error("Could not write interpolation table " + path);
+    }
+}
+
+//! Memory-mapped binary interpolation table.
+/*!
+ * Read-only view of a table stored in the binary interpolation table format, written by
+ * writeInterpolationTable(). On POSIX systems, the file is memory-mapped, so that opening the
+ * table is cheap, pages are only read from disk when accessed, and processes that map the same
+ * table share its pages in the page cache. On other systems, the file is read into memory.
+ *
+ * The columns are exposed as ArrayView objects, which can be passed directly (zero-copy) to the
+ * interpolation functions in sml, e.g., LagrangeTableInterpolator<Real, ArrayView<const Real>>,
+ * barycentricInterpolate() and barycentricInterpolateBatch(). The views are valid for as long as
+ * the table exists.
+ *
+ * The constructor validates the header and file size, and throws std::runtime_error if the file
+ * cannot be read or is invalid. Optionally, the x-values are also checked to be strictly
+ * ascending, which requires reading the whole x-column.
+ *
+ * @sa writeInterpolationTable, ArrayView
+ * @tparam Real  Floating-point type (must match type used to write table)
+ */
+template <typename Real>
+class MappedInterpolationTable
+{
+public:
+
+    //! Read-only view of a column.
+    typedef ArrayView<const Real> Column;
+
+    //! Open table.
+    /*!
+     * @param  path          Path to table file
+     * @param  validateData  Flag indicating if x-values should be checked to be strictly ascending
+     */
+    explicit MappedInterpolationTable(const std::string& path, const bool validateData = true)
+        : mapping(nullptr),
+          mappingSize(0)
+    {
+        std::memset(&header, 0, sizeof(header));
+        open(path);
+        try
+        {
+            detail::validateInterpolationTableHeader<Real>(header, mappingSize, path);
+            if (validateData)
+            {
+                const Column xData = getXData();
+                for (std::size_t i = 1; i < xData.size(); i++)
+                {
+                    if (!(xData[i - 1] < xData[i]))
+                    {
+                        throw std::runtime_error("Interpolation table " + path
+                                                 + " has x-values that are not strictly ascending");
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            close();
+            throw;
+        }
+    }
+
+    //! Close table.
+    ~MappedInterpolationTable()
+    {
+        close();
+    }
+
+    //! Move-construct table.
+    /*!
+     * @param  other  Table to move from (left empty)
+     */
+    MappedInterpolationTable(MappedInterpolationTable&& other)
+        : header(other.header),
+          mapping(other.mapping),
+          mappingSize(other.mappingSize),
+          buffer(std::move(other.buffer))
+    {
+        other.mapping = nullptr;
+        other.mappingSize = 0;
+    }
+
+    MappedInterpolationTable(const MappedInterpolationTable&) = delete;
+    MappedInterpolationTable& operator=(const MappedInterpolationTable&) = delete;
+    MappedInterpolationTable& operator=(MappedInterpolationTable&&) = delete;
+
+    //! Get number of rows.
+    /*!
+     * @return  Number of rows N
+     */
+    std::size_t getRowCount() const { return static_cast<std::size_t>(header.rowCount); }
+
+    //! Get number of y-columns.
+    /*!
+     * @return  Number of y-columns K
+     */
+    std::size_t getColumnCount() const { return static_cast<std::size_t>(header.columnCount); }
+
+    //! Check if table contains barycentric weights.
+    /*!
+     * @return  True if table contains barycentric weights
+     */
+    bool hasWeights() const { return (header.flags & INTERPOLATION_TABLE_HAS_WEIGHTS) != 0; }
+
+    //! Get x-values.
+    /*!
+     * @return  View of N strictly ascending x-values
+     */
+    Column getXData() const { return getColumn(0); }
+
+    //! Get y-column.
+    /*!
+     * @param  index  Index of y-column (< K)
+     * @return        View of N y-values
+     */
+    Column getYColumn(const std::size_t index) const
+    {
+        assert(index < getColumnCount());
+        return getColumn(1 + index);
+    }
+
+    //! Get all y-columns.
+    /*!
+     * @return  Collection of K views of N y-values
+     */
+    std::vector<Column> getYColumns() const
+    {
+        std::vector<Column> columns;
+        columns.reserve(getColumnCount());
+        for (std::size_t k = 0; k < getColumnCount(); k++)
+        {
+            columns.push_back(getYColumn(k));
+        }
+        return columns;
+    }
+
+    //! Get barycentric weights.
+    /*!
+     * @return  View of N barycentric weights (empty if table does not contain weights)
+     */
+    Column getWeights() const
+    {
+        return hasWeights() ? getColumn(1 + getColumnCount()) : Column();
+    }
+
+private:
+
+    //! Get column by position in file.
+    /*!
+     * @param  position  Position of column in file (0 for x-column)
+     * @return           View of column
+     */
+    Column getColumn(const std::size_t position) const
+    {
+        const unsigned char* start = static_cast<const unsigned char*>(mapping)
+                                     + detail::interpolationTableAlignment
+                                     + position * header.columnStride;
+        return Column(reinterpret_cast<const Real*>(start), getRowCount());
+    }
+
+    //! Open and map file, and read header.
+    /*!
+     * @param  path  Path to table file
+     */
+    void open(const std::string& path)
+    {
+#if SML_HAS_MMAP
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            throw std::runtime_error("Could not open interpolation table " + path);
+        }
+        struct stat status;
+        if (::fstat(descriptor, &status) != 0
+            || static_cast<std::size_t>(status.st_size) < sizeof(header))
+        {
+            ::close(descriptor);
+            throw std::runtime_error("Could not read interpolation table " + path);
+        }
+        mappingSize = static_cast<std::size_t>(status.st_size);
+        void* address = ::mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, descriptor, 0);
+        ::close(descriptor);
+        if (address == MAP_FAILED)
+        {
+            mappingSize = 0;
+            throw std::runtime_error("Could not map interpolation table " + path);
+        }
+        mapping = address;
+#else
+        std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            throw std::runtime_error("Could not open interpolation table " + path);
+        }
+        mappingSize = static_cast<std::size_t>(file.tellg());
+        if (mappingSize < sizeof(header))
+        {
+            throw std::runtime_error("Could not read interpolation table " + path);
+        }
+        // Buffer of Real elements ensures that the columns are suitably aligned.
+        buffer.resize((mappingSize + sizeof(Real) - 1) / sizeof(Real));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(mappingSize));
+        if (!file)
+        {
+            throw std::runtime_error("Could not read interpolation table " + path);
+        }
+        mapping = buffer.data();
+#endif
+        std::memcpy(&header, mapping, sizeof(header));
+    }
+
+    //! Unmap file.
+    void close()
+    {
+#if SML_HAS_MMAP
+        if (mapping != nullptr)
+        {
+            ::munmap(mapping, mappingSize);
+        }
+#endif
+        mapping = nullptr;
+        mappingSize = 0;
+        buffer.clear();
+    }
+
+    //! Header of table.
+    detail::InterpolationTableHeader header;
+
+    //! Start of memory-mapped file (or buffer).
+    void* mapping;
+
+    //! Size of memory-mapped file in bytes.
+    std::size_t mappingSize;
+
+    //! Buffer holding file contents on systems without memory-mapping.
+    std::vector<Real> buffer;
+};
+
+} // namespace sml
@@ -0,0 +1,510 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "sml/basicFunctionsBatch.hpp"
+#include "sml/constants.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+#include "sml/trigonometry.hpp"
+
+namespace sml
+{
+
+namespace detail
+{
+
+//! Estimate cube root of positive real number, without branches.
+/*!
+ * The estimate is obtained by dividing the exponent bits of the single-precision representation
+ * by three, and refined with two Newton iterations to a relative error of about 1e-5. This is only
+ * accurate enough for starting guesses, but unlike std::cbrt() it can be vectorized.
+ *
+ * @tparam Real   Real type
+ * @param  value  Positive real number, within the normal range of float
+ * @return        Estimate of cube root of value
+ */
+template <typename Real>
+SML_FORCE_INLINE Real computeCubeRootEstimate(const Real value)
+{
+    const float single = static_cast<float>(value);
+    std::uint32_t bits;
+    std::memcpy(&bits, &single, sizeof(bits));
+    bits = bits / 3 + 709921077u;
+    float estimate;
+    std::memcpy(&estimate, &bits, sizeof(estimate));
+
+    Real root = estimate;
+    root -= (root * root * root - value) / (Real(3) * root * root);
+    root -= (root * root * root - value) / (Real(3) * root * root);
+    return root;
+}
+
+//! Compute x - sin(x) or sinh(x) - x for small x, using Taylor series.
+/*!
+ * Computing these differences directly cancels most significant digits for small x. The Taylor
+ * series has all terms of order three and higher, and is accurate to a few units in the last place
+ * for |x| <= pi (x - sin(x)) or |x| <= 1 (sinh(x) - x).
+ *
+ * @tparam Real          Real type
+ * @tparam isHyperbolic  Flag indicating if sinh(x) - x should be computed instead of x - sin(x)
+ * @param  value         Real number x, in range [-pi, pi] or [-1, 1], respectively
+ * @return               Difference x - sin(x) or sinh(x) - x
+ */
+template <typename Real, bool isHyperbolic>
+SML_FORCE_INLINE Real computeSineSeriesRemainder(const Real value)
+{
+    const Real square = isHyperbolic ? value * value : -value * value;
+    const Real series = Real(1.0 / 6.0) + square
+        * (Real(1.0 / 120.0) + square
+        * (Real(1.0 / 5040.0) + square
+        * (Real(1.0 / 362880.0) + square
+        * (Real(1.0 / 39916800.0) + square
+        * (Real(1.0 / 6227020800.0) + square
+        * (Real(1.0 / 1307674368000.0) + square
+        * (Real(1.0 / 355687428096000.0) + square
+        * (Real(1.0 / 121645100408832000.0) + square
+        * (Real(1.0 / 51090942171709440000.0) + square
+        * (Real(1.0 / 25852016738884976640000.0) + square
+        * (Real(1.0 / 15511210043330985984000000.0) + square
+        * (Real(1.0 / 10888869450418352160768000000.0) + square
+        * Real(1.0 / 8841761993739701954543616000000.0)))))))))))));
+    return value * value * value * series;
+}
+
+//! Compute one iteration of fourth order of solver of Kepler's equation.
+/*!
+ * Applies Danby's quartic correction to the root of f(x) = 0, given the function f and its first
+ * three derivatives at the current estimate of the root.
+ *
+ * @tparam Real  Real type
+ * @param  f0    Function value
+ * @param  f1    First derivative
+ * @param  f2    Second derivative
+ * @param  f3    Third derivative
+ * @return       Correction to add to current estimate of root
+ */
+template <typename Real>
+SML_FORCE_INLINE Real computeQuarticCorrection(const Real f0,
+                                               const Real f1,
+                                               const Real f2,
+                                               const Real f3)
+{
+    const Real newtonCorrection = -f0 / f1;
+    const Real halleyCorrection = -f0 / (f1 + Real(0.5) * newtonCorrection * f2);
+    return -f0 / (f1 + Real(0.5) * halleyCorrection * f2
+                  + halleyCorrection * halleyCorrection * f3 * Real(1.0 / 6.0));
+}
+
+//! Compute correction of eccentric anomaly in iteration of elliptic solver.
+/*!
+ * The equation is evaluated as (1 - e) E + e (E - sin(E)) - m, with the series of
+ * computeSineSeriesRemainder() for E - sin(E), so that the eccentric anomaly has a small relative
+ * error also for small m. The series is used for all E, since selecting between the series and
+ * the direct difference turns into a branch, which prevents vectorization.
+ *
+ * @tparam Real          Real type
+ * @param  anomaly       Current estimate of eccentric anomaly E in radians, in range [0, pi]
+ * @param  meanAnomaly   Mean anomaly m in radians, in range [0, pi]
+ * @param  eccentricity  Eccentricity e, in range [0, 1)
+ * @return               Correction to add to eccentric anomaly
+ */
+template <typename Real>
+SML_FORCE_INLINE Real computeEllipticCorrection(const Real anomaly,
+                                                const Real meanAnomaly,
+                                                const Real eccentricity)
+{
+    Real sine;
+    Real cosine;
+    computeSineCosine<Real, false>(anomaly, sine, cosine);
+    const Real remainder = computeSineSeriesRemainder<Real, false>(anomaly);
+    const Real f0 = (Real(1) - eccentricity) * anomaly + eccentricity * remainder - meanAnomaly;
+    return computeQuarticCorrection(
+        f0, Real(1) - eccentricity * cosine, eccentricity * sine, eccentricity * cosine);
+}
+
+//! Compute correction of hyperbolic anomaly in iteration of hyperbolic solver.
+/*!
+ * The equation is evaluated as (e - 1) H + e (sinh(H) - H) - m, with the series of
+ * computeSineSeriesRemainder() for H < 1.
+ *
+ * @tparam Real          Real type
+ * @param  anomaly       Current estimate of hyperbolic anomaly H, non-negative
+ * @param  meanAnomaly   Mean anomaly m, non-negative
+ * @param  eccentricity  Eccentricity e, greater than 1
+ * @return               Correction to add to hyperbolic anomaly
+ */
+template <typename Real>
+SML_FORCE_INLINE Real computeHyperbolicCorrection(const Real anomaly,
+                                                  const Real meanAnomaly,
+                                                  const Real eccentricity)
+{
+    const Real exponential = std::exp(anomaly);
+    const Real inverseExponential = Real(1) / exponential;
+    const Real sine = Real(0.5) * (exponential - inverseExponential);
+    const Real cosine = Real(0.5) * (exponential + inverseExponential);
+    const Real remainder = anomaly < Real(1) ? computeSineSeriesRemainder<Real, true>(anomaly)
+                                             : sine - anomaly;
+    const Real f0 = (eccentricity - Real(1)) * anomaly + eccentricity * remainder - meanAnomaly;
+    return computeQuarticCorrection(f0,
+                                    (eccentricity - Real(1)) + eccentricity * (cosine - Real(1)),
+                                    eccentricity * sine,
+                                    eccentricity * cosine);
+}
+
+//! Solve Kepler's equation for elliptic orbits, without branches.
+/*!
+ * The mean anomaly is wrapped to [-pi, pi) by subtracting the nearest multiple of 2pi, and the
+ * equation is solved for its magnitude m, for which the eccentric anomaly E is in [0, pi]. The
+ * starting guess is Mikkola's approximation (Mikkola, 1987), which is accurate to about 1e-3 for
+ * all eccentricities, including close to 1 for small m. It is refined with two iterations of
+ * fourth order (see computeEllipticCorrection()).
+ *
+ * @tparam Real          Real type
+ * @param  meanAnomaly   Mean anomaly in radians
+ * @param  eccentricity  Eccentricity, in range [0, 1)
+ * @return               Eccentric anomaly in radians, in range [-pi, pi]
+ */
+template <typename Real>
+SML_FORCE_INLINE Real solveEllipticKeplerEquation(const Real meanAnomaly, const Real eccentricity)
+{
+    const Real revolutions
+        = computeBranchFreeFloor(meanAnomaly * (Real(1) / twoPi<Real>) + Real(0.5));
+    const Real wrappedAnomaly = meanAnomaly - revolutions * twoPi<Real>;
+    const Real m = std::fabs(wrappedAnomaly);
+    const Real e = eccentricity;
+
+    const Real denominator = Real(4) * e + Real(0.5);
+    const Real alpha = (Real(1) - e) / denominator;
+    const Real beta = m / (Real(2) * denominator);
+    const Real z = computeCubeRootEstimate(beta + std::sqrt(beta * beta + alpha * alpha * alpha));
+    Real s = z - alpha / z;
+    s -= Real(0.078) * s * s * s * s * s / (Real(1) + e);
+    Real anomaly = m + e * s * (Real(3) - Real(4) * s * s);
+
+    // Two iterations reduce the error to a few units in the last place for double and float. They
+    // are written out, since GCC does not vectorize loops that contain loops.
+    anomaly += computeEllipticCorrection(anomaly, m, e);
+    anomaly += computeEllipticCorrection(anomaly, m, e);
+    return std::copysign(anomaly, wrappedAnomaly);
+}
+
+//! Solve Kepler's equation for hyperbolic orbits.
+/*!
+ * The equation e sinh(H) - H = M is solved for m = |M|. The starting guess is obtained from the
+ * root U of the cubic (e - 1) H + e H^3 / 6 = m, which is an upper bound of the root since
+ * sinh(H) >= H + H^3 / 6, and refined with H = asinh((m + U) / e), which is also an upper bound
+ * but much closer for large m. It is refined with two iterations of fourth order (see
+ * computeHyperbolicCorrection()).
+ *
+ * The hyperbolic functions are computed with std::exp(), std::asinh() and std::cbrt(), so that
+ * loops only vectorize if the compiler provides vectorized versions of these functions.
+ *
+ * @tparam Real          Real type
+ * @param  meanAnomaly   Mean anomaly
+ * @param  eccentricity  Eccentricity, greater than 1
+ * @return               Hyperbolic anomaly
+ */
+template <typename Real>
+SML_FORCE_INLINE Real solveHyperbolicKeplerEquation(const Real meanAnomaly,
+                                                    const Real eccentricity)
+{
+    const Real m = std::fabs(meanAnomaly);
+    const Real e = eccentricity;
+
+    const Real p = Real(2) * (e - Real(1)) / e;
+    const Real q = Real(3) * m / e;
+    const Real w = std::cbrt(q + std::sqrt(q * q + p * p * p));
+    Real anomaly = std::asinh((m + w - p / w) / e);
+
+    anomaly += computeHyperbolicCorrection(anomaly, m, e);
+    anomaly += computeHyperbolicCorrection(anomaly, m, e);
+    return std::copysign(anomaly, meanAnomaly);
+}
+
+//! Convert eccentric anomaly to true anomaly, without branches.
+/*!
+ * Uses the half-angle form, which is accurate for all eccentricities in [0, 1).
+ *
+ * @tparam Real              Real type
+ * @param  eccentricAnomaly  Eccentric anomaly in radians, in range [-pi, pi]
+ * @param  eccentricity      Eccentricity, in range [0, 1)
+ * @return                   True anomaly in radians, in range [-pi, pi]
+ */
+template <typename Real>
+SML_FORCE_INLINE Real convertEccentricToTrueAnomaly(const Real eccentricAnomaly,
+                                                    const Real eccentricity)
+{
+    Real sine;
+    Real cosine;
+    computeSineCosine<Real, false>(Real(0.5) * eccentricAnomaly, sine, cosine);
+    return Real(2) * computeArcTangent2<Real, false>(std::sqrt(Real(1) + eccentricity) * sine,
+                                                     std::sqrt(Real(1) - eccentricity) * cosine);
+}
+
+//! Convert hyperbolic anomaly to true anomaly.
+/*!
+ * @tparam Real               Real type
+ * @param  hyperbolicAnomaly  Hyperbolic anomaly
+ * @param  eccentricity       Eccentricity, greater than 1
+ * @return                    True anomaly in radians, in range (-pi, pi)
+ */
+template <typename Real>
+SML_FORCE_INLINE Real convertHyperbolicToTrueAnomaly(const Real hyperbolicAnomaly,
+                                                     const Real eccentricity)
+{
+    const Real halfAnomalyTangent = std::tanh(Real(0.5) * hyperbolicAnomaly);
+    return Real(2) * std::atan2(std::sqrt(eccentricity + Real(1)) * halfAnomalyTangent,
+                                std::sqrt(eccentricity - Real(1)));
+}
+
+//! Check if all eccentricities in array are elliptic, i.e., in range [0, 1).
+/*!
+ * @tparam Real            Real type
+ * @param  eccentricities  Array of eccentricities
+ * @param  size            Number of eccentricities
+ * @return                 True if all eccentricities are in range [0, 1)
+ */
+template <typename Real>
+bool isElliptic(const Real* eccentricities, const std::size_t size)
+{
+    int outside = 0;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        outside |= eccentricities[i] >= Real(0) && eccentricities[i] < Real(1) ? 0 : 1;
+    }
+    return outside == 0;
+}
+
+//! Kernel computing eccentric or true anomalies of batch of elliptic orbits.
+template <typename Real, bool isTrueAnomaly>
+struct EllipticAnomalyKernel
+{
+    const Real* meanAnomalies;
+    const Real* eccentricities;
+    Real* anomalies;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Real eccentricity = eccentricities[i];
+            const Real eccentricAnomaly
+                = solveEllipticKeplerEquation(meanAnomalies[i], eccentricity);
+            const Real anomaly
+                = isTrueAnomaly ? convertEccentricToTrueAnomaly(eccentricAnomaly, eccentricity)
+                                : eccentricAnomaly;
+            anomalies[i] = wrapWithReciprocal(anomaly, twoPi<Real>, Real(1) / twoPi<Real>);
+        }
+    }
+};
+
+//! Kernel computing hyperbolic anomalies of batch of hyperbolic orbits.
+template <typename Real>
+struct HyperbolicAnomalyKernel
+{
+    const Real* meanAnomalies;
+    const Real* eccentricities;
+    Real* anomalies;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            anomalies[i] = solveHyperbolicKeplerEquation(meanAnomalies[i], eccentricities[i]);
+        }
+    }
+};
+
+} // namespace detail
+
+//! Compute eccentric anomalies of batch of elliptic orbits.
+/*!
+ * Solves Kepler's equation, M = E - e sin(E), for the eccentric anomalies E of a vector of N mean
+ * anomalies M and eccentricities e element-wise. The mean anomalies can be any real numbers (they
+ * are wrapped to one revolution first), and the eccentric anomalies are wrapped to the range
+ * [0, 2pi) with the same correction as computeModuloFast().
+ *
+ * Each element is solved with a fixed number of branch-free iterations of fourth order from an
+ * accurate starting guess, using the polynomial sine and cosine of trigonometry.hpp, so that the
+ * batch is vectorized across orbits. It is dispatched at runtime to the best instruction set
+ * supported by the CPU (see getInstructionSet()). Since the starting guess calls std::sqrt, the
+ * batch is only vectorized if the compiler does not have to set errno (see simd.hpp). The relative
+ * error is a few units in the last place for all eccentricities in [0, 1), including
+ * near-parabolic orbits.
+ *
+ * The results can be written to the vector of mean anomalies, i.e., the eccentric anomalies can be
+ * computed in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeTrueAnomaly, computeHyperbolicAnomaly
+ * @tparam Real                Real type
+ * @tparam Vector              Vector type
+ * @tparam ResultVector        Vector type of result
+ * @param  meanAnomalies       A vector of N mean anomalies in radians
+ * @param  eccentricities      A vector of N eccentricities, in range [0, 1)
+ * @param  eccentricAnomalies  A vector of N eccentric anomalies in radians, in range [0, 2pi)
+ *                             (sized by caller)
+ * @param  policy              Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeEccentricAnomaly(const Vector& meanAnomalies,
+                             const Vector& eccentricities,
+                             ResultVector& eccentricAnomalies,
+                             const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeEccentricAnomaly", meanAnomalies.size());
+    assert(eccentricities.size() == meanAnomalies.size());
+    assert(eccentricAnomalies.size() == meanAnomalies.size());
+    const detail::EllipticAnomalyKernel<Real, false> kernel
+        = {meanAnomalies.data(), eccentricities.data(), eccentricAnomalies.data()};
+    detail::executeKernel(kernel, meanAnomalies.size(), 3 * sizeof(Real), policy);
+}
+
+//! Compute hyperbolic anomalies of batch of hyperbolic orbits.
+/*!
+ * Solves Kepler's equation for hyperbolic orbits, M = e sinh(H) - H, for the hyperbolic anomalies
+ * H of a vector of N mean anomalies M and eccentricities e element-wise. The hyperbolic anomalies
+ * have the same sign as the mean anomalies, and are not wrapped.
+ *
+ * Each element is solved with the same fixed number of iterations as computeEccentricAnomaly(),
+ * from a starting guess that is an upper bound of the root. The relative error is a few units in
+ * the last place for all eccentricities greater than 1. Since the hyperbolic functions are
+ * computed with std::exp() and std::asinh(), the batch is only vectorized if the compiler provides
+ * vectorized versions of these functions (e.g., GCC with glibc and -ffast-math).
+ *
+ * The results can be written to the vector of mean anomalies, i.e., the hyperbolic anomalies can
+ * be computed in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeEccentricAnomaly, computeTrueAnomaly
+ * @tparam Real                Real type
+ * @tparam Vector              Vector type
+ * @tparam ResultVector        Vector type of result
+ * @param  meanAnomalies       A vector of N mean anomalies
+ * @param  eccentricities      A vector of N eccentricities, greater than 1
+ * @param  hyperbolicAnomalies A vector of N hyperbolic anomalies (sized by caller)
+ * @param  policy              Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeHyperbolicAnomaly(const Vector& meanAnomalies,
+                              const Vector& eccentricities,
+                              ResultVector& hyperbolicAnomalies,
+                              const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeHyperbolicAnomaly", meanAnomalies.size());
+    assert(eccentricities.size() == meanAnomalies.size());
+    assert(hyperbolicAnomalies.size() == meanAnomalies.size());
+    const detail::HyperbolicAnomalyKernel<Real> kernel
+        = {meanAnomalies.data(), eccentricities.data(), hyperbolicAnomalies.data()};
+    detail::executeKernel(kernel, meanAnomalies.size(), 3 * sizeof(Real), policy);
+}
+
+//! Compute true anomalies of batch of elliptic and hyperbolic orbits.
+/*!
+ * Solves Kepler's equation for a vector of N mean anomalies and eccentricities element-wise, as
+ * computeEccentricAnomaly() for elliptic orbits and computeHyperbolicAnomaly() for hyperbolic
+ * orbits, and converts the eccentric or hyperbolic anomalies to true anomalies, wrapped to the
+ * range [0, 2pi). Parabolic orbits (eccentricity of 1) are not supported.
+ *
+ * If all orbits are elliptic, the batch is vectorized as for computeEccentricAnomaly(). Otherwise,
+ * each orbit is solved separately with the solver for its type.
+ *
+ * The results can be written to the vector of mean anomalies, i.e., the true anomalies can be
+ * computed in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeEccentricAnomaly, computeHyperbolicAnomaly
+ * @tparam Real            Real type
+ * @tparam Vector          Vector type
+ * @tparam ResultVector    Vector type of result
+ * @param  meanAnomalies   A vector of N mean anomalies (in radians for elliptic orbits)
+ * @param  eccentricities  A vector of N eccentricities, in range [0, 1) or greater than 1
+ * @param  trueAnomalies   A vector of N true anomalies in radians, in range [0, 2pi)
+ *                         (sized by caller)
+ * @param  policy          Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeTrueAnomaly(const Vector& meanAnomalies,
+                        const Vector& eccentricities,
+                        ResultVector& trueAnomalies,
+                        const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeTrueAnomaly", meanAnomalies.size());
+    assert(eccentricities.size() == meanAnomalies.size());
+    assert(trueAnomalies.size() == meanAnomalies.size());
+    const std::size_t size = meanAnomalies.size();
+    const Real* meanAnomalyData = meanAnomalies.data();
+    const Real* eccentricityData = eccentricities.data();
+    Real* trueAnomalyData = trueAnomalies.data();
+    if (!detail::isElliptic(eccentricityData, size))
+    {
+        detail::executeInChunks([=](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                const Real eccentricity = eccentricityData[i];
+                assert(eccentricity != Real(1));
+                const Real trueAnomaly = eccentricity < Real(1)
+                    ? detail::convertEccentricToTrueAnomaly(
+                          detail::solveEllipticKeplerEquation(meanAnomalyData[i], eccentricity),
+                          eccentricity)
+                    : detail::convertHyperbolicToTrueAnomaly(
+                          detail::solveHyperbolicKeplerEquation(meanAnomalyData[i], eccentricity),
+                          eccentricity);
+                trueAnomalyData[i]
+                    = detail::wrapWithReciprocal(trueAnomaly, twoPi<Real>, Real(1) / twoPi<Real>);
+            }
+        }, size, 3 * sizeof(Real), policy);
+        return;
+    }
+    const detail::EllipticAnomalyKernel<Real, true> kernel
+        = {meanAnomalyData, eccentricityData, trueAnomalyData};
+    detail::executeKernel(kernel, size, 3 * sizeof(Real), policy);
+}
+
+//! Explicitly instantiate batch Kepler-equation solvers for given Real type.
+#define SML_INSTANTIATE_KEPLER_EQUATION(qualifier, Real) \
+    qualifier template void computeEccentricAnomaly<Real, std::vector<Real>, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, std::vector<Real>&, \
+        const ExecutionPolicy&); \
+    qualifier template void computeHyperbolicAnomaly<Real, std::vector<Real>, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, std::vector<Real>&, \
+        const ExecutionPolicy&); \
+    qualifier template void computeTrueAnomaly<Real, std::vector<Real>, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, std::vector<Real>&, \
+        const ExecutionPolicy&);
+
+//! Explicitly instantiate batch Kepler-equation solvers for common types (see sml_compiled).
+#define SML_INSTANTIATE_KEPLER_EQUATION_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_KEPLER_EQUATION(qualifier, double) \
+    SML_INSTANTIATE_KEPLER_EQUATION(qualifier, float)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_KEPLER_EQUATION_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
@@ -6,22 +6,880 @@
 
 #pragma once
 
-#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+#include "sml/tableSearch.hpp"
 
 namespace sml
 {
 
+//! Compute barycentric weights.
+/*!
+ * Computes the barycentric weights for a set of N distinct interpolation nodes, as given by:
+ *
+ * \f[
+ *      w_{j} = \frac{1}{\prod_{k \neq j} (x_{j} - x_{k})}
+ * \f]
+ *
+ * The node differences are scaled by the capacity of the interval spanned by the nodes,
+ * \f$4/(x_{max} - x_{min})\f$, which keeps the weights from overflowing or underflowing as N
+ * grows. This common scale factor cancels out in the barycentric formula.
+ *
+ * Computing the weights costs O(N^2) operations, but only has to be done once for a given set of
+ * nodes. Subsequent interpolation queries cost O(N) operations.
+ *
+ * See Berrut & Trefethen (2004) for more background information:
+ * https://doi.org/10.1137/S0036144502417715
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - copy constructor
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa barycentricInterpolate
+ * @tparam Real    Floating-point type
+ * @tparam Vector  Vector type
+ * @param  xData   A vector of N distinct x-values
+ * @return         Vector of N barycentric weights
+ */
+template <typename Real, typename Vector>
+Vector computeBarycentricWeights(const Vector& xData)
+{
+    Vector weights = xData;
+    if (xData.size() == 0)
+    {
+        return weights;
+    }
+
+    Real minimum = xData[0];
+    Real maximum = xData[0];
+    for (std::size_t i = 1; i < xData.size(); i++)
+    {
+        minimum = xData[i] < minimum ? xData[i] : minimum;
+        maximum = xData[i] > maximum ? xData[i] : maximum;
+    }
+    const Real capacity = maximum > minimum ? Real(4) / (maximum - minimum) : Real(1);
+
+    for (std::size_t j = 0; j < xData.size(); j++)
+    {
+        Real product = 1;
+        for (std::size_t k = 0; k < xData.size(); k++)
+        {
+            if (k != j)
+            {
+                assert(xData[j] != xData[k]);
+                product *= capacity * (xData[j] - xData[k]);
+            }
+        }
+        weights[j] = Real(1) / product;
+    }
+    return weights;
+}
+
+//! Compute barycentric Lagrange interpolation.
+/*!
+ * Computes Lagrange interpolation polynomial to obtain y-value for a specified x-value, using the
+ * second (true) form of the barycentric formula:
+ *
+ * \f[
+ *      p(x) = \frac{\sum_{j=1}^{N} \frac{w_{j}}{x - x_{j}} y_{j}}
+ *                  {\sum_{j=1}^{N} \frac{w_{j}}{x - x_{j}}}
+ * \f]
+ *
+ * If x coincides with one of the nodes, the corresponding y-value is returned exactly.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa computeBarycentricWeights
+ * @tparam Real     Floating-point type
+ * @tparam Vector   Vector type
+ * @param  xData    A vector of N distinct x-values
+ * @param  yData    A vector of N y-values
+ * @param  weights  A vector of N barycentric weights, computed with computeBarycentricWeights()
+ * @param  x        x-value to interpolate at
+ * @return          Interpolated y-value
+ */
+template <typename Real, typename Vector>
+Real barycentricInterpolate(const Vector& xData,
+                            const Vector& yData,
+                            const Vector& weights,
+                            const Real x)
+{
+    assert(xData.size() == yData.size() && xData.size() == weights.size());
+    Real numerator = 0;
+    Real denominator = 0;
+    for (std::size_t j = 0; j < xData.size(); j++)
+    {
+        const Real difference = x - xData[j];
+        if (difference == 0)
+        {
+            return yData[j];
+        }
+        const Real term = weights[j] / difference;
+        numerator += term * yData[j];
+        denominator += term;
+    }
+    return numerator / denominator;
+}
+
+namespace detail
+{
+
+//! Number of queries processed per block in batch interpolation kernels.
+const std::size_t interpolationQueryBlockSize = 32;
+
+//! Number of y-columns processed per pass over the nodes in batch interpolation kernels.
+const std::size_t interpolationColumnBlockSize = 8;
+
+//! Get number of bytes read per query by batch interpolation kernels, to size parallel chunks.
+/*!
+ * @tparam Real         Floating-point type
+ * @param  nodeCount    Number of nodes N
+ * @param  columnCount  Number of y-columns K
+ * @return              Number of bytes of nodes, weights and y-columns read per query
+ */
+template <typename Real>
+std::size_t getInterpolationBytesPerQuery(const std::size_t nodeCount,
+                                          const std::size_t columnCount)
+{
+    return (2 + columnCount) * nodeCount * sizeof(Real);
+}
+
+//! Compute barycentric Lagrange interpolation for batch of queries and y-columns.
+/*!
+ * Kernel for barycentricInterpolateBatch() that operates on contiguous arrays.
+ *
+ * The queries are processed in blocks of fixed size. For each block, the nodes are traversed once
+ * (per group of y-columns), and the barycentric sums are accumulated for all queries in the block
+ * at once. The inner loops run over the queries in the block, have a fixed trip count and no
+ * loop-carried dependencies, so that they are vectorized by the compiler. Queries that coincide
+ * with a node yield non-finite sums, and are resolved afterwards by looking up the node.
+ *
+ * @tparam Real         Floating-point type
+ * @param  xData        Array of N distinct x-values
+ * @param  weights      Array of N barycentric weights
+ * @param  nodeCount    Number of nodes N
+ * @param  yColumns     Array of K pointers to arrays of N y-values
+ * @param  columnCount  Number of y-columns K
+ * @param  queries      Array of Q x-values to interpolate at
+ * @param  queryBegin   Index of first query to interpolate at
+ * @param  queryEnd     Index past last query to interpolate at
+ * @param  results      Array of K pointers to arrays of Q interpolated y-values
+ */
+template <typename Real>
+void barycentricInterpolateKernel(const Real* SML_RESTRICT xData,
+                                  const Real* SML_RESTRICT weights,
+                                  const std::size_t nodeCount,
+                                  const Real* const* yColumns,
+                                  const std::size_t columnCount,
+                                  const Real* SML_RESTRICT queries,
+                                  const std::size_t queryBegin,
+                                  const std::size_t queryEnd,
+                                  Real* const* results)
+{
+    const std::size_t blockSize = interpolationQueryBlockSize;
+    const std::size_t columnBlockSize = interpolationColumnBlockSize;
+
+    Real block[blockSize];
+    Real terms[blockSize];
+    Real denominators[blockSize];
+    Real numerators[columnBlockSize][blockSize];
+
+    for (std::size_t queryStart = queryBegin; queryStart < queryEnd; queryStart += blockSize)
+    {
+        // Pad last block by repeating last query, so that all blocks have the same size.
+        const std::size_t count
+            = queryEnd - queryStart < blockSize ? queryEnd - queryStart : blockSize;
+        for (std::size_t q = 0; q < blockSize; q++)
+        {
+            block[q] = queries[queryStart + (q < count ? q : count - 1)];
+        }
+
+        for (std::size_t columnStart = 0; columnStart < columnCount; columnStart += columnBlockSize)
+        {
+            const std::size_t columns = columnCount - columnStart < columnBlockSize
+                                        ? columnCount - columnStart : columnBlockSize;
+
+            for (std::size_t q = 0; q < blockSize; q++)
+            {
+                denominators[q] = 0;
+            }
+            for (std::size_t c = 0; c < columns; c++)
+            {
+                for (std::size_t q = 0; q < blockSize; q++)
+                {
+                    numerators[c][q] = 0;
+                }
+            }
+
+            for (std::size_t j = 0; j < nodeCount; j++)
+            {
+                const Real node = xData[j];
+                const Real weight = weights[j];
+                SML_SIMD_LOOP
+                for (std::size_t q = 0; q < blockSize; q++)
+                {
+                    terms[q] = weight / (block[q] - node);
+                    denominators[q] += terms[q];
+                }
+                for (std::size_t c = 0; c < columns; c++)
+                {
+                    const Real y = yColumns[columnStart + c][j];
+                    Real* SML_RESTRICT numerator = numerators[c];
+                    SML_SIMD_LOOP
+                    for (std::size_t q = 0; q < blockSize; q++)
+                    {
+                        numerator[q] += terms[q] * y;
+                    }
+                }
+            }
+
+            for (std::size_t q = 0; q < count; q++)
+            {
+                std::size_t node = nodeCount;
+                if (!std::isfinite(denominators[q]))
+                {
+                    for (node = 0; node < nodeCount && xData[node] != block[q]; node++) { }
+                }
+                for (std::size_t c = 0; c < columns; c++)
+                {
+                    results[columnStart + c][queryStart + q]
+                        = node < nodeCount ? yColumns[columnStart + c][node]
+                                           : numerators[c][q] / denominators[q];
+                }
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+//! Compute barycentric Lagrange interpolation for batch of queries and y-columns.
+/*!
+ * Computes Lagrange interpolation polynomials for K functions that share the same N nodes, e.g.,
+ * the components of a state vector, at Q x-values in one pass. The result is the same as calling
+ * barycentricInterpolate() for each of the K y-columns and Q x-values, up to rounding.
+ *
+ * Traversal of the nodes is amortized over blocks of queries and groups of y-columns, and the
+ * inner loops are vectorized across queries by the compiler, e.g., using SSE/AVX instructions.
+ * For the best performance, compile with the target architecture set, e.g., -march=native.
+ *
+ * Note that the vector and matrix types must support the following operation/functions:
+ * - [] (element access operator; for matrices returning a column)
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage; vectors and columns only)
+ *
+ * The x-data, y-columns and weights can be views of a memory-mapped table, e.g., from
+ * MappedInterpolationTable. The results must be sized by the caller to K columns of Q elements
+ * each.
+ *
+ * @sa barycentricInterpolate, computeBarycentricWeights
+ * @tparam Real          Floating-point type
+ * @tparam Vector        Vector type
+ * @tparam Matrix        Matrix type, stored as a collection of columns
+ * @tparam QueryVector   Vector type for queries
+ * @tparam ResultMatrix  Matrix type for results, stored as a collection of columns
+ * @param  xData         A vector of N distinct x-values
+ * @param  yColumns      A collection of K vectors of N y-values
+ * @param  weights       A vector of N barycentric weights, computed with
+ *                       computeBarycentricWeights()
+ * @param  queries       A vector of Q x-values to interpolate at
+ * @param  results       A collection of K vectors of Q interpolated y-values
+ * @param  policy        Execution policy, to interpolate blocks of queries in parallel
+ */
+template <typename Real,
+          typename Vector,
+          typename Matrix,
+          typename QueryVector,
+          typename ResultMatrix>
+void barycentricInterpolateBatch(const Vector& xData,
+                                 const Matrix& yColumns,
+                                 const Vector& weights,
+                                 const QueryVector& queries,
+                                 ResultMatrix& results,
+                                 const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("barycentricInterpolateBatch", queries.size());
+    assert(xData.size() == weights.size() && yColumns.size() == results.size());
+    std::vector<const Real*> yPointers(yColumns.size());
+    std::vector<Real*> resultPointers(results.size());
+    for (std::size_t k = 0; k < yColumns.size(); k++)
+    {
+        assert(yColumns[k].size() == xData.size() && results[k].size() == queries.size());
+        yPointers[k] = yColumns[k].data();
+        resultPointers[k] = results[k].data();
+    }
+    const Real* xPointer = xData.data();
+    const Real* weightPointer = weights.data();
+    const Real* queryPointer = queries.data();
+    const std::size_t nodeCount = xData.size();
+    const std::size_t columnCount = yPointers.size();
+    detail::executeInChunks([&](const std::size_t begin, const std::size_t end)
+    {
+        detail::barycentricInterpolateKernel<Real>(xPointer,
+                                                   weightPointer,
+                                                   nodeCount,
+                                                   yPointers.data(),
+                                                   columnCount,
+                                                   queryPointer,
+                                                   begin,
+                                                   end,
+                                                   resultPointers.data());
+    }, queries.size(), detail::getInterpolationBytesPerQuery<Real>(nodeCount, columnCount), policy);
+}
+
+//! Lagrange interpolator.
+/*!
+ * Lagrange interpolator that precomputes the barycentric weights of a function described by a
+ * collection of N non-evenly distributed (x,y) pairs. The interpolator is constructed once at a
+ * cost of O(N^2) operations, after which each interpolation query costs O(N) operations.
+ *
+ * The interpolating polynomial is identical to the one computed by lagrangeInterpolate(), so the
+ * same remarks apply regarding interpolation near the boundaries of the x-data.
+ *
+ * @sa computeBarycentricWeights, barycentricInterpolate, lagrangeInterpolate
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+class LagrangeInterpolator
+{
+public:
+
+    //! Construct interpolator from function data.
+    /*!
+     * Constructs interpolator from a container of (x,y) pairs, e.g., std::map<Real,Real>. The
+     * x-values must be distinct.
+     *
+     * @tparam FunctionData  Container type with (x,y) pairs describing function
+     * @param  functionData  A collection of N (x,y) pairs to describe a function
+     */
+    template <typename FunctionData>
+    explicit LagrangeInterpolator(const FunctionData& functionData)
+    {
+        xData.reserve(functionData.size());
+        yData.reserve(functionData.size());
+        for (auto& pair : functionData)
+        {
+            xData.push_back(pair.first);
+            yData.push_back(pair.second);
+        }
+        weights = computeBarycentricWeights<Real>(xData);
+    }
+
+    //! Construct interpolator from x- and y-data.
+    /*!
+     * Constructs interpolator from two equal-length vectors of x- and y-values. The x-values must
+     * be distinct.
+     *
+     * @param  someXData  A vector of N distinct x-values
+     * @param  someYData  A vector of N y-values
+     */
+    LagrangeInterpolator(const std::vector<Real>& someXData, const std::vector<Real>& someYData)
+        : xData(someXData),
+          yData(someYData),
+          weights(computeBarycentricWeights<Real>(someXData))
+    {
+        assert(xData.size() == yData.size());
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * Computes interpolated y-value at specified x-value.
+     *
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real interpolate(const Real x) const
+    {
+        SML_PROFILE("LagrangeInterpolator::interpolate", xData.size());
+        return barycentricInterpolate(xData, yData, weights, x);
+    }
+
+    //! Interpolate at batch of x-values.
+    /*!
+     * Computes interpolated y-values at a batch of Q x-values in one pass.
+     *
+     * @sa barycentricInterpolateBatch
+     * @param  queries  A vector of Q x-values to interpolate at
+     * @param  results  A vector of Q interpolated y-values (resized if necessary)
+     * @param  policy   Execution policy
+     */
+    void interpolate(const std::vector<Real>& queries,
+                     std::vector<Real>& results,
+                     const ExecutionPolicy& policy = ExecutionPolicy()) const
+    {
+        SML_PROFILE("LagrangeInterpolator::interpolate(batch)", queries.size());
+        results.resize(queries.size());
+        const Real* yPointer = yData.data();
+        Real* resultPointer = results.data();
+        detail::executeInChunks([&](const std::size_t begin, const std::size_t end)
+        {
+            detail::barycentricInterpolateKernel<Real>(xData.data(),
+                                                       weights.data(),
+                                                       xData.size(),
+                                                       &yPointer,
+                                                       1,
+                                                       queries.data(),
+                                                       begin,
+                                                       end,
+                                                       &resultPointer);
+        }, queries.size(), detail::getInterpolationBytesPerQuery<Real>(xData.size(), 1), policy);
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * @sa interpolate
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real operator()(const Real x) const
+    {
+        return interpolate(x);
+    }
+
+    //! Get x-data.
+    /*!
+     * @return  Vector of x-values (interpolation nodes)
+     */
+    const std::vector<Real>& getXData() const { return xData; }
+
+    //! Get y-data.
+    /*!
+     * @return  Vector of y-values
+     */
+    const std::vector<Real>& getYData() const { return yData; }
+
+    //! Get barycentric weights.
+    /*!
+     * @return  Vector of barycentric weights associated with x-data
+     */
+    const std::vector<Real>& getWeights() const { return weights; }
+
+private:
+
+    //! Vector of x-values (interpolation nodes).
+    std::vector<Real> xData;
+
+    //! Vector of y-values.
+    std::vector<Real> yData;
+
+    //! Vector of barycentric weights.
+    std::vector<Real> weights;
+};
+
+//! Compute Lagrange interpolation on stencil.
+/*!
+ * Computes Lagrange interpolation polynomial through a stencil of M consecutive entries of a table
+ * of (x,y) values, to obtain y-value for a specified x-value. The stencil consists of the entries
+ * [start, start + M). The interpolation costs O(M^2) operations, independent of the size of the
+ * table.
+ *
+ * If x coincides with one of the nodes in the stencil, the corresponding y-value is returned
+ * exactly.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa getStencilStart, LagrangeTableInterpolator
+ * @tparam Real         Floating-point type
+ * @tparam Vector       Vector type
+ * @param  xData        A vector of N distinct x-values
+ * @param  yData        A vector of N y-values
+ * @param  start        Index of first entry of stencil
+ * @param  stencilSize  Number of entries M in stencil
+ * @param  x            x-value to interpolate at
+ * @return              Interpolated y-value
+ */
+template <typename Real, typename Vector>
+Real lagrangeInterpolateStencil(const Vector& xData,
+                                const Vector& yData,
+                                const std::size_t start,
+                                const std::size_t stencilSize,
+                                const Real x)
+{
+    assert(xData.size() == yData.size() && start + stencilSize <= xData.size());
+    const std::size_t end = start + stencilSize;
+    Real result = 0;
+    for (std::size_t j = start; j < end; j++)
+    {
+        Real numerator = 1;
+        Real denominator = 1;
+        for (std::size_t k = start; k < end; k++)
+        {
+            if (k != j)
+            {
+                numerator *= x - xData[k];
+                denominator *= xData[j] - xData[k];
+            }
+        }
+        result += yData[j] * (numerator / denominator);
+    }
+    return result;
+}
+
+//! Lagrange table interpolator.
+/*!
+ * Lagrange interpolator for large tables of (x,y) values with strictly ascending x-values. Instead
+ * of a single global polynomial through all N entries, a polynomial of fixed order M-1 is
+ * constructed through a stencil of M entries centred on the interval that brackets the x-value to
+ * interpolate at. Near the start and end of the table, the stencil is shifted so that it lies
+ * entirely in the table.
+ *
+ * The bracketing interval is found using binary search, which costs O(log N) operations, or by
+ * hunting from a cursor, which costs O(1) operations for successive queries that are close
+ * together, e.g., time-ordered queries. The interpolation itself costs O(M^2) operations.
+ *
+ * By default, the interpolator stores copies of the x- and y-data. Alternatively, the Vector type
+ * can be set to a non-owning view, e.g., ArrayView<const Real>, to interpolate directly on data
+ * that is owned elsewhere, such as a memory-mapped MappedInterpolationTable, without copying it.
+ *
+ * @sa findInterval, huntInterval, getStencilStart, lagrangeInterpolateStencil
+ * @tparam Real    Floating-point type
+ * @tparam Vector  Vector type used to store x- and y-data
+ */
+template <typename Real, typename Vector = std::vector<Real> >
+class LagrangeTableInterpolator
+{
+public:
+
+    //! Construct interpolator from function data.
+    /*!
+     * Constructs interpolator from a container of (x,y) pairs sorted by ascending x-value, e.g.,
+     * std::map<Real,Real>.
+     *
+     * @tparam FunctionData     Container type with (x,y) pairs describing function
+     * @param  functionData     A collection of N (x,y) pairs to describe a function
+     * @param  someStencilSize  Number of entries M (2 <= M <= N) in interpolation stencil
+     */
+    template <typename FunctionData>
+    LagrangeTableInterpolator(const FunctionData& functionData, const std::size_t someStencilSize)
+        : stencilSize(someStencilSize)
+    {
+        xData.reserve(functionData.size());
+        yData.reserve(functionData.size());
+        for (auto& pair : functionData)
+        {
+            xData.push_back(pair.first);
+            yData.push_back(pair.second);
+        }
+        assert(stencilSize >= 2 && stencilSize <= xData.size());
+    }
+
+    //! Construct interpolator from x- and y-data.
+    /*!
+     * Constructs interpolator from two equal-length vectors of x- and y-values. The x-values must
+     * be strictly ascending.
+     *
+     * @param  someXData        A vector of N strictly ascending x-values
+     * @param  someYData        A vector of N y-values
+     * @param  someStencilSize  Number of entries M (2 <= M <= N) in interpolation stencil
+     */
+    LagrangeTableInterpolator(const Vector& someXData,
+                              const Vector& someYData,
+                              const std::size_t someStencilSize)
+        : xData(someXData),
+          yData(someYData),
+          stencilSize(someStencilSize)
+    {
+        assert(xData.size() == yData.size());
+        assert(stencilSize >= 2 && stencilSize <= xData.size());
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * Computes interpolated y-value at specified x-value. The bracketing interval is found using
+     * binary search.
+     *
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real interpolate(const Real x) const
+    {
+        SML_PROFILE("LagrangeTableInterpolator::interpolate", xData.size());
+        return evaluateInterval(findInterval(xData, x), x);
+    }
+
+    //! Interpolate at specified x-value, using cursor.
+    /*!
+     * Computes interpolated y-value at specified x-value. The bracketing interval is found by
+     * hunting from the cursor, which is updated to the index of the bracketing interval. Reusing
+     * the cursor across successive, nearby queries makes the search cost O(1) operations.
+     *
+     * The interpolator itself is not modified, so multiple threads can query the same
+     * interpolator, each with their own cursor.
+     *
+     * @param  x       x-value to interpolate at
+     * @param  cursor  Cursor (index of bracketing interval), e.g., initialized to 0 and reused
+     * @return         Interpolated y-value
+     */
+    Real interpolate(const Real x, std::size_t& cursor) const
+    {
+        SML_PROFILE("LagrangeTableInterpolator::interpolate", xData.size());
+        cursor = huntInterval(xData, x, cursor);
+        return evaluateInterval(cursor, x);
+    }
+
+    //! Interpolate at batch of x-values.
+    /*!
+     * Computes interpolated y-values at a batch of Q x-values. The bracketing intervals are found
+     * by hunting from the interval of the previous query, so ascending (or descending) queries
+     * are the most efficient.
+     *
+     * @param  queries  A vector of Q x-values to interpolate at
+     * @param  results  A vector of Q interpolated y-values (resized if necessary)
+     * @param  policy   Execution policy
+     */
+    void interpolate(const std::vector<Real>& queries,
+                     std::vector<Real>& results,
+                     const ExecutionPolicy& policy = ExecutionPolicy()) const
+    {
+        SML_PROFILE("LagrangeTableInterpolator::interpolate(batch)", queries.size());
+        results.resize(queries.size());
+        detail::executeInChunks([&](const std::size_t begin, const std::size_t end)
+        {
+            std::size_t cursor = 0;
+            for (std::size_t i = begin; i < end; i++)
+            {
+                cursor = huntInterval(xData, queries[i], cursor);
+                results[i] = evaluateInterval(cursor, queries[i]);
+            }
+        }, queries.size(), 2 * stencilSize * sizeof(Real), policy);
+    }
+
+    //! Interpolate at specified x-value.
+    /*!
+     * @sa interpolate
+     * @param  x  x-value to interpolate at
+     * @return    Interpolated y-value
+     */
+    Real operator()(const Real x) const
+    {
+        return interpolate(x);
+    }
+
+    //! Get x-data.
+    /*!
+     * @return  Vector of x-values
+     */
+    const Vector& getXData() const { return xData; }
+
+    //! Get y-data.
+    /*!
+     * @return  Vector of y-values
+     */
+    const Vector& getYData() const { return yData; }
+
+    //! Get stencil size.
+    /*!
+     * @return  Number of entries in interpolation stencil
+     */
+    std::size_t getStencilSize() const { return stencilSize; }
+
+private:
+
+    //! Evaluate interpolation polynomial of stencil around specified interval.
+    /*!
+     * @param  interval  Index of bracketing interval
+     * @param  x         x-value to interpolate at
+     * @return           Interpolated y-value
+     */
+    Real evaluateInterval(const std::size_t interval, const Real x) const
+    {
+        return lagrangeInterpolateStencil(
+            xData, yData, getStencilStart(interval, stencilSize, xData.size()), stencilSize, x);
+    }
+
+    //! Vector of x-values.
+    Vector xData;
+
+    //! Vector of y-values.
+    Vector yData;
+
+    //! Number of entries in interpolation stencil.
+    std::size_t stencilSize;
+};
+
+//! Maximum number of nodes used by adaptive-order Neville interpolation.
+constexpr std::size_t nevilleMaximumNodeCount = 32;
+
+//! Result of adaptive-order interpolation.
+/*!
+ * @sa nevilleInterpolate
+ * @tparam Real  Floating-point type
+ */
+template <typename Real>
+struct AdaptiveInterpolationResult
+{
+    //! Interpolated y-value.
+    Real value;
+
+    //! Estimated absolute error of interpolated y-value.
+    Real errorEstimate;
+
+    //! Order of interpolation polynomial used, i.e., number of nodes used minus 1.
+    std::size_t order;
+
+    //! Flag indicating if estimated error meets requested tolerance.
+    bool isConverged;
+};
+
+//! Compute adaptive-order Neville interpolation, using cursor.
+/*!
+ * Computes interpolated y-value at a specified x-value in a table of (x,y) values with strictly
+ * ascending x-values, raising the order of the interpolation polynomial until the estimated
+ * error meets a requested tolerance. Starting from the node closest to x, nodes are added one at
+ * a time, each time taking the closest remaining node on either side of the stencil. Neville's
+ * algorithm updates the interpolated value for each added node in O(k) operations, where k is
+ * the number of nodes used so far.
+ *
+ * The error is estimated by the larger of the last two corrections that are made when adding a
+ * node, which guards against stopping at a single correction that is accidentally small, e.g.,
+ * where a derivative of the function vanishes. The interpolation stops at the first order for
+ * which this estimate is smaller than or equal to the tolerance, so that smooth data or dense
+ * tables are interpolated at low order, and only the queries that need it pay for higher orders.
+ * The value returned includes the last correction, so it is usually more accurate than the
+ * estimate, but the estimate is not a rigorous bound. If x coincides with a node, the
+ * corresponding y-value is returned exactly, at order 0.
+ *
+ * If the tolerance is not met with maximumOrder+1 nodes (or all N nodes), the result of the
+ * highest order is returned and flagged as not converged. Raising the order on equidistant data
+ * eventually amplifies noise and causes Runge oscillations, so maximumOrder should be moderate.
+ *
+ * The bracketing interval is found by hunting from the cursor, which is updated to the index of
+ * the bracketing interval, so successive, nearby queries cost O(1) operations to locate.
+ *
+ * See Press et al. (2007), Numerical Recipes, Section 3.2, for more background information.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa huntInterval, lagrangeInterpolateStencil
+ * @tparam Real          Floating-point type
+ * @tparam Vector        Vector type
+ * @param  xData         A vector of N >= 2 strictly ascending x-values
+ * @param  yData         A vector of N y-values
+ * @param  x             x-value to interpolate at
+ * @param  tolerance     Requested absolute error of interpolated y-value
+ * @param  maximumOrder  Maximum order of interpolation polynomial (1 <= order < 32)
+ * @param  cursor        Cursor (index of bracketing interval), e.g., initialized to 0 and reused
+ * @return               Interpolated y-value, estimated error and order used
+ */
+template <typename Real, typename Vector>
+AdaptiveInterpolationResult<Real> nevilleInterpolate(const Vector& xData,
+                                                     const Vector& yData,
+                                                     const Real x,
+                                                     const Real tolerance,
+                                                     const std::size_t maximumOrder,
+                                                     std::size_t& cursor)
+{
+    SML_PROFILE("nevilleInterpolate", xData.size());
+    assert(xData.size() == yData.size() && xData.size() >= 2);
+    assert(maximumOrder >= 1 && maximumOrder < nevilleMaximumNodeCount);
+    cursor = huntInterval(xData, x, cursor);
+    const std::size_t tableSize = xData.size();
+    const std::size_t maximumNodeCount
+        = maximumOrder + 1 < tableSize ? maximumOrder + 1 : tableSize;
+
+    // Stencil [lower, upper) grows from the node closest to x. For the nodes in the order they
+    // were added, offsets[i] = x - x_i and values[i] is the value of the polynomial through
+    // nodes i, ..., k-1 at x.
+    Real offsets[nevilleMaximumNodeCount];
+    Real values[nevilleMaximumNodeCount];
+    std::size_t lower = x - xData[cursor] <= xData[cursor + 1] - x ? cursor : cursor + 1;
+    std::size_t upper = lower + 1;
+    offsets[0] = x - xData[lower];
+    values[0] = yData[lower];
+
+    AdaptiveInterpolationResult<Real> result = {values[0], 0, 0, offsets[0] == 0};
+    Real previousCorrection = 0;
+    for (std::size_t k = 1; k < maximumNodeCount && !result.isConverged; k++)
+    {
+        std::size_t node = upper;
+        if (lower > 0 && (upper == tableSize || x - xData[lower - 1] <= xData[upper] - x))
+        {
+            node = --lower;
+        }
+        else
+        {
+            upper++;
+        }
+
+        offsets[k] = x - xData[node];
+        values[k] = yData[node];
+        for (std::size_t i = k; i-- > 0;)
+        {
+            values[i] = (offsets[i] * values[i + 1] - offsets[k] * values[i])
+                        / (offsets[i] - offsets[k]);
+        }
+
+        const Real correction = std::fabs(values[0] - result.value);
+        result.errorEstimate = k == 1 || correction > previousCorrection
+                               ? correction : previousCorrection;
+        previousCorrection = correction;
+        result.value = values[0];
+        result.order = k;
+        result.isConverged = result.errorEstimate <= tolerance;
+    }
+    return result;
+}
+
+//! Compute adaptive-order Neville interpolation.
+/*!
+ * Computes interpolated y-value at a specified x-value in a table of (x,y) values, raising the
+ * order of the interpolation polynomial until the estimated error meets a requested tolerance.
+ * The bracketing interval is found using binary search.
+ *
+ * @sa nevilleInterpolate(const Vector&, const Vector&, const Real, const Real, const std::size_t,
+ *     std::size_t&)
+ * @tparam Real          Floating-point type
+ * @tparam Vector        Vector type
+ * @param  xData         A vector of N >= 2 strictly ascending x-values
+ * @param  yData         A vector of N y-values
+ * @param  x             x-value to interpolate at
+ * @param  tolerance     Requested absolute error of interpolated y-value
+ * @param  maximumOrder  Maximum order of interpolation polynomial (1 <= order < 32)
+ * @return               Interpolated y-value, estimated error and order used
+ */
+template <typename Real, typename Vector>
+AdaptiveInterpolationResult<Real> nevilleInterpolate(const Vector& xData,
+                                                     const Vector& yData,
+                                                     const Real x,
+                                                     const Real tolerance,
+                                                     const std::size_t maximumOrder = 15)
+{
+    std::size_t cursor = findInterval(xData, x);
+    return nevilleInterpolate(xData, yData, x, tolerance, maximumOrder, cursor);
+}
+
 //! Compute Lagrange interpolation.
 /*!
  * Computes Lagrange interpolation polynomial to obtain y-value for a specified x value, given a
  * function described by a collection of N non-evenly distributed (x,y) pairs.
  *
  * Note that this implementation doesn't account for interpolation at boundaries. For the best
- * results, the x-value to interpolate at should be in the center of the x-data.
+ * results, the x-value to interpolate at should be in the center of the x-data. For large tables,
+ * use LagrangeTableInterpolator instead, which interpolates using a fixed-order stencil centred on
+ * the x-value to interpolate at.
+ *
+ * This function recomputes all basis polynomials on every call, which costs O(N^2) operations
+ * per query. To interpolate the same function data repeatedly, use LagrangeInterpolator instead,
+ * which precomputes the barycentric weights and answers each query in O(N) operations.
  *
  * See Wolfram MathWorld for more background information:
  * https://mathworld.wolfram.com/LagrangeInterpolatingPolynomial.html
  *
+ * @sa LagrangeInterpolator, LagrangeTableInterpolator
  * @tparam Real          Floating-point type
  * @tparam FunctionData  Container type with (x,y) pairs describing function
  * @param  functionData  A collection of N (x,y) pairs to describe a function
@@ -31,7 +889,8 @@ namespace sml
 template <typename Real, typename FunctionData>
 Real lagrangeInterpolate(const FunctionData& functionData, const Real x)
 {
-    Real result = 0.0;
+    SML_PROFILE("lagrangeInterpolate", functionData.size());
+    Real result = 0;
     for(auto& pair : functionData)
     {
         Real y = pair.second;
@@ -49,4 +908,35 @@ Real lagrangeInterpolate(const FunctionData& functionData, const Real x)
     return result;
 }
 
-}
\ No newline at end of file
+//! Explicitly instantiate Lagrange interpolation for given Real type.
+#define SML_INSTANTIATE_LAGRANGE_INTERPOLATOR(qualifier, Real) \
+    qualifier template std::vector<Real> computeBarycentricWeights<Real, std::vector<Real> >( \
+        const std::vector<Real>&); \
+    qualifier template Real barycentricInterpolate<Real, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, const std::vector<Real>&, const Real); \
+    qualifier template Real lagrangeInterpolateStencil<Real, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, const std::size_t, const std::size_t, \
+        const Real); \
+    qualifier template Real lagrangeInterpolate<Real, std::map<Real, Real> >( \
+        const std::map<Real, Real>&, const Real); \
+    qualifier template AdaptiveInterpolationResult<Real> \
+        nevilleInterpolate<Real, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, const Real, const Real, \
+        const std::size_t, std::size_t&); \
+    qualifier template AdaptiveInterpolationResult<Real> \
+        nevilleInterpolate<Real, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, const Real, const Real, \
+        const std::size_t); \
+    qualifier template class LagrangeInterpolator<Real>; \
+    qualifier template class LagrangeTableInterpolator<Real>;
+
+//! Explicitly instantiate Lagrange interpolation for common types (see sml_compiled).
+#define SML_INSTANTIATE_LAGRANGE_INTERPOLATOR_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_LAGRANGE_INTERPOLATOR(qualifier, double) \
+    SML_INSTANTIATE_LAGRANGE_INTERPOLATOR(qualifier, float)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_LAGRANGE_INTERPOLATOR_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
@@ -6,9 +6,15 @@
 
 #pragma once
 
-#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "sml/profiling.hpp"
+#include "sml/reduction.hpp"
+#include "sml/vectorTraits.hpp"
 
 namespace sml
 {
@@ -30,19 +36,167 @@ namespace sml
  * - = (equals operator)
  * - .size() (vector length function)
  *
+ * The result is created using VectorTraits, so that fixed-size types, e.g., std::array or
+ * FixedVector, are supported without heap allocation.
+ *
+ * @sa VectorTraits
  * @tparam Vector3  3-Vector type
  * @param  vector1  A 3-vector
  * @param  vector2  A 3-vector
  * @return          Vector resulting from cross-product
  */
 template <typename Vector3>
-Vector3 cross(const Vector3& vector1, const Vector3& vector2)
+constexpr Vector3 cross(const Vector3& vector1, const Vector3& vector2)
+{
+    assert(vector1.size() == 3 && vector2.size() == 3);
+    return VectorTraits<Vector3>::create(vector1[1] * vector2[2] - vector1[2] * vector2[1],
+                                         vector1[2] * vector2[0] - vector1[0] * vector2[2],
+                                         vector1[0] * vector2[1] - vector1[1] * vector2[0]);
+}
+
+//! Compute cross-product of two 3-vectors, using allocator for result.
+/*!
+ * Computes the cross-product of two 3-vectors, and creates the result with a caller-supplied
+ * allocator, e.g., an ArenaAllocator that allocates from a per-thread MonotonicArena, instead of
+ * the default allocator of the Vector3 type. The allocator is passed after the std::allocator_arg
+ * tag, following the convention of allocator-extended constructors in the standard library.
+ *
+ * The allocator must be convertible to the allocator type of Vector3, e.g.,
+ * std::vector<Real, ArenaAllocator<Real>>. Fixed-size types, e.g., std::array or FixedVector,
+ * ignore the allocator.
+ *
+ * @sa cross, VectorTraits, MonotonicArena
+ * @tparam Vector3    3-Vector type
+ * @tparam Allocator  Allocator type
+ * @param  tag        std::allocator_arg
+ * @param  allocator  Allocator to create result with
+ * @param  vector1    A 3-vector
+ * @param  vector2    A 3-vector
+ * @return            Vector resulting from cross-product
+ */
+template <typename Vector3, typename Allocator>
+Vector3 cross(std::allocator_arg_t tag,
+              const Allocator& allocator,
+              const Vector3& vector1,
+              const Vector3& vector2)
 {
+    static_cast<void>(tag);
     assert(vector1.size() == 3 && vector2.size() == 3);
-    Vector3 result(3);
-    result[0] = vector1[1] * vector2[2] - vector1[2] * vector2[1];
-    result[1] = vector1[2] * vector2[0] - vector1[0] * vector2[2];
-    result[2] = vector1[0] * vector2[1] - vector1[1] * vector2[0];
+    return VectorTraits<Vector3>::create(vector1[1] * vector2[2] - vector1[2] * vector2[1],
+                                         vector1[2] * vector2[0] - vector1[0] * vector2[2],
+                                         vector1[0] * vector2[1] - vector1[1] * vector2[0],
+                                         allocator);
+}
+
+//! Compute cross-product of two 3-vectors, writing result to output vector.
+/*!
+ * Computes the cross-product of two 3-vectors, and writes the result to a caller-owned 3-vector,
+ * e.g., a buffer that is reused across iterations, so that no memory is allocated. The output
+ * vector may be one of the input vectors, since all elements are computed before the result is
+ * written.
+ *
+ * Note that the Vector3 and ResultVector3 types must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa cross
+ * @tparam Vector3        3-Vector type
+ * @tparam ResultVector3  3-Vector type of result, e.g., Vector3 or ArrayView
+ * @param  vector1        A 3-vector
+ * @param  vector2        A 3-vector
+ * @param  result         3-vector to write cross-product to
+ */
+template <typename Vector3, typename ResultVector3>
+constexpr void cross(const Vector3& vector1, const Vector3& vector2, ResultVector3& result)
+{
+    assert(vector1.size() == 3 && vector2.size() == 3 && result.size() == 3);
+    const auto x = vector1[1] * vector2[2] - vector1[2] * vector2[1];
+    const auto y = vector1[2] * vector2[0] - vector1[0] * vector2[2];
+    const auto z = vector1[0] * vector2[1] - vector1[1] * vector2[0];
+    result[0] = x;
+    result[1] = y;
+    result[2] = z;
+}
+
+namespace detail
+{
+
+//! Compute dot-product of two equal-length vectors using pairwise or Kahan summation.
+/*!
+ * Unlike dot(), this function cannot be evaluated at compile time, so it can be profiled.
+ *
+ * @sa dot
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  vector1  A vector of length N
+ * @param  vector2  A vector of length N
+ * @param  method   Summation method (pairwise or Kahan)
+ * @return          Scalar resulting from dot-product
+ */
+template <typename Real, typename Vector>
+Real computeBlockedDot(const Vector& vector1,
+                       const Vector& vector2,
+                       const SummationMethod method)
+{
+    const std::size_t size = vector1.size();
+    SML_PROFILE("dot", size);
+    if (method == SummationMethod::kahan)
+    {
+        const CompensatedDotBlock<Real, Vector> block = {vector1, vector2};
+        const CompensatedSum<Real> result = reducePairwise<CompensatedSum<Real> >(block, 0, size);
+        return result.sum + result.error;
+    }
+    const DotBlock<Real, Vector> block = {vector1, vector2};
+    return reducePairwise<Real>(block, 0, size);
+}
+
+} // namespace detail
+
+//! Compute dot-product of two equal-length vectors using specified summation method.
+/*!
+ * Computes the dot-product (inner-product) of two vectors of length N, summing the products
+ * using the specified method:
+ *
+ * - SummationMethod::sequential: the products are summed in order, using a single accumulator.
+ * - SummationMethod::pairwise: the products are summed in blocks of SML_REDUCTION_BLOCK_SIZE
+ *   elements using multiple accumulators, so that SIMD instructions can be used, and the block
+ *   sums are combined pairwise. The rounding error grows as O(log N) instead of O(N).
+ * - SummationMethod::kahan: as pairwise, but the rounding error of each addition is
+ *   accumulated and added to the result (compensated summation), so that the error of the sum
+ *   does not grow with N. This costs about as much as sequential summation, i.e., several times
+ *   as much as pairwise summation for vectors that fit in cache, and is defeated by compiler
+ *   options that reassociate floating-point operations, e.g., -ffast-math.
+ *
+ * The products are summed on the calling thread. To sum them according to an execution policy,
+ * e.g., in parallel, use the overloads in linearAlgebraBatch.hpp.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa dot, SummationMethod
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  vector1  A vector of length N
+ * @param  vector2  A vector of length N
+ * @param  method   Summation method
+ * @return          Scalar resulting from dot-product
+ */
+template <typename Real, typename Vector>
+constexpr Real dot(const Vector& vector1, const Vector& vector2, const SummationMethod method)
+{
+    assert(vector1.size() == vector2.size());
+    const std::size_t size = vector1.size();
+    if (method != SummationMethod::sequential)
+    {
+        return detail::computeBlockedDot<Real>(vector1, vector2, method);
+    }
+
+    Real result = 0;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        result += vector1[i] * vector2[i];
+    }
     return result;
 }
 
@@ -55,10 +209,14 @@ Vector3 cross(const Vector3& vector1, const Vector3& vector2)
  *      r = \sum_{i=1}^{N} X_{i} * Y_{i}
  * \f]
  *
+ * Short vectors (N <= 16) are summed sequentially. Longer vectors are summed pairwise, using
+ * multiple accumulators, on the calling thread.
+ *
  * Note that the Vector type must support the following operation/functions:
  * - [] (element access operator, returning floating-point number)
  * - .size() (vector length function)
  *
+ * @sa SummationMethod
  * @tparam Real     Real type
  * @tparam Vector   Vector type
  * @param  vector1  A vector of length N
@@ -66,15 +224,12 @@ Vector3 cross(const Vector3& vector1, const Vector3& vector2)
  * @return          Scalar resulting from dot-product
  */
 template <typename Real, typename Vector>
-Real dot(const Vector& vector1, const Vector& vector2)
+constexpr Real dot(const Vector& vector1, const Vector& vector2)
 {
-    assert(vector1.size() == vector2.size());
-    Real result = 0.0;
-    for (unsigned int i=0; i < vector1.size(); i++)
-    {
-        result += vector1[i] * vector2[i];
-    }
-    return result;
+    return dot<Real>(vector1,
+                     vector2,
+                     vector1.size() <= detail::sequentialReductionSize
+                        ? SummationMethod::sequential : SummationMethod::pairwise);
 }
 
 //! Compute squared-norm of vector.
@@ -98,11 +253,33 @@ Real dot(const Vector& vector1, const Vector& vector2)
  * @return         Scalar squared-norm of vector
  */
 template <typename Real, typename Vector>
-Real squaredNorm(const Vector& vector)
+constexpr Real squaredNorm(const Vector& vector)
 {
     return dot<Real, Vector>(vector, vector);
 }
 
+//! Compute squared-norm of vector using specified summation method.
+/*!
+ * Computes the square of the Euclidean norm of a vector of length N, summing the squares using
+ * the specified method.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa squaredNorm, dot, SummationMethod
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  method  Summation method
+ * @return         Scalar squared-norm of vector
+ */
+template <typename Real, typename Vector>
+constexpr Real squaredNorm(const Vector& vector, const SummationMethod method)
+{
+    return dot<Real, Vector>(vector, vector, method);
+}
+
 //! Compute norm of vector.
 /*!
  * Computes the Euclidean norm of a vector of length N.
@@ -129,6 +306,125 @@ Real norm(const Vector& vector)
     return std::sqrt(squaredNorm<Real, Vector>(vector));
 }
 
+//! Compute norm of vector using specified summation method.
+/*!
+ * Computes the Euclidean norm of a vector of length N, summing the squares using the specified
+ * method.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa norm, dot, SummationMethod
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  method  Summation method
+ * @return         Scalar norm of vector
+ */
+template <typename Real, typename Vector>
+Real norm(const Vector& vector, const SummationMethod method)
+{
+    return std::sqrt(squaredNorm<Real, Vector>(vector, method));
+}
+
+//! Compute sum of elements of vector using specified summation method.
+/*!
+ * Computes the sum of the elements of a vector of length N, using the specified method (see
+ * dot()). With SummationMethod::kahan, the error of the sum does not grow with N, so that large
+ * data sets, e.g., point clouds, can be stored and summed in single precision, which halves the
+ * memory traffic and doubles the number of SIMD lanes compared to double precision.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa sum, dot, SummationMethod
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  method  Summation method
+ * @return         Sum of elements of vector
+ */
+template <typename Real, typename Vector>
+Real sum(const Vector& vector, const SummationMethod method)
+{
+    SML_PROFILE("sum", vector.size());
+    const std::size_t size = vector.size();
+    if (method == SummationMethod::pairwise)
+    {
+        const detail::SumBlock<Real, Vector> block = {vector};
+        return detail::reducePairwise<Real>(block, 0, size);
+    }
+    if (method == SummationMethod::kahan)
+    {
+        const detail::CompensatedSumBlock<Real, Vector> block = {vector};
+        const detail::CompensatedSum<Real> result
+            = detail::reducePairwise<detail::CompensatedSum<Real> >(block, 0, size);
+        return result.sum + result.error;
+    }
+
+    Real result = 0;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        result += vector[i];
+    }
+    return result;
+}
+
+//! Compute sum of elements of vector.
+/*!
+ * Computes the sum of the elements of a vector of length N. Short vectors (N <= 16) are summed
+ * sequentially. Longer vectors are summed pairwise, using multiple accumulators, on the calling
+ * thread.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa SummationMethod
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @return         Sum of elements of vector
+ */
+template <typename Real, typename Vector>
+Real sum(const Vector& vector)
+{
+    return sum<Real>(vector,
+                     vector.size() <= detail::sequentialReductionSize
+                        ? SummationMethod::sequential : SummationMethod::pairwise);
+}
+
+//! Normalize vector, writing result to output vector.
+/*!
+ * Normalizes vector of length N, and writes the result to a caller-owned vector of length N,
+ * e.g., a buffer that is reused across iterations, so that no memory is allocated. The output
+ * vector may be the input vector.
+ *
+ * Note that the Vector and ResultVector types must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa normalize, normalizeInPlace
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result, e.g., Vector or ArrayView
+ * @param  vector        A vector of length N
+ * @param  result        Vector of length N to write normalized vector to
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void normalize(const Vector& vector, ResultVector& result)
+{
+    SML_PROFILE("normalize", vector.size());
+    assert(result.size() == vector.size());
+    const Real vectorNorm = norm<Real, Vector>(vector);
+    for (std::size_t i = 0; i < vector.size(); i++)
+    {
+        result[i] = vector[i] / vectorNorm;
+    }
+}
+
 //! Normalize vector.
 /*!
  * Normalizes a vector of length N by computing the Euclidean norm of the vector and dividing by
@@ -154,33 +450,84 @@ template <typename Real, typename Vector>
 Vector normalize(const Vector& vector)
 {
     Vector normalizedVector = vector;
-    Real vectorNorm = norm<Real, Vector>(vector);
-    for (unsigned int i=0; i < vector.size(); i++)
-    {
-        normalizedVector[i] = vector[i] / vectorNorm;
-    }
+    normalize<Real>(vector, normalizedVector);
     return normalizedVector;
 }
 
+//! Normalize vector, using allocator for result.
+/*!
+ * Normalizes a vector of length N, and creates the result with a caller-supplied allocator.
+ *
+ * @sa normalize, cross(std::allocator_arg_t, const Allocator&, const Vector3&, const Vector3&)
+ * @tparam Real       Real type
+ * @tparam Vector     Vector type
+ * @tparam Allocator  Allocator type, convertible to allocator type of Vector
+ * @param  tag        std::allocator_arg
+ * @param  allocator  Allocator to create result with
+ * @param  vector     A vector of length N
+ * @return            Normalized vector
+ */
+template <typename Real, typename Vector, typename Allocator>
+Vector normalize(std::allocator_arg_t tag, const Allocator& allocator, const Vector& vector)
+{
+    static_cast<void>(tag);
+    Vector normalizedVector = VectorTraits<Vector>::create(vector.size(), allocator);
+    normalize<Real>(vector, normalizedVector);
+    return normalizedVector;
+}
+
+//! Normalize vector in-place.
+/*!
+ * Normalizes vector of length N in-place, without allocating memory.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa normalize
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N, normalized on return
+ */
+template <typename Real, typename Vector>
+void normalizeInPlace(Vector& vector)
+{
+    normalize<Real>(vector, vector);
+}
+
 //! Get unit-vector in x-direction.
 /*!
  * Returns unit-vector in the x-direction as column vector.
  *
  * Note that the Vector type must support the following operation/functions:
- * - constructor to create object with array of specified length
+ * - constructor to create object with array of specified length (or a VectorTraits
+ *   specialization, e.g., for std::array and FixedVector)
  * - [] (element access operator, returning floating-point number)
  *
+ * @sa VectorTraits
  * @tparam Vector3  Type for 3-vector
  * @return          Unit-vector in x-direction
  */
 template <typename Vector3>
-Vector3 getXUnitVector()
+constexpr Vector3 getXUnitVector()
 {
-    Vector3 xUnitVector(3);
-    xUnitVector[0] = 1.0;
-    xUnitVector[1] = 0.0;
-    xUnitVector[2] = 0.0;
-    return xUnitVector;
+    return VectorTraits<Vector3>::create(1.0, 0.0, 0.0);
+}
+
+//! Get unit-vector in x-direction, using allocator.
+/*!
+ * @sa getXUnitVector
+ * @tparam Vector3    Type for 3-vector
+ * @tparam Allocator  Allocator type, convertible to allocator type of Vector3
+ * @param  tag        std::allocator_arg
+ * @param  allocator  Allocator to create unit-vector with
+ * @return            Unit-vector in x-direction
+ */
+template <typename Vector3, typename Allocator>
+Vector3 getXUnitVector(std::allocator_arg_t tag, const Allocator& allocator)
+{
+    static_cast<void>(tag);
+    return VectorTraits<Vector3>::create(1.0, 0.0, 0.0, allocator);
 }
 
 //! Get unit-vector in y-direction.
@@ -188,20 +535,34 @@ Vector3 getXUnitVector()
  * Returns unit-vector in the y-direction as column vector.
  *
  * Note that the Vector type must support the following operation/functions:
- * - constructor to create object with array of specified length
+ * - constructor to create object with array of specified length (or a VectorTraits
+ *   specialization, e.g., for std::array and FixedVector)
  * - [] (element access operator, returning floating-point number)
  *
+ * @sa VectorTraits
  * @tparam Vector3  Type for 3-vector
  * @return          Unit-vector in y-direction
  */
 template <typename Vector3>
-Vector3 getYUnitVector()
+constexpr Vector3 getYUnitVector()
+{
+    return VectorTraits<Vector3>::create(0.0, 1.0, 0.0);
+}
+
+//! Get unit-vector in y-direction, using allocator.
+/*!
+ * @sa getYUnitVector
+ * @tparam Vector3    Type for 3-vector
+ * @tparam Allocator  Allocator type, convertible to allocator type of Vector3
+ * @param  tag        std::allocator_arg
+ * @param  allocator  Allocator to create unit-vector with
+ * @return            Unit-vector in y-direction
+ */
+template <typename Vector3, typename Allocator>
+Vector3 getYUnitVector(std::allocator_arg_t tag, const Allocator& allocator)
 {
-    Vector3 yUnitVector(3);
-    yUnitVector[0] = 0.0;
-    yUnitVector[1] = 1.0;
-    yUnitVector[2] = 0.0;
-    return yUnitVector;
+    static_cast<void>(tag);
+    return VectorTraits<Vector3>::create(0.0, 1.0, 0.0, allocator);
 }
 
 //! Get unit-vector in z-direction.
@@ -209,20 +570,62 @@ Vector3 getYUnitVector()
  * Returns unit-vector in the z-direction as column vector.
  *
  * Note that the Vector type must support the following operation/functions:
- * - constructor to create object with array of specified length
+ * - constructor to create object with array of specified length (or a VectorTraits
+ *   specialization, e.g., for std::array and FixedVector)
  * - [] (element access operator, returning floating-point number)
  *
+ * @sa VectorTraits
  * @tparam Vector3  Type for 3-vector
  * @return          Unit-vector in z-direction
  */
 template <typename Vector3>
-Vector3 getZUnitVector()
+constexpr Vector3 getZUnitVector()
+{
+    return VectorTraits<Vector3>::create(0.0, 0.0, 1.0);
+}
+
+//! Get unit-vector in z-direction, using allocator.
+/*!
+ * @sa getZUnitVector
+ * @tparam Vector3    Type for 3-vector
+ * @tparam Allocator  Allocator type, convertible to allocator type of Vector3
+ * @param  tag        std::allocator_arg
+ * @param  allocator  Allocator to create unit-vector with
+ * @return            Unit-vector in z-direction
+ */
+template <typename Vector3, typename Allocator>
+Vector3 getZUnitVector(std::allocator_arg_t tag, const Allocator& allocator)
+{
+    static_cast<void>(tag);
+    return VectorTraits<Vector3>::create(0.0, 0.0, 1.0, allocator);
+}
+
+//! Multiply by scalar element-wise, writing result to output vector.
+/*!
+ * Multiply each element of a vector of length N by a scalar, and write the result to a
+ * caller-owned vector of length N, e.g., a buffer that is reused across iterations, so that no
+ * memory is allocated. The output vector may be the input vector.
+ *
+ * Note that the Vector and ResultVector types must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa multiply, multiplyInPlace
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result, e.g., Vector or ArrayView
+ * @param  vector        Vector to multiply element-wise
+ * @param  multiplier    Multiplier to multiply vector element-wise
+ * @param  result        Vector of length N to write result to
+ */
+template <typename Real, typename Vector, typename ResultVector>
+constexpr void multiply(const Vector& vector, const Real multiplier, ResultVector& result)
 {
-    Vector3 zUnitVector(3);
-    zUnitVector[0] = 0.0;
-    zUnitVector[1] = 0.0;
-    zUnitVector[2] = 1.0;
-    return zUnitVector;
+    assert(result.size() == vector.size());
+    for (std::size_t i = 0; i < vector.size(); i++)
+    {
+        result[i] = multiplier * vector[i];
+    }
 }
 
 //! Multiply by scalar element-wise.
@@ -241,14 +644,83 @@ Vector3 getZUnitVector()
  * @return             Vector multiplied element-wise
  */
 template <typename Real, typename Vector>
-Vector multiply(const Vector& vector, const Real multiplier)
+constexpr Vector multiply(const Vector& vector, const Real multiplier)
 {
     Vector result = vector;
-    for (unsigned int i=0; i < vector.size(); i++)
+    multiply(vector, multiplier, result);
+    return result;
+}
+
+//! Multiply by scalar element-wise, using allocator for result.
+/*!
+ * @sa multiply
+ * @tparam Real        Real type
+ * @tparam Vector      Vector type
+ * @tparam Allocator   Allocator type, convertible to allocator type of Vector
+ * @param  tag         std::allocator_arg
+ * @param  allocator   Allocator to create result with
+ * @param  vector      Vector to multiply element-wise
+ * @param  multiplier  Multiplier to multiply vector element-wise
+ * @return             Vector multiplied element-wise
+ */
+template <typename Real, typename Vector, typename Allocator>
+Vector multiply(std::allocator_arg_t tag,
+                const Allocator& allocator,
+                const Vector& vector,
+                const Real multiplier)
+{
+    static_cast<void>(tag);
+    Vector result = VectorTraits<Vector>::create(vector.size(), allocator);
+    multiply(vector, multiplier, result);
+    return result;
+}
+
+//! Multiply by scalar element-wise in-place.
+/*!
+ * Multiply each element of a vector of length N by a scalar in-place, without allocating memory.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa multiply
+ * @tparam Real        Real type
+ * @tparam Vector      Vector type
+ * @param  vector      Vector to multiply element-wise
+ * @param  multiplier  Multiplier to multiply vector element-wise
+ */
+template <typename Real, typename Vector>
+constexpr void multiplyInPlace(Vector& vector, const Real multiplier)
+{
+    multiply(vector, multiplier, vector);
+}
+
+//! Add scalar element-wise, writing result to output vector.
+/*!
+ * Add a scalar to each element of a vector of length N, and write the result to a caller-owned
+ * vector of length N, e.g., a buffer that is reused across iterations, so that no memory is
+ * allocated. The output vector may be the input vector.
+ *
+ * Note that the Vector and ResultVector types must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa add, addInPlace
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result, e.g., Vector or ArrayView
+ * @param  vector        Vector to add to element-wise
+ * @param  adder         Scalar to add element-wise
+ * @param  result        Vector of length N to write result to
+ */
+template <typename Real, typename Vector, typename ResultVector>
+constexpr void add(const Vector& vector, const Real adder, ResultVector& result)
+{
+    assert(result.size() == vector.size());
+    for (std::size_t i = 0; i < vector.size(); i++)
     {
-        result[i] = multiplier * vector[i];
+        result[i] = adder + vector[i];
     }
-    return result;
 }
 
 //! Add scalar element-wise.
@@ -267,14 +739,82 @@ Vector multiply(const Vector& vector, const Real multiplier)
  * @return         Vector added to element-wise
  */
 template <typename Real, typename Vector>
-Vector add(const Vector& vector, const Real adder)
+constexpr Vector add(const Vector& vector, const Real adder)
 {
     Vector result = vector;
-    for (unsigned int i=0; i < vector.size(); i++)
+    add(vector, adder, result);
+    return result;
+}
+
+//! Add scalar element-wise, using allocator for result.
+/*!
+ * @sa add
+ * @tparam Real       Real type
+ * @tparam Vector     Vector type
+ * @tparam Allocator  Allocator type, convertible to allocator type of Vector
+ * @param  tag        std::allocator_arg
+ * @param  allocator  Allocator to create result with
+ * @param  vector     Vector to add to element-wise
+ * @param  adder      Scalar to add element-wise
+ * @return            Vector added to element-wise
+ */
+template <typename Real, typename Vector, typename Allocator>
+Vector add(std::allocator_arg_t tag,
+           const Allocator& allocator,
+           const Vector& vector,
+           const Real adder)
+{
+    static_cast<void>(tag);
+    Vector result = VectorTraits<Vector>::create(vector.size(), allocator);
+    add(vector, adder, result);
+    return result;
+}
+
+//! Add scalar element-wise in-place.
+/*!
+ * Add a scalar to each element of a vector of length N in-place, without allocating memory.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa add
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  Vector to add to element-wise
+ * @param  adder   Scalar to add element-wise
+ */
+template <typename Real, typename Vector>
+constexpr void addInPlace(Vector& vector, const Real adder)
+{
+    add(vector, adder, vector);
+}
+
+//! Add two vectors element-wise, writing result to output vector.
+/*!
+ * Add two vectors of length N element-wise, and write the result to a caller-owned vector of
+ * length N, e.g., a buffer that is reused across iterations, so that no memory is allocated. The
+ * output vector may be one of the input vectors.
+ *
+ * Note that the Vector and ResultVector types must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa add, addInPlace
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result, e.g., Vector or ArrayView
+ * @param  vector1       A vector to add to element-wise
+ * @param  vector2       A vector to add to element-wise
+ * @param  result        Vector of length N to write result to
+ */
+template <typename Vector, typename ResultVector>
+constexpr void add(const Vector& vector1, const Vector& vector2, ResultVector& result)
+{
+    assert(vector1.size() == vector2.size() && result.size() == vector1.size());
+    for (std::size_t i = 0; i < vector1.size(); i++)
     {
-        result[i] = adder + vector[i];
+        result[i] = vector1[i] + vector2[i];
     }
-    return result;
 }
 
 //! Add two vectors element-wise.
@@ -292,15 +832,80 @@ Vector add(const Vector& vector, const Real adder)
  * @return          Vector resulting from element-wise addition of two vectors
  */
 template <typename Vector>
-Vector add(const Vector& vector1, const Vector& vector2)
+constexpr Vector add(const Vector& vector1, const Vector& vector2)
 {
-    assert(vector1.size() == vector2.size());
     Vector result = vector1;
-    for (unsigned int i = 0; i <vector1.size(); i++)
-    {
-        result[i] = vector1[i] + vector2[i];
-    }
+    add(vector1, vector2, result);
+    return result;
+}
+
+//! Add two vectors element-wise, using allocator for result.
+/*!
+ * @sa add
+ * @tparam Vector     Vector type
+ * @tparam Allocator  Allocator type, convertible to allocator type of Vector
+ * @param  tag        std::allocator_arg
+ * @param  allocator  Allocator to create result with
+ * @param  vector1    A vector to add to element-wise
+ * @param  vector2    A vector to add to element-wise
+ * @return            Vector resulting from element-wise addition of two vectors
+ */
+template <typename Vector, typename Allocator>
+Vector add(std::allocator_arg_t tag,
+           const Allocator& allocator,
+           const Vector& vector1,
+           const Vector& vector2)
+{
+    static_cast<void>(tag);
+    Vector result = VectorTraits<Vector>::create(vector1.size(), allocator);
+    add(vector1, vector2, result);
     return result;
 }
 
+//! Add vector element-wise in-place.
+/*!
+ * Add a vector of length N element-wise to another vector of length N in-place, without
+ * allocating memory.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa add
+ * @tparam Vector   Vector type
+ * @param  vector1  A vector to add to element-wise, containing the sum on return
+ * @param  vector2  A vector to add to element-wise
+ */
+template <typename Vector>
+constexpr void addInPlace(Vector& vector1, const Vector& vector2)
+{
+    add(vector1, vector2, vector1);
+}
+
+//! Explicitly instantiate linear-algebra functions for given Real and Vector types.
+#define SML_INSTANTIATE_LINEAR_ALGEBRA(qualifier, Real, ...) \
+    qualifier template Real detail::computeBlockedDot<Real, __VA_ARGS__>( \
+        const __VA_ARGS__&, const __VA_ARGS__&, const SummationMethod); \
+    qualifier template Real norm<Real, __VA_ARGS__>(const __VA_ARGS__&); \
+    qualifier template Real norm<Real, __VA_ARGS__>(const __VA_ARGS__&, const SummationMethod); \
+    qualifier template Real sum<Real, __VA_ARGS__>(const __VA_ARGS__&); \
+    qualifier template Real sum<Real, __VA_ARGS__>(const __VA_ARGS__&, const SummationMethod); \
+    qualifier template void normalize<Real, __VA_ARGS__, __VA_ARGS__>( \
+        const __VA_ARGS__&, __VA_ARGS__&); \
+    qualifier template __VA_ARGS__ normalize<Real, __VA_ARGS__>(const __VA_ARGS__&); \
+    qualifier template void normalizeInPlace<Real, __VA_ARGS__>(__VA_ARGS__&);
+
+//! Explicitly instantiate linear-algebra functions for common types (see sml_compiled).
+/*!
+ * Only dynamic-size vectors are instantiated. Functions of fixed-size vectors, e.g.,
+ * std::array<Real, 3>, are left to the headers, so that they are inlined at each call.
+ */
+#define SML_INSTANTIATE_LINEAR_ALGEBRA_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_LINEAR_ALGEBRA(qualifier, double, std::vector<double>) \
+    SML_INSTANTIATE_LINEAR_ALGEBRA(qualifier, float, std::vector<float>)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_LINEAR_ALGEBRA_FOR_COMMON_TYPES(extern)
+#endif
+
 } // namespace sml
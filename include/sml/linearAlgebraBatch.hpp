@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "sml/executionPolicy.hpp"
+#include "sml/linearAlgebra.hpp"
+#include "sml/profiling.hpp"
+#include "sml/reduction.hpp"
+
+// Overloads of the reductions in linearAlgebra.hpp (dot(), squaredNorm(), norm() and sum()) that
+// take an execution policy, so that reductions of long vectors can run on a thread pool. They are
+// kept out of linearAlgebra.hpp, so that code that only uses the scalar functions does not depend
+// on the thread pool.
+
+namespace sml
+{
+
+namespace detail
+{
+
+//! Split range of reduction into ranges of subtrees that are reduced as separate tasks.
+/*!
+ * Splits the range [begin, end) at the same indices as reducePairwise(), until the ranges have at
+ * most chunkSize elements or fit in a single block, and appends the first index of each range.
+ *
+ * @param  begin       Index of first element
+ * @param  end         Index past last element
+ * @param  chunkSize   Maximum number of elements per task
+ * @param  boundaries  Indices of first elements of ranges, appended to
+ */
+inline void splitReduction(const std::size_t begin,
+                           const std::size_t end,
+                           const std::size_t chunkSize,
+                           std::vector<std::size_t>& boundaries)
+{
+    if (end - begin <= chunkSize || end - begin <= SML_REDUCTION_BLOCK_SIZE)
+    {
+        boundaries.push_back(begin);
+        return;
+    }
+    const std::size_t middle = getReductionMiddle(begin, end);
+    splitReduction(begin, middle, chunkSize, boundaries);
+    splitReduction(middle, end, chunkSize, boundaries);
+}
+
+//! Combine results of subtrees of reduction pairwise.
+/*!
+ * Combines the results of the ranges found by splitReduction() in the same binary tree as
+ * reducePairwise().
+ *
+ * @tparam Result     Result type (Real or CompensatedSum)
+ * @param  begin      Index of first element
+ * @param  end        Index past last element
+ * @param  chunkSize  Maximum number of elements per task
+ * @param  results    Results of ranges, in order
+ * @param  index      Index of result of next range, incremented for each range combined
+ * @return            Reduced result
+ */
+template <typename Result>
+Result combineReduction(const std::size_t begin,
+                        const std::size_t end,
+                        const std::size_t chunkSize,
+                        const std::vector<Result>& results,
+                        std::size_t& index)
+{
+    if (end - begin <= chunkSize || end - begin <= SML_REDUCTION_BLOCK_SIZE)
+    {
+        return results[index++];
+    }
+    const std::size_t middle = getReductionMiddle(begin, end);
+    const Result first = combineReduction(begin, middle, chunkSize, results, index);
+    return combineSums(first, combineReduction(middle, end, chunkSize, results, index));
+}
+
+//! Reduce range pairwise, according to execution policy.
+/*!
+ * As reducePairwise(block, begin, end), but if the execution policy specifies a parallel mode,
+ * the subtrees at the top of the tree are reduced as tasks on the executor of the policy, with
+ * one chunk of elements per task (see computeChunkSize()). Their results are combined pairwise
+ * on the calling thread. Since the tree only depends on the length of the range, the result does
+ * not depend on the execution policy.
+ *
+ * @tparam Result           Result type (Real or CompensatedSum)
+ * @tparam Block            Block function type, with operator()(begin, end) returning Result
+ * @param  block            Block function
+ * @param  begin            Index of first element
+ * @param  end              Index past last element
+ * @param  bytesPerElement  Number of bytes read per element
+ * @param  policy           Execution policy
+ * @return                  Reduced result
+ */
+template <typename Result, typename Block>
+Result reducePairwise(const Block& block,
+                      const std::size_t begin,
+                      const std::size_t end,
+                      const std::size_t bytesPerElement,
+                      const ExecutionPolicy& policy)
+{
+    if (policy.getMode() == ExecutionMode::sequential)
+    {
+        return reducePairwise<Result>(block, begin, end);
+    }
+    Executor& executor = policy.getExecutor();
+    const std::size_t chunkSize = policy.getChunkSize() > 0
+        ? policy.getChunkSize()
+        : computeChunkSize(end - begin, bytesPerElement, executor.getConcurrency());
+    std::vector<std::size_t> boundaries;
+    splitReduction(begin, end, chunkSize, boundaries);
+    const std::size_t taskCount = boundaries.size();
+    if (taskCount == 1)
+    {
+        return reducePairwise<Result>(block, begin, end);
+    }
+    boundaries.push_back(end);
+
+    std::vector<Result> results(taskCount);
+    executor.parallelFor(taskCount, [&block, &boundaries, &results](const std::size_t task)
+    {
+        results[task] = reducePairwise<Result>(block, boundaries[task], boundaries[task + 1]);
+    });
+    std::size_t index = 0;
+    return combineReduction(begin, end, chunkSize, results, index);
+}
+
+//! Compute dot-product of two equal-length vectors using pairwise or Kahan summation.
+/*!
+ * As computeBlockedDot(vector1, vector2, method), according to execution policy.
+ *
+ * @sa dot
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  vector1  A vector of length N
+ * @param  vector2  A vector of length N
+ * @param  method   Summation method (pairwise or Kahan)
+ * @param  policy   Execution policy
+ * @return          Scalar resulting from dot-product
+ */
+template <typename Real, typename Vector>
+Real computeBlockedDot(const Vector& vector1,
+                       const Vector& vector2,
+                       const SummationMethod method,
+                       const ExecutionPolicy& policy)
+{
+    const std::size_t size = vector1.size();
+    SML_PROFILE("dot", size);
+    if (method == SummationMethod::kahan)
+    {
+        const CompensatedDotBlock<Real, Vector> block = {vector1, vector2};
+        const CompensatedSum<Real> result = reducePairwise<CompensatedSum<Real> >(
+            block, 0, size, 2 * sizeof(Real), policy);
+        return result.sum + result.error;
+    }
+    const DotBlock<Real, Vector> block = {vector1, vector2};
+    return reducePairwise<Real>(block, 0, size, 2 * sizeof(Real), policy);
+}
+
+} // namespace detail
+
+//! Compute dot-product of two equal-length vectors using specified summation method and policy.
+/*!
+ * Computes the dot-product of two vectors of length N, as dot(vector1, vector2, method). For
+ * pairwise and Kahan summation, an execution policy with a parallel mode sums the subtrees at the
+ * top of the pairwise tree as tasks on its executor (see ExecutionPolicy). The tree only depends
+ * on N, so the result does not depend on the execution policy. Sequential summation always runs
+ * on the calling thread.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa dot, SummationMethod, ExecutionPolicy
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  vector1  A vector of length N
+ * @param  vector2  A vector of length N
+ * @param  method   Summation method
+ * @param  policy   Execution policy
+ * @return          Scalar resulting from dot-product
+ */
+template <typename Real, typename Vector>
+Real dot(const Vector& vector1,
+         const Vector& vector2,
+         const SummationMethod method,
+         const ExecutionPolicy& policy)
+{
+    assert(vector1.size() == vector2.size());
+    if (method == SummationMethod::sequential)
+    {
+        return dot<Real>(vector1, vector2, method);
+    }
+    return detail::computeBlockedDot<Real>(vector1, vector2, method, policy);
+}
+
+//! Compute dot-product of two equal-length vectors according to execution policy.
+/*!
+ * Computes the dot-product of two vectors of length N, as dot(vector1, vector2), with the
+ * pairwise sum of long vectors run according to the execution policy.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa dot, ExecutionPolicy
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  vector1  A vector of length N
+ * @param  vector2  A vector of length N
+ * @param  policy   Execution policy
+ * @return          Scalar resulting from dot-product
+ */
+template <typename Real, typename Vector>
+Real dot(const Vector& vector1, const Vector& vector2, const ExecutionPolicy& policy)
+{
+    return dot<Real>(vector1,
+                     vector2,
+                     vector1.size() <= detail::sequentialReductionSize
+                        ? SummationMethod::sequential : SummationMethod::pairwise,
+                     policy);
+}
+
+//! Compute squared-norm of vector according to execution policy.
+/*!
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa squaredNorm, dot, ExecutionPolicy
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  policy  Execution policy
+ * @return         Scalar squared-norm of vector
+ */
+template <typename Real, typename Vector>
+Real squaredNorm(const Vector& vector, const ExecutionPolicy& policy)
+{
+    return dot<Real, Vector>(vector, vector, policy);
+}
+
+//! Compute squared-norm of vector using specified summation method and execution policy.
+/*!
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa squaredNorm, dot, SummationMethod, ExecutionPolicy
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  method  Summation method
+ * @param  policy  Execution policy
+ * @return         Scalar squared-norm of vector
+ */
+template <typename Real, typename Vector>
+Real squaredNorm(const Vector& vector, const SummationMethod method, const ExecutionPolicy& policy)
+{
+    return dot<Real, Vector>(vector, vector, method, policy);
+}
+
+//! Compute norm of vector according to execution policy.
+/*!
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa norm, dot, ExecutionPolicy
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  policy  Execution policy
+ * @return         Scalar norm of vector
+ */
+template <typename Real, typename Vector>
+Real norm(const Vector& vector, const ExecutionPolicy& policy)
+{
+    return std::sqrt(squaredNorm<Real, Vector>(vector, policy));
+}
+
+//! Compute norm of vector using specified summation method and execution policy.
+/*!
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa norm, dot, SummationMethod, ExecutionPolicy
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  method  Summation method
+ * @param  policy  Execution policy
+ * @return         Scalar norm of vector
+ */
+template <typename Real, typename Vector>
+Real norm(const Vector& vector, const SummationMethod method, const ExecutionPolicy& policy)
+{
+    return std::sqrt(squaredNorm<Real, Vector>(vector, method, policy));
+}
+
+//! Compute sum of elements of vector using specified summation method and execution policy.
+/*!
+ * Computes the sum of the elements of a vector of length N, as sum(vector, method). As for
+ * dot(), the execution policy only affects pairwise and Kahan summation, and does not affect the
+ * result.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa sum, dot, SummationMethod, ExecutionPolicy
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  method  Summation method
+ * @param  policy  Execution policy
+ * @return         Sum of elements of vector
+ */
+template <typename Real, typename Vector>
+Real sum(const Vector& vector, const SummationMethod method, const ExecutionPolicy& policy)
+{
+    if (method == SummationMethod::sequential)
+    {
+        return sum<Real>(vector, method);
+    }
+    SML_PROFILE("sum", vector.size());
+    const std::size_t size = vector.size();
+    if (method == SummationMethod::kahan)
+    {
+        const detail::CompensatedSumBlock<Real, Vector> block = {vector};
+        const detail::CompensatedSum<Real> result = detail::reducePairwise<
+            detail::CompensatedSum<Real> >(block, 0, size, sizeof(Real), policy);
+        return result.sum + result.error;
+    }
+    const detail::SumBlock<Real, Vector> block = {vector};
+    return detail::reducePairwise<Real>(block, 0, size, sizeof(Real), policy);
+}
+
+//! Compute sum of elements of vector according to execution policy.
+/*!
+ * Computes the sum of the elements of a vector of length N, as sum(vector), with the pairwise sum
+ * of long vectors run according to the execution policy.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa sum, SummationMethod, ExecutionPolicy
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ * @param  vector  A vector of length N
+ * @param  policy  Execution policy
+ * @return         Sum of elements of vector
+ */
+template <typename Real, typename Vector>
+Real sum(const Vector& vector, const ExecutionPolicy& policy)
+{
+    return sum<Real>(vector,
+                     vector.size() <= detail::sequentialReductionSize
+                        ? SummationMethod::sequential : SummationMethod::pairwise,
+                     policy);
+}
+
+//! Explicitly instantiate reductions with execution policy for given Real and Vector types.
+#define SML_INSTANTIATE_LINEAR_ALGEBRA_BATCH(qualifier, Real, ...) \
+    qualifier template Real detail::computeBlockedDot<Real, __VA_ARGS__>( \
+        const __VA_ARGS__&, const __VA_ARGS__&, const SummationMethod, const ExecutionPolicy&); \
+    qualifier template Real norm<Real, __VA_ARGS__>(const __VA_ARGS__&, const ExecutionPolicy&); \
+    qualifier template Real norm<Real, __VA_ARGS__>( \
+        const __VA_ARGS__&, const SummationMethod, const ExecutionPolicy&); \
+    qualifier template Real sum<Real, __VA_ARGS__>(const __VA_ARGS__&, const ExecutionPolicy&); \
+    qualifier template Real sum<Real, __VA_ARGS__>( \
+        const __VA_ARGS__&, const SummationMethod, const ExecutionPolicy&);
+
+//! Explicitly instantiate reductions with execution policy for common types (see sml_compiled).
+#define SML_INSTANTIATE_LINEAR_ALGEBRA_BATCH_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_LINEAR_ALGEBRA_BATCH(qualifier, double, std::vector<double>) \
+    SML_INSTANTIATE_LINEAR_ALGEBRA_BATCH(qualifier, float, std::vector<float>)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_LINEAR_ALGEBRA_BATCH_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
@@ -0,0 +1,509 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+#include "sml/vector3Batch.hpp"
+#include "sml/vectorTraits.hpp"
+
+namespace sml
+{
+
+//! 3x3 matrix.
+/*!
+ * Matrix of 3x3 elements that are stored inline in row-major order, i.e., without heap
+ * allocation. The matrix is an aggregate and a literal type, so it can be brace-initialized (row
+ * by row) and used in constant expressions:
+ *
+ * \code
+ *      constexpr Matrix3<double> matrix = {{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}}};
+ * \endcode
+ *
+ * Matrices are typically used to rotate 3-vectors, e.g., to transform positions between
+ * reference frames (see getXRotationMatrix() and multiply()).
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct Matrix3
+{
+    //! Element type.
+    typedef Real value_type;
+
+    //! Access element.
+    /*!
+     * @param  row     Index of row (< 3)
+     * @param  column  Index of column (< 3)
+     * @return         Reference to element
+     */
+    constexpr Real& operator()(const std::size_t row, const std::size_t column)
+    {
+        return elements[row][column];
+    }
+
+    //! Access element.
+    /*!
+     * @param  row     Index of row (< 3)
+     * @param  column  Index of column (< 3)
+     * @return         Const reference to element
+     */
+    constexpr const Real& operator()(const std::size_t row, const std::size_t column) const
+    {
+        return elements[row][column];
+    }
+
+    //! Elements of matrix, stored row by row.
+    Real elements[3][3];
+};
+
+//! Compare 3x3 matrices for equality.
+/*!
+ * @tparam Real     Real type
+ * @param  matrix1  A 3x3 matrix
+ * @param  matrix2  A 3x3 matrix
+ * @return          True if all elements are equal
+ */
+template <typename Real>
+constexpr bool operator==(const Matrix3<Real>& matrix1, const Matrix3<Real>& matrix2)
+{
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        for (std::size_t j = 0; j < 3; j++)
+        {
+            if (matrix1(i, j) != matrix2(i, j))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+//! Compare 3x3 matrices for inequality.
+/*!
+ * @tparam Real     Real type
+ * @param  matrix1  A 3x3 matrix
+ * @param  matrix2  A 3x3 matrix
+ * @return          True if any element differs
+ */
+template <typename Real>
+constexpr bool operator!=(const Matrix3<Real>& matrix1, const Matrix3<Real>& matrix2)
+{
+    return !(matrix1 == matrix2);
+}
+
+//! Get 3x3 identity matrix.
+/*!
+ * @tparam Real  Real type
+ * @return       Identity matrix
+ */
+template <typename Real>
+constexpr Matrix3<Real> getIdentityMatrix()
+{
+    return Matrix3<Real>{{{Real(1), Real(0), Real(0)},
+                          {Real(0), Real(1), Real(0)},
+                          {Real(0), Real(0), Real(1)}}};
+}
+
+//! Get matrix for rotation about x-axis.
+/*!
+ * Returns the matrix that rotates a 3-vector by an angle about the x-axis, counter-clockwise when
+ * looking down the axis towards the origin (right-hand rule):
+ *
+ * \f[
+ *      R_{x}(\theta) = \begin{pmatrix} 1 & 0 & 0 \\
+ *                                      0 & \cos\theta & -\sin\theta \\
+ *                                      0 & \sin\theta & \cos\theta \end{pmatrix}
+ * \f]
+ *
+ * To transform the components of a 3-vector to a reference frame that is rotated by an angle
+ * about the x-axis (a passive rotation), use the transpose, i.e., the rotation by minus the angle.
+ *
+ * @sa getYRotationMatrix, getZRotationMatrix, transpose
+ * @tparam Real   Real type
+ * @param  angle  Rotation angle in radians
+ * @return        Rotation matrix
+ */
+template <typename Real>
+Matrix3<Real> getXRotationMatrix(const Real angle)
+{
+    const Real cosine = std::cos(angle);
+    const Real sine = std::sin(angle);
+    return Matrix3<Real>{{{Real(1), Real(0), Real(0)},
+                          {Real(0), cosine, -sine},
+                          {Real(0), sine, cosine}}};
+}
+
+//! Get matrix for rotation about y-axis.
+/*!
+ * Returns the matrix that rotates a 3-vector by an angle about the y-axis, counter-clockwise when
+ * looking down the axis towards the origin (right-hand rule):
+ *
+ * \f[
+ *      R_{y}(\theta) = \begin{pmatrix} \cos\theta & 0 & \sin\theta \\
+ *                                      0 & 1 & 0 \\
+ *                                      -\sin\theta & 0 & \cos\theta \end{pmatrix}
+ * \f]
+ *
+ * @sa getXRotationMatrix, getZRotationMatrix, transpose
+ * @tparam Real   Real type
+ * @param  angle  Rotation angle in radians
+ * @return        Rotation matrix
+ */
+template <typename Real>
+Matrix3<Real> getYRotationMatrix(const Real angle)
+{
+    const Real cosine = std::cos(angle);
+    const Real sine = std::sin(angle);
+    return Matrix3<Real>{{{cosine, Real(0), sine},
+                          {Real(0), Real(1), Real(0)},
+                          {-sine, Real(0), cosine}}};
+}
+
+//! Get matrix for rotation about z-axis.
+/*!
+ * Returns the matrix that rotates a 3-vector by an angle about the z-axis, counter-clockwise when
+ * looking down the axis towards the origin (right-hand rule):
+ *
+ * \f[
+ *      R_{z}(\theta) = \begin{pmatrix} \cos\theta & -\sin\theta & 0 \\
+ *                                      \sin\theta & \cos\theta & 0 \\
+ *                                      0 & 0 & 1 \end{pmatrix}
+ * \f]
+ *
+ * @sa getXRotationMatrix, getYRotationMatrix, transpose
+ * @tparam Real   Real type
+ * @param  angle  Rotation angle in radians
+ * @return        Rotation matrix
+ */
+template <typename Real>
+Matrix3<Real> getZRotationMatrix(const Real angle)
+{
+    const Real cosine = std::cos(angle);
+    const Real sine = std::sin(angle);
+    return Matrix3<Real>{{{cosine, -sine, Real(0)},
+                          {sine, cosine, Real(0)},
+                          {Real(0), Real(0), Real(1)}}};
+}
+
+//! Transpose 3x3 matrix.
+/*!
+ * Computes the transpose of a 3x3 matrix. The transpose of a rotation matrix is its inverse.
+ *
+ * @tparam Real    Real type
+ * @param  matrix  A 3x3 matrix
+ * @return         Transposed matrix
+ */
+template <typename Real>
+constexpr Matrix3<Real> transpose(const Matrix3<Real>& matrix)
+{
+    return Matrix3<Real>{{{matrix(0, 0), matrix(1, 0), matrix(2, 0)},
+                          {matrix(0, 1), matrix(1, 1), matrix(2, 1)},
+                          {matrix(0, 2), matrix(1, 2), matrix(2, 2)}}};
+}
+
+//! Multiply two 3x3 matrices.
+/*!
+ * Computes the matrix product \f$C = A B\f$. For rotation matrices, the product rotates a
+ * 3-vector by B first, and then by A.
+ *
+ * @tparam Real     Real type
+ * @param  matrix1  A 3x3 matrix (A)
+ * @param  matrix2  A 3x3 matrix (B)
+ * @return          Matrix product
+ */
+template <typename Real>
+constexpr Matrix3<Real> multiply(const Matrix3<Real>& matrix1, const Matrix3<Real>& matrix2)
+{
+    Matrix3<Real> result = { };
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        for (std::size_t j = 0; j < 3; j++)
+        {
+            result(i, j) = matrix1(i, 0) * matrix2(0, j)
+                           + matrix1(i, 1) * matrix2(1, j)
+                           + matrix1(i, 2) * matrix2(2, j);
+        }
+    }
+    return result;
+}
+
+//! Multiply 3-vector by 3x3 matrix.
+/*!
+ * Computes the matrix-vector product \f$\bar{R} = A \bar{X}\f$, e.g., to rotate a 3-vector.
+ *
+ * Note that the Vector3 type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * The result is created using VectorTraits, so that fixed-size types, e.g., std::array or
+ * FixedVector, are supported without heap allocation.
+ *
+ * @sa VectorTraits
+ * @tparam Real     Real type
+ * @tparam Vector3  3-Vector type
+ * @param  matrix   A 3x3 matrix
+ * @param  vector   A 3-vector
+ * @return          Matrix-vector product
+ */
+template <typename Real, typename Vector3>
+constexpr Vector3 multiply(const Matrix3<Real>& matrix, const Vector3& vector)
+{
+    assert(vector.size() == 3);
+    return VectorTraits<Vector3>::create(
+        matrix(0, 0) * vector[0] + matrix(0, 1) * vector[1] + matrix(0, 2) * vector[2],
+        matrix(1, 0) * vector[0] + matrix(1, 1) * vector[1] + matrix(1, 2) * vector[2],
+        matrix(2, 0) * vector[0] + matrix(2, 1) * vector[1] + matrix(2, 2) * vector[2]);
+}
+
+//! Batch of 3x3 matrices.
+/*!
+ * Container for a batch of N 3x3 matrices, e.g., rotation matrices at N epochs, stored as a
+ * structure-of-arrays (SoA): each of the 9 elements of all matrices is stored in a separate,
+ * contiguous array. As for Vector3Batch, this layout allows the batch functions, e.g., multiply(),
+ * to process multiple matrices per instruction using SIMD registers; compilers do not vectorize
+ * loads of matrices stored one after the other (array-of-structures), since their elements are 9
+ * values apart.
+ *
+ * @sa Vector3Batch
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class Matrix3Batch
+{
+public:
+
+    //! Element type.
+    typedef Real value_type;
+
+    //! Construct empty batch.
+    Matrix3Batch() { }
+
+    //! Construct batch of zero-matrices.
+    /*!
+     * @param  size  Number of 3x3 matrices N
+     */
+    explicit Matrix3Batch(const std::size_t size)
+    {
+        resize(size);
+    }
+
+    //! Get number of 3x3 matrices.
+    /*!
+     * @return  Number of 3x3 matrices N
+     */
+    std::size_t size() const { return elements[0][0].size(); }
+
+    //! Resize batch.
+    /*!
+     * @param  size  Number of 3x3 matrices N
+     */
+    void resize(const std::size_t size)
+    {
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                elements[i][j].resize(size);
+            }
+        }
+    }
+
+    //! Set 3x3 matrix.
+    /*!
+     * @param  index   Index of 3x3 matrix in batch
+     * @param  matrix  A 3x3 matrix
+     */
+    void set(const std::size_t index, const Matrix3<Real>& matrix)
+    {
+        assert(index < size());
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                elements[i][j][index] = matrix(i, j);
+            }
+        }
+    }
+
+    //! Get 3x3 matrix.
+    /*!
+     * @param  index  Index of 3x3 matrix in batch
+     * @return        3x3 matrix
+     */
+    Matrix3<Real> get(const std::size_t index) const
+    {
+        assert(index < size());
+        Matrix3<Real> matrix = { };
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                matrix(i, j) = elements[i][j][index];
+            }
+        }
+        return matrix;
+    }
+
+    //! Get element of all matrices.
+    /*!
+     * @param  row     Index of row (< 3)
+     * @param  column  Index of column (< 3)
+     * @return         Pointer to contiguous array of N elements
+     */
+    Real* getElements(const std::size_t row, const std::size_t column)
+    {
+        return elements[row][column].data();
+    }
+
+    //! Get element of all matrices.
+    /*!
+     * @param  row     Index of row (< 3)
+     * @param  column  Index of column (< 3)
+     * @return         Const pointer to contiguous array of N elements
+     */
+    const Real* getElements(const std::size_t row, const std::size_t column) const
+    {
+        return elements[row][column].data();
+    }
+
+private:
+
+    //! Elements of 3x3 matrices, stored element by element.
+    std::vector<Real> elements[3][3];
+};
+
+namespace detail
+{
+
+//! Kernel multiplying batch of 3-vectors by one 3x3 matrix.
+template <typename Real>
+struct MatrixVectorKernel
+{
+    Real a00; Real a01; Real a02;
+    Real a10; Real a11; Real a12;
+    Real a20; Real a21; Real a22;
+    const Real* x; const Real* y; const Real* z;
+    Real* resultX; Real* resultY; Real* resultZ;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Real vectorX = x[i];
+            const Real vectorY = y[i];
+            const Real vectorZ = z[i];
+            resultX[i] = a00 * vectorX + a01 * vectorY + a02 * vectorZ;
+            resultY[i] = a10 * vectorX + a11 * vectorY + a12 * vectorZ;
+            resultZ[i] = a20 * vectorX + a21 * vectorY + a22 * vectorZ;
+        }
+    }
+};
+
+//! Kernel multiplying batch of 3-vectors by batch of 3x3 matrices element-wise.
+template <typename Real>
+struct MatricesVectorKernel
+{
+    const Real* a00; const Real* a01; const Real* a02;
+    const Real* a10; const Real* a11; const Real* a12;
+    const Real* a20; const Real* a21; const Real* a22;
+    const Real* x; const Real* y; const Real* z;
+    Real* resultX; Real* resultY; Real* resultZ;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Real vectorX = x[i];
+            const Real vectorY = y[i];
+            const Real vectorZ = z[i];
+            resultX[i] = a00[i] * vectorX + a01[i] * vectorY + a02[i] * vectorZ;
+            resultY[i] = a10[i] * vectorX + a11[i] * vectorY + a12[i] * vectorZ;
+            resultZ[i] = a20[i] * vectorX + a21[i] * vectorY + a22[i] * vectorZ;
+        }
+    }
+};
+
+} // namespace detail
+
+//! Multiply batch of 3-vectors by 3x3 matrix.
+/*!
+ * Computes the matrix-vector products \f$\bar{R}_{i} = A \bar{X}_{i}\f$ of one 3x3 matrix and a
+ * batch of N 3-vectors, e.g., to rotate positions to another reference frame. The result is
+ * resized to N, and may be the input batch, i.e., the batch can be rotated in-place.
+ *
+ * The batch is dispatched at runtime to the best instruction set supported by the CPU (see
+ * getInstructionSet()).
+ *
+ * @sa multiply, Vector3Batch
+ * @tparam Real    Real type
+ * @param  matrix  A 3x3 matrix
+ * @param  batch   A batch of N 3-vectors
+ * @param  result  A batch of N matrix-vector products
+ * @param  policy  Execution policy
+ */
+template <typename Real>
+void multiply(const Matrix3<Real>& matrix,
+              const Vector3Batch<Real>& batch,
+              Vector3Batch<Real>& result,
+              const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("multiply(batch)", batch.size());
+    result.resize(batch.size());
+    const detail::MatrixVectorKernel<Real> kernel = {matrix(0, 0), matrix(0, 1), matrix(0, 2),
+                                                     matrix(1, 0), matrix(1, 1), matrix(1, 2),
+                                                     matrix(2, 0), matrix(2, 1), matrix(2, 2),
+                                                     batch.getX(), batch.getY(), batch.getZ(),
+                                                     result.getX(), result.getY(), result.getZ()};
+    detail::executeKernel(kernel, batch.size(), 6 * sizeof(Real), policy);
+}
+
+//! Multiply batch of 3-vectors by batch of 3x3 matrices element-wise.
+/*!
+ * Computes the matrix-vector products \f$\bar{R}_{i} = A_{i} \bar{X}_{i}\f$ of a batch of N 3x3
+ * matrices and a batch of N 3-vectors, e.g., to rotate positions at N epochs to a reference frame
+ * that rotates with time. The result is resized to N, and may be the input batch of 3-vectors,
+ * i.e., the batch can be rotated in-place.
+ *
+ * The batch is dispatched at runtime to the best instruction set supported by the CPU (see
+ * getInstructionSet()).
+ *
+ * @sa multiply, Matrix3Batch, Vector3Batch
+ * @tparam Real      Real type
+ * @param  matrices  A batch of N 3x3 matrices
+ * @param  batch     A batch of N 3-vectors
+ * @param  result    A batch of N matrix-vector products
+ * @param  policy    Execution policy
+ */
+template <typename Real>
+void multiply(const Matrix3Batch<Real>& matrices,
+              const Vector3Batch<Real>& batch,
+              Vector3Batch<Real>& result,
+              const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("multiply(batch)", batch.size());
+    assert(matrices.size() == batch.size());
+    result.resize(batch.size());
+    const detail::MatricesVectorKernel<Real> kernel
+        = {matrices.getElements(0, 0), matrices.getElements(0, 1), matrices.getElements(0, 2),
+           matrices.getElements(1, 0), matrices.getElements(1, 1), matrices.getElements(1, 2),
+           matrices.getElements(2, 0), matrices.getElements(2, 1), matrices.getElements(2, 2),
+           batch.getX(), batch.getY(), batch.getZ(),
+           result.getX(), result.getY(), result.getZ()};
+    detail::executeKernel(kernel, batch.size(), 15 * sizeof(Real), policy);
+}
+
+} // namespace sml
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Counters of the functions instrumented with SML_PROFILE (see profiling.hpp), which are local to
+// the calling thread, and the registry that merges the counters of all threads. This header is
+// only included by profiling.hpp if SML_ENABLE_PROFILING is defined, and by profileReport.hpp.
+
+namespace sml
+{
+
+//! Number of bins of input-size histograms.
+/*!
+ * Bin 0 counts calls with input size 0, and bin k > 0 counts calls with input sizes in the range
+ * [2^(k-1), 2^k). The last bin counts all calls with larger input sizes.
+ */
+const std::size_t profileHistogramSize = 32;
+
+//! Profile of function, merged across threads.
+struct ProfileEntry
+{
+    //! Name of function.
+    std::string name;
+
+    //! Number of calls.
+    std::uint64_t callCount;
+
+    //! Cumulative wall-clock time of calls in nanoseconds.
+    std::uint64_t nanoseconds;
+
+    //! Histogram of input sizes (see profileHistogramSize).
+    std::array<std::uint64_t, profileHistogramSize> sizeHistogram;
+};
+
+namespace detail
+{
+
+//! Get histogram bin of input size.
+/*!
+ * @param  size  Input size
+ * @return       Histogram bin (see profileHistogramSize)
+ */
+inline std::size_t getProfileHistogramBin(std::size_t size)
+{
+    std::size_t bin = 0;
+    while (size > 0 && bin < profileHistogramSize - 1)
+    {
+        size >>= 1;
+        bin++;
+    }
+    return bin;
+}
+
+//! Counters of function, which are written by a single thread and read by any thread.
+struct ProfileCounters
+{
+    //! Construct zeroed counters.
+    ProfileCounters()
+        : callCount(0),
+          nanoseconds(0)
+    {
+        for (std::size_t i = 0; i < profileHistogramSize; i++)
+        {
+            sizeHistogram[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    //! Number of calls.
+    std::atomic<std::uint64_t> callCount;
+
+    //! Cumulative wall-clock time of calls in nanoseconds.
+    std::atomic<std::uint64_t> nanoseconds;
+
+    //! Histogram of input sizes.
+    std::atomic<std::uint64_t> sizeHistogram[profileHistogramSize];
+};
+
+//! Add value to counter owned by calling thread.
+/*!
+ * Since only the owning thread writes the counter, a relaxed load and store suffice, which is
+ * cheaper than an atomic read-modify-write operation.
+ *
+ * @param  counter  Counter
+ * @param  value    Value to add
+ */
+inline void addToCounter(std::atomic<std::uint64_t>& counter, const std::uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+class ThreadProfile;
+
+//! Registry of the profiles of all threads.
+class ProfileRegistry
+{
+public:
+
+    //! Register profile of thread.
+    /*!
+     * @param  profile  Profile of thread
+     */
+    void attach(ThreadProfile* profile)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        threadProfiles.push_back(profile);
+    }
+
+    //! Unregister profile of thread that exits, keeping its counts.
+    /*!
+     * @param  profile  Profile of thread
+     */
+    void detach(ThreadProfile* profile);
+
+    //! Merge profiles of all threads, including threads that have exited.
+    /*!
+     * @return  Profiles of functions, sorted by descending cumulative time
+     */
+    std::vector<ProfileEntry> merge();
+
+    //! Reset profiles of all threads.
+    void reset();
+
+    //! Mutex guarding registry, and growth of profiles of threads.
+    std::mutex mutex;
+
+private:
+
+    //! Add counters to merged profiles.
+    /*!
+     * @param  name      Name of function
+     * @param  counters  Counters of function
+     * @param  entries   Merged profiles of functions
+     */
+    static void addCounters(const char* name,
+                            const ProfileCounters& counters,
+                            std::vector<ProfileEntry>& entries)
+    {
+        for (ProfileEntry& entry : entries)
+        {
+            if (entry.name == name)
+            {
+                addCounters(counters, entry);
+                return;
+            }
+        }
+        ProfileEntry entry = {name, 0, 0, {{}}};
+        addCounters(counters, entry);
+        entries.push_back(entry);
+    }
+
+    //! Add counters to profile.
+    /*!
+     * @param  counters  Counters of function
+     * @param  entry     Profile of function
+     */
+    static void addCounters(const ProfileCounters& counters, ProfileEntry& entry)
+    {
+        entry.callCount += counters.callCount.load(std::memory_order_relaxed);
+        entry.nanoseconds += counters.nanoseconds.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < profileHistogramSize; i++)
+        {
+            entry.sizeHistogram[i] += counters.sizeHistogram[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    //! Profiles of running threads.
+    std::vector<ThreadProfile*> threadProfiles;
+
+    //! Merged profiles of threads that have exited.
+    std::vector<ProfileEntry> exitedProfiles;
+};
+
+//! Get registry of the profiles of all threads.
+/*!
+ * @return  Registry
+ */
+inline ProfileRegistry& getProfileRegistry()
+{
+    static ProfileRegistry registry;
+    return registry;
+}
+
+//! Profile of calling thread.
+class ThreadProfile
+{
+public:
+
+    //! Construct profile and register it.
+    ThreadProfile()
+        : lastName(nullptr),
+          lastCounters(nullptr)
+    {
+        getProfileRegistry().attach(this);
+    }
+
+    //! Unregister profile, keeping its counts.
+    ~ThreadProfile()
+    {
+        getProfileRegistry().detach(this);
+    }
+
+    ThreadProfile(const ThreadProfile&) = delete;
+    ThreadProfile& operator=(const ThreadProfile&) = delete;
+
+    //! Get counters of function.
+    /*!
+     * Functions are identified by the address of their name. The counters of the most recently
+     * profiled function are cached, since instrumented functions are often called in loops.
+     *
+     * @param  name  Name of function (string literal)
+     * @return       Counters of function
+     */
+    ProfileCounters& getCounters(const char* name)
+    {
+        if (name != lastName)
+        {
+            const auto iterator = indices.find(name);
+            if (iterator == indices.end())
+            {
+                std::lock_guard<std::mutex> lock(getProfileRegistry().mutex);
+                indices.emplace(name, names.size());
+                names.push_back(name);
+                counters.emplace_back();
+                lastCounters = &counters.back();
+            }
+            else
+            {
+                lastCounters = &counters[iterator->second];
+            }
+            lastName = name;
+        }
+        return *lastCounters;
+    }
+
+    //! Names of profiled functions.
+    std::vector<const char*> names;
+
+    //! Counters of profiled functions, in the same order as the names.
+    std::deque<ProfileCounters> counters;
+
+private:
+
+    //! Indices of profiled functions, by address of name.
+    std::unordered_map<const char*, std::size_t> indices;
+
+    //! Name of most recently profiled function.
+    const char* lastName;
+
+    //! Counters of most recently profiled function.
+    ProfileCounters* lastCounters;
+};
+
+inline void ProfileRegistry::detach(ThreadProfile* profile)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (std::size_t i = 0; i < profile->names.size(); i++)
+    {
+        addCounters(profile->names[i], profile->counters[i], exitedProfiles);
+    }
+    threadProfiles.erase(std::find(threadProfiles.begin(), threadProfiles.end(), profile));
+}
+
+inline std::vector<ProfileEntry> ProfileRegistry::merge()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<ProfileEntry> entries = exitedProfiles;
+    for (const ThreadProfile* profile : threadProfiles)
+    {
+        for (std::size_t i = 0; i < profile->names.size(); i++)
+        {
+            addCounters(profile->names[i], profile->counters[i], entries);
+        }
+    }
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const ProfileEntry& entry)
+    {
+        return entry.callCount == 0;
+    }), entries.end());
+    std::sort(entries.begin(), entries.end(), [](const ProfileEntry& a, const ProfileEntry& b)
+    {
+        return a.nanoseconds != b.nanoseconds ? a.nanoseconds > b.nanoseconds : a.name < b.name;
+    });
+    return entries;
+}
+
+inline void ProfileRegistry::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    exitedProfiles.clear();
+    for (ThreadProfile* profile : threadProfiles)
+    {
+        for (ProfileCounters& counters : profile->counters)
+        {
+            counters.callCount.store(0, std::memory_order_relaxed);
+            counters.nanoseconds.store(0, std::memory_order_relaxed);
+            for (std::size_t i = 0; i < profileHistogramSize; i++)
+            {
+                counters.sizeHistogram[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+//! Get profile of calling thread.
+/*!
+ * @return  Profile of calling thread
+ */
+inline ThreadProfile& getThreadProfile()
+{
+    thread_local ThreadProfile profile;
+    return profile;
+}
+
+//! Scope that is profiled as a call of a function (see SML_PROFILE).
+class ProfileScope
+{
+public:
+
+    //! Record call, and start timing.
+    /*!
+     * @param  name  Name of function (string literal)
+     * @param  size  Input size
+     */
+    ProfileScope(const char* name, const std::size_t size)
+        : counters(getThreadProfile().getCounters(name))
+    {
+        addToCounter(counters.callCount, 1);
+        addToCounter(counters.sizeHistogram[getProfileHistogramBin(size)], 1);
+        start = std::chrono::steady_clock::now();
+    }
+
+    //! Stop timing, and add time to cumulative time.
+    ~ProfileScope()
+    {
+        const std::chrono::steady_clock::duration duration
+            = std::chrono::steady_clock::now() - start;
+        addToCounter(counters.nanoseconds, static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+
+    //! Counters of function.
+    ProfileCounters& counters;
+
+    //! Start time.
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace detail
+
+} // namespace sml
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "sml/profileRegistry.hpp"
+
+// Reports of the functions instrumented with SML_PROFILE (see profiling.hpp). Only code that reads
+// the profile, e.g., the main function of an application that enables profiling, needs to include
+// this header.
+
+namespace sml
+{
+
+//! Get profile of all instrumented functions.
+/*!
+ * Merges the counters of all threads, including threads that have exited. Functions that have
+ * not been called are omitted. The profile is empty if SML_ENABLE_PROFILING is not defined.
+ *
+ * @sa writeProfile, resetProfile
+ * @return  Profiles of functions, sorted by descending cumulative time
+ */
+inline std::vector<ProfileEntry> getProfile()
+{
+    return detail::getProfileRegistry().merge();
+}
+
+//! Reset profile of all instrumented functions.
+/*!
+ * Resets the counters of all threads. Calls that are in progress in other threads may be
+ * partially counted.
+ *
+ * @sa getProfile
+ */
+inline void resetProfile()
+{
+    detail::getProfileRegistry().reset();
+}
+
+//! Write profile of all instrumented functions as JSON.
+/*!
+ * Writes the merged profile (see getProfile()) as a JSON object, with an array of functions,
+ * each with the number of calls, the cumulative time in nanoseconds and the non-empty bins of
+ * the input-size histogram, e.g.:
+ *
+ *     {"functions": [{"name": "dot", "callCount": 2, "nanoseconds": 840,
+ *                     "sizeHistogram": [{"minimumSize": 2, "maximumSize": 3, "callCount": 2}]}]}
+ *
+ * The maximum size of the last histogram bin is omitted, since it is unbounded.
+ *
+ * @sa getProfile
+ * @param  stream  Output stream
+ */
+inline void writeProfile(std::ostream& stream)
+{
+    const std::vector<ProfileEntry> entries = getProfile();
+    stream << "{\"functions\": [";
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        const ProfileEntry& entry = entries[i];
+        stream << (i > 0 ? ",\n" : "\n") << "  {\"name\": \"" << entry.name
+               << "\", \"callCount\": " << entry.callCount
+               << ", \"nanoseconds\": " << entry.nanoseconds << ", \"sizeHistogram\": [";
+        bool isFirstBin = true;
+        for (std::size_t bin = 0; bin < profileHistogramSize; bin++)
+        {
+            if (entry.sizeHistogram[bin] == 0)
+            {
+                continue;
+            }
+            const std::uint64_t minimumSize = bin > 0 ? std::uint64_t(1) << (bin - 1) : 0;
+            stream << (isFirstBin ? "" : ", ") << "{\"minimumSize\": " << minimumSize;
+            if (bin < profileHistogramSize - 1)
+            {
+                stream << ", \"maximumSize\": " << (bin > 0 ? 2 * minimumSize - 1 : 0);
+            }
+            stream << ", \"callCount\": " << entry.sizeHistogram[bin] << "}";
+            isFirstBin = false;
+        }
+        stream << "]}";
+    }
+    stream << (entries.empty() ? "]}" : "\n]}") << "\n";
+}
+
+} // namespace sml
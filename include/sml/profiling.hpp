@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+// Opt-in instrumentation of the functions in sml. If SML_ENABLE_PROFILING is defined, e.g., by
+// configuring CMake with -DSML_ENABLE_PROFILING=ON, each instrumented function records its number
+// of calls, a histogram of its input sizes and its cumulative wall-clock time in counters that
+// are local to the calling thread (see profileRegistry.hpp). The counters of all threads are
+// merged by getProfile() and written as JSON by writeProfile() (see profileReport.hpp). If
+// SML_ENABLE_PROFILING is not defined, this header only defines SML_PROFILE, which expands to
+// nothing, so that the instrumented functions and their includes are unaffected.
+//
+// Functions that can be evaluated at compile time, e.g., dot() of short vectors, which is summed
+// sequentially, are only profiled on paths that cannot be evaluated at compile time.
+//
+// SML_ENABLE_PROFILING must be defined consistently in all translation units of a program, since
+// the instrumented functions are templates and inline functions.
+
+#ifdef SML_ENABLE_PROFILING
+
+#include <cstddef>
+
+#include "sml/profileRegistry.hpp"
+
+//! Concatenate tokens, after macro expansion.
+#define SML_PROFILE_CONCATENATE_TOKENS(first, second) first##second
+#define SML_PROFILE_CONCATENATE(first, second) SML_PROFILE_CONCATENATE_TOKENS(first, second)
+
+//! Profile enclosing scope as function with given name and input size.
+/*!
+ * Records a call of the function with the given name (string literal) and input size, e.g., the
+ * number of elements N, and adds the time until the end of the enclosing scope to the cumulative
+ * time of the function. Timings are inclusive, i.e., they include the time spent in instrumented
+ * functions that are called by the function.
+ */
+#define SML_PROFILE(name, size) \
+    const ::sml::detail::ProfileScope SML_PROFILE_CONCATENATE(smlProfileScope, __LINE__)( \
+        name, static_cast<std::size_t>(size))
+
+#else
+
+#define SML_PROFILE(name, size)
+
+#endif
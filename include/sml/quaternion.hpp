@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+#include "sml/executionPolicy.hpp"
+#include "sml/linearAlgebra.hpp"
+#include "sml/matrix3.hpp"
+#include "sml/profiling.hpp"
+#include "sml/vector3Batch.hpp"
+#include "sml/vectorTraits.hpp"
+
+namespace sml
+{
+
+//! Quaternion.
+/*!
+ * Quaternion \f$q = w + x i + y j + z k\f$, stored inline in scalar-first order, i.e., as
+ * {w, x, y, z}. Unit quaternions represent rotations: the quaternion
+ * \f$q = (\cos(\theta/2), \sin(\theta/2) \hat{n})\f$ rotates a 3-vector by an angle \f$\theta\f$
+ * about the unit-vector \f$\hat{n}\f$, counter-clockwise when looking down the axis towards the
+ * origin (right-hand rule), consistent with the rotation matrices in matrix3.hpp. The quaternions
+ * q and -q represent the same rotation.
+ *
+ * The quaternion is an aggregate and a literal type, so it can be brace-initialized and used in
+ * constant expressions:
+ *
+ * \code
+ *      constexpr Quaternion<double> quaternion = {{1.0, 0.0, 0.0, 0.0}};
+ * \endcode
+ *
+ * The quaternion supports the element access operator and .size() function, so it can be used
+ * with the generic linear algebra functions in sml, e.g., norm() and normalize().
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct Quaternion
+{
+    //! Element type.
+    typedef Real value_type;
+
+    //! Access element.
+    /*!
+     * @param  index  Index of element (0 for scalar part w, 1-3 for vector part x, y, z)
+     * @return        Reference to element
+     */
+    constexpr Real& operator[](const std::size_t index) { return elements[index]; }
+
+    //! Access element.
+    /*!
+     * @param  index  Index of element (0 for scalar part w, 1-3 for vector part x, y, z)
+     * @return        Const reference to element
+     */
+    constexpr const Real& operator[](const std::size_t index) const { return elements[index]; }
+
+    //! Get number of elements.
+    /*!
+     * @return  Number of elements (4)
+     */
+    static constexpr std::size_t size() { return 4; }
+
+    //! Elements of quaternion, {w, x, y, z}.
+    Real elements[4];
+};
+
+//! Compare quaternions for equality.
+/*!
+ * Note that q and -q represent the same rotation, but are not equal.
+ *
+ * @tparam Real         Real type
+ * @param  quaternion1  A quaternion
+ * @param  quaternion2  A quaternion
+ * @return              True if all elements are equal
+ */
+template <typename Real>
+constexpr bool operator==(const Quaternion<Real>& quaternion1,
+                          const Quaternion<Real>& quaternion2)
+{
+    return quaternion1[0] == quaternion2[0] && quaternion1[1] == quaternion2[1]
+           && quaternion1[2] == quaternion2[2] && quaternion1[3] == quaternion2[3];
+}
+
+//! Compare quaternions for inequality.
+/*!
+ * @tparam Real         Real type
+ * @param  quaternion1  A quaternion
+ * @param  quaternion2  A quaternion
+ * @return              True if any element differs
+ */
+template <typename Real>
+constexpr bool operator!=(const Quaternion<Real>& quaternion1,
+                          const Quaternion<Real>& quaternion2)
+{
+    return !(quaternion1 == quaternion2);
+}
+
+//! Get identity quaternion.
+/*!
+ * @tparam Real  Real type
+ * @return       Identity quaternion {1, 0, 0, 0}, i.e., no rotation
+ */
+template <typename Real>
+constexpr Quaternion<Real> getIdentityQuaternion()
+{
+    return Quaternion<Real>{{Real(1), Real(0), Real(0), Real(0)}};
+}
+
+//! Convert axis and angle of rotation to quaternion.
+/*!
+ * Computes the unit quaternion that rotates a 3-vector by an angle about an axis.
+ *
+ * Note that the Vector3 type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @tparam Real     Real type
+ * @tparam Vector3  3-Vector type
+ * @param  axis     Unit-vector along axis of rotation
+ * @param  angle    Rotation angle in radians
+ * @return          Unit quaternion
+ */
+template <typename Real, typename Vector3>
+Quaternion<Real> convertAxisAngleToQuaternion(const Vector3& axis, const Real angle)
+{
+    assert(axis.size() == 3);
+    const Real sine = std::sin(angle / Real(2));
+    return Quaternion<Real>{{std::cos(angle / Real(2)),
+                             sine * axis[0], sine * axis[1], sine * axis[2]}};
+}
+
+//! Compute conjugate of quaternion.
+/*!
+ * Computes the conjugate \f$q^{*} = w - x i - y j - z k\f$. The conjugate of a unit quaternion
+ * is its inverse, i.e., the inverse rotation.
+ *
+ * @tparam Real        Real type
+ * @param  quaternion  A quaternion
+ * @return             Conjugate of quaternion
+ */
+template <typename Real>
+constexpr Quaternion<Real> conjugate(const Quaternion<Real>& quaternion)
+{
+    return Quaternion<Real>{{quaternion[0], -quaternion[1], -quaternion[2], -quaternion[3]}};
+}
+
+//! Multiply two quaternions.
+/*!
+ * Computes the Hamilton product \f$q = q_{1} q_{2}\f$. For unit quaternions, the product composes
+ * the rotations: it rotates a 3-vector by \f$q_{2}\f$ first, and then by \f$q_{1}\f$, as for the
+ * product of rotation matrices.
+ *
+ * @tparam Real         Real type
+ * @param  quaternion1  A quaternion (\f$q_{1}\f$)
+ * @param  quaternion2  A quaternion (\f$q_{2}\f$)
+ * @return              Hamilton product
+ */
+template <typename Real>
+constexpr Quaternion<Real> multiply(const Quaternion<Real>& quaternion1,
+                                    const Quaternion<Real>& quaternion2)
+{
+    const Real w1 = quaternion1[0], x1 = quaternion1[1], y1 = quaternion1[2], z1 = quaternion1[3];
+    const Real w2 = quaternion2[0], x2 = quaternion2[1], y2 = quaternion2[2], z2 = quaternion2[3];
+    return Quaternion<Real>{{w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2,
+                             w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+                             w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+                             w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2}};
+}
+
+//! Interpolate between two unit quaternions using spherical linear interpolation (SLERP).
+/*!
+ * Interpolates between two rotations at a constant angular rate, along the shortest path, i.e.,
+ * the second quaternion is negated if the quaternions are more than 90 degrees apart in 4-space.
+ * If the quaternions are (nearly) equal, linear interpolation is used instead, to avoid
+ * division by (nearly) zero, and the result is normalized.
+ *
+ * @sa normalize
+ * @tparam Real         Real type
+ * @param  quaternion1  Unit quaternion at parameter 0
+ * @param  quaternion2  Unit quaternion at parameter 1
+ * @param  parameter    Interpolation parameter, in range [0, 1]
+ * @return              Interpolated unit quaternion
+ */
+template <typename Real>
+Quaternion<Real> slerp(const Quaternion<Real>& quaternion1,
+                       const Quaternion<Real>& quaternion2,
+                       const Real parameter)
+{
+    Real cosine = dot<Real>(quaternion1, quaternion2);
+    const Real sign = cosine < Real(0) ? Real(-1) : Real(1);
+    cosine *= sign;
+
+    Real weight1 = Real(1) - parameter;
+    Real weight2 = parameter;
+    const Real linearThreshold = Real(0.9995);
+    if (cosine < linearThreshold)
+    {
+        const Real angle = std::acos(cosine);
+        const Real sine = std::sin(angle);
+        weight1 = std::sin(weight1 * angle) / sine;
+        weight2 = std::sin(weight2 * angle) / sine;
+    }
+    weight2 *= sign;
+
+    Quaternion<Real> result = { };
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        result[i] = weight1 * quaternion1[i] + weight2 * quaternion2[i];
+    }
+    return cosine < linearThreshold ? result : normalize<Real>(result);
+}
+
+//! Convert unit quaternion to rotation matrix.
+/*!
+ * Computes the rotation matrix that rotates a 3-vector in the same way as a unit quaternion.
+ *
+ * @sa convertMatrixToQuaternion
+ * @tparam Real        Real type
+ * @param  quaternion  Unit quaternion
+ * @return             Rotation matrix
+ */
+template <typename Real>
+constexpr Matrix3<Real> convertQuaternionToMatrix(const Quaternion<Real>& quaternion)
+{
+    const Real w = quaternion[0], x = quaternion[1], y = quaternion[2], z = quaternion[3];
+    return Matrix3<Real>{{{Real(1) - Real(2) * (y * y + z * z),
+                           Real(2) * (x * y - w * z),
+                           Real(2) * (x * z + w * y)},
+                          {Real(2) * (x * y + w * z),
+                           Real(1) - Real(2) * (x * x + z * z),
+                           Real(2) * (y * z - w * x)},
+                          {Real(2) * (x * z - w * y),
+                           Real(2) * (y * z + w * x),
+                           Real(1) - Real(2) * (x * x + y * y)}}};
+}
+
+//! Convert rotation matrix to unit quaternion.
+/*!
+ * Computes the unit quaternion that rotates a 3-vector in the same way as a rotation matrix,
+ * using Shepperd's method (Shepperd, 1978): the quaternion is computed from the largest of its
+ * four elements, which avoids loss of precision for rotations by angles close to 180 degrees.
+ * The scalar part of the quaternion is non-negative, unless it is the smallest element.
+ *
+ * @sa convertQuaternionToMatrix
+ * @tparam Real    Real type
+ * @param  matrix  Rotation matrix
+ * @return         Unit quaternion
+ */
+template <typename Real>
+Quaternion<Real> convertMatrixToQuaternion(const Matrix3<Real>& matrix)
+{
+    const Real trace = matrix(0, 0) + matrix(1, 1) + matrix(2, 2);
+    if (trace > Real(0))
+    {
+        const Real scale = Real(2) * std::sqrt(trace + Real(1));
+        return Quaternion<Real>{{scale / Real(4),
+                                 (matrix(2, 1) - matrix(1, 2)) / scale,
+                                 (matrix(0, 2) - matrix(2, 0)) / scale,
+                                 (matrix(1, 0) - matrix(0, 1)) / scale}};
+    }
+    if (matrix(0, 0) > matrix(1, 1) && matrix(0, 0) > matrix(2, 2))
+    {
+        const Real scale
+            = Real(2) * std::sqrt(Real(1) + matrix(0, 0) - matrix(1, 1) - matrix(2, 2));
+        return Quaternion<Real>{{(matrix(2, 1) - matrix(1, 2)) / scale,
+                                 scale / Real(4),
+                                 (matrix(0, 1) + matrix(1, 0)) / scale,
+                                 (matrix(0, 2) + matrix(2, 0)) / scale}};
+    }
+    if (matrix(1, 1) > matrix(2, 2))
+    {
+        const Real scale
+            = Real(2) * std::sqrt(Real(1) + matrix(1, 1) - matrix(0, 0) - matrix(2, 2));
+        return Quaternion<Real>{{(matrix(0, 2) - matrix(2, 0)) / scale,
+                                 (matrix(0, 1) + matrix(1, 0)) / scale,
+                                 scale / Real(4),
+                                 (matrix(1, 2) + matrix(2, 1)) / scale}};
+    }
+    const Real scale = Real(2) * std::sqrt(Real(1) + matrix(2, 2) - matrix(0, 0) - matrix(1, 1));
+    return Quaternion<Real>{{(matrix(1, 0) - matrix(0, 1)) / scale,
+                             (matrix(0, 2) + matrix(2, 0)) / scale,
+                             (matrix(1, 2) + matrix(2, 1)) / scale,
+                             scale / Real(4)}};
+}
+
+//! Rotate 3-vector by unit quaternion.
+/*!
+ * Computes the rotated 3-vector \f$q \bar{v} q^{*}\f$, using the following equations, which avoid
+ * computing the full quaternion products:
+ *
+ * \f{eqnarray*}{
+ *      \bar{t} &=& 2 \bar{u} \times \bar{v} \\
+ *      \bar{v}' &=& \bar{v} + w \bar{t} + \bar{u} \times \bar{t}
+ * \f}
+ *
+ * where w and \f$\bar{u}\f$ are the scalar and vector parts of the quaternion. To rotate many
+ * 3-vectors by the same quaternion, use rotate() for a Vector3Batch.
+ *
+ * Note that the Vector3 type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * The result is created using VectorTraits, so that fixed-size types, e.g., std::array or
+ * FixedVector, are supported without heap allocation.
+ *
+ * @sa VectorTraits
+ * @tparam Real        Real type
+ * @tparam Vector3     3-Vector type
+ * @param  quaternion  Unit quaternion
+ * @param  vector      A 3-vector
+ * @return             Rotated 3-vector
+ */
+template <typename Real, typename Vector3>
+constexpr Vector3 rotate(const Quaternion<Real>& quaternion, const Vector3& vector)
+{
+    assert(vector.size() == 3);
+    const Real w = quaternion[0], x = quaternion[1], y = quaternion[2], z = quaternion[3];
+    const Real tx = Real(2) * (y * vector[2] - z * vector[1]);
+    const Real ty = Real(2) * (z * vector[0] - x * vector[2]);
+    const Real tz = Real(2) * (x * vector[1] - y * vector[0]);
+    return VectorTraits<Vector3>::create(vector[0] + w * tx + (y * tz - z * ty),
+                                         vector[1] + w * ty + (z * tx - x * tz),
+                                         vector[2] + w * tz + (x * ty - y * tx));
+}
+
+//! Rotate batch of 3-vectors by unit quaternion.
+/*!
+ * Rotates a batch of N 3-vectors, e.g., a point cloud or star catalogue, by one unit quaternion.
+ * The quaternion is converted to a rotation matrix once, since a matrix-vector product takes
+ * fewer operations per 3-vector (15) than the quaternion rotation (24), and the batch is then
+ * rotated by the vectorized matrix-vector kernel (see multiply()). The result is resized to N,
+ * and may be the input batch, i.e., the batch can be rotated in-place.
+ *
+ * @sa rotate, multiply, Vector3Batch
+ * @tparam Real        Real type
+ * @param  quaternion  Unit quaternion
+ * @param  batch       A batch of N 3-vectors
+ * @param  result      A batch of N rotated 3-vectors
+ * @param  policy      Execution policy
+ */
+template <typename Real>
+void rotate(const Quaternion<Real>& quaternion,
+            const Vector3Batch<Real>& batch,
+            Vector3Batch<Real>& result,
+            const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("rotate(batch)", batch.size());
+    multiply(convertQuaternionToMatrix(quaternion), batch, result, policy);
+}
+
+} // namespace sml
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "sml/simd.hpp"
+
+//! Number of elements in each block of a reduction.
+/*!
+ * Reductions of long vectors are split into blocks of this many elements. Each block is summed
+ * using multiple accumulators, and the block sums are combined pairwise.
+ */
+#ifndef SML_REDUCTION_BLOCK_SIZE
+#define SML_REDUCTION_BLOCK_SIZE 1024
+#endif
+
+namespace sml
+{
+
+//! Summation methods used by reductions, e.g., dot().
+enum class SummationMethod
+{
+    sequential, //!< Single accumulator, summed in order (error grows as O(N))
+    pairwise,   //!< Multiple accumulators per block, blocks summed pairwise (error O(log N))
+    kahan       //!< Compensated summation (error independent of N)
+};
+
+namespace detail
+{
+
+//! Number of accumulators (lanes) used to sum each block of a reduction.
+/*!
+ * The accumulators span 128 bytes, i.e., two AVX-512 registers, so that single-precision
+ * reductions use twice as many lanes as double-precision reductions.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+constexpr std::size_t reductionLaneCount = 128 / sizeof(Real);
+
+//! Maximum number of elements reduced sequentially by default.
+/*!
+ * Short vectors, e.g., 3-vectors, are summed sequentially, since the reduction is dominated by
+ * latency rather than throughput.
+ */
+const std::size_t sequentialReductionSize = 16;
+
+//! Sum with compensation for rounding error.
+template <typename Real>
+struct CompensatedSum
+{
+    //! Sum.
+    Real sum;
+
+    //! Accumulated rounding error of sum.
+    Real error;
+};
+
+//! Add value to compensated sum.
+/*!
+ * Adds a value to a compensated sum, accumulating the exact rounding error of the addition using
+ * the branch-free TwoSum algorithm (Knuth, 1997), so that it can be vectorized.
+ *
+ * Note that compensated summation relies on strict IEEE-754 semantics, and is defeated by
+ * compiler options that allow reassociation of floating-point operations, e.g., -ffast-math.
+ *
+ * @tparam Real   Real type
+ * @param  sum    Compensated sum
+ * @param  value  Value to add
+ */
+template <typename Real>
+SML_FORCE_INLINE void addCompensated(CompensatedSum<Real>& sum, const Real value)
+{
+    const Real total = sum.sum + value;
+    const Real virtualValue = total - sum.sum;
+    sum.error += (sum.sum - (total - virtualValue)) + (value - virtualValue);
+    sum.sum = total;
+}
+
+//! Combine two partial sums.
+/*!
+ * @tparam Real    Real type
+ * @param  first   First partial sum
+ * @param  second  Second partial sum
+ * @return         Combined sum
+ */
+template <typename Real>
+SML_FORCE_INLINE Real combineSums(const Real first, const Real second)
+{
+    return first + second;
+}
+
+//! Combine two compensated partial sums.
+/*!
+ * @tparam Real    Real type
+ * @param  first   First compensated partial sum
+ * @param  second  Second compensated partial sum
+ * @return         Combined compensated sum
+ */
+template <typename Real>
+SML_FORCE_INLINE CompensatedSum<Real> combineSums(const CompensatedSum<Real>& first,
+                                                  const CompensatedSum<Real>& second)
+{
+    CompensatedSum<Real> result = {first.sum, first.error + second.error};
+    addCompensated(result, second.sum);
+    return result;
+}
+
+//! Sum values in range using multiple accumulators.
+/*!
+ * Values are summed using independent accumulators (lanes), so that the compiler can use SIMD
+ * instructions and hide the latency of the additions. The lanes are combined pairwise. Trailing
+ * values that do not fill all lanes are added to the first lane, so that short ranges are summed
+ * in order.
+ *
+ * @tparam Real    Real type
+ * @tparam Values  Type with [] (element access operator, returning floating-point number)
+ * @param  values  Values to sum
+ * @param  begin   Index of first value
+ * @param  end     Index past last value
+ * @return         Sum of values
+ */
+template <typename Real, typename Values>
+SML_FORCE_INLINE Real sumLanes(const Values& values,
+                               const std::size_t begin,
+                               const std::size_t end)
+{
+    const std::size_t laneCount = reductionLaneCount<Real>;
+    Real lanes[laneCount] = { };
+    const std::size_t groupCount = (end - begin) / laneCount;
+    for (std::size_t group = 0; group < groupCount; group++)
+    {
+        const std::size_t i = begin + group * laneCount;
+        for (std::size_t j = 0; j < laneCount; j++)
+        {
+            lanes[j] += static_cast<Real>(values[i + j]);
+        }
+    }
+    for (std::size_t i = begin + groupCount * laneCount; i < end; i++)
+    {
+        lanes[0] += static_cast<Real>(values[i]);
+    }
+    for (std::size_t width = laneCount / 2; width > 0; width /= 2)
+    {
+        for (std::size_t j = 0; j < width; j++)
+        {
+            lanes[j] += lanes[j + width];
+        }
+    }
+    return lanes[0];
+}
+
+//! Sum values in range using multiple compensated accumulators.
+/*!
+ * As sumLanes(), but the rounding error of each addition is accumulated per lane (see
+ * addCompensated()).
+ *
+ * @tparam Real    Real type
+ * @tparam Values  Type with [] (element access operator, returning floating-point number)
+ * @param  values  Values to sum
+ * @param  begin   Index of first value
+ * @param  end     Index past last value
+ * @return         Compensated sum of values
+ */
+template <typename Real, typename Values>
+SML_FORCE_INLINE CompensatedSum<Real> sumLanesCompensated(const Values& values,
+                                                          const std::size_t begin,
+                                                          const std::size_t end)
+{
+    const std::size_t laneCount = reductionLaneCount<Real>;
+    Real sums[laneCount] = { };
+    Real errors[laneCount] = { };
+    const std::size_t groupCount = (end - begin) / laneCount;
+    for (std::size_t group = 0; group < groupCount; group++)
+    {
+        const std::size_t i = begin + group * laneCount;
+        for (std::size_t j = 0; j < laneCount; j++)
+        {
+            const Real value = static_cast<Real>(values[i + j]);
+            const Real total = sums[j] + value;
+            const Real virtualValue = total - sums[j];
+            errors[j] += (sums[j] - (total - virtualValue)) + (value - virtualValue);
+            sums[j] = total;
+        }
+    }
+    CompensatedSum<Real> result = {Real(0), Real(0)};
+    for (std::size_t j = 0; j < laneCount; j++)
+    {
+        result.error += errors[j];
+        addCompensated(result, sums[j]);
+    }
+    for (std::size_t i = begin + groupCount * laneCount; i < end; i++)
+    {
+        addCompensated(result, static_cast<Real>(values[i]));
+    }
+    return result;
+}
+
+//! Block of dot-product, summed using multiple accumulators.
+/*!
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ */
+template <typename Real, typename Vector>
+struct DotBlock
+{
+    //! First vector.
+    const Vector& vector1;
+
+    //! Second vector.
+    const Vector& vector2;
+
+    //! Get product of elements.
+    /*!
+     * @param  index  Index of elements
+     * @return        Product of elements
+     */
+    SML_FORCE_INLINE Real operator[](const std::size_t index) const
+    {
+        return static_cast<Real>(vector1[index] * vector2[index]);
+    }
+
+    //! Sum products of elements in range [begin, end) (see sumLanes()).
+    /*!
+     * @param  begin  Index of first element
+     * @param  end    Index past last element
+     * @return        Sum of products
+     */
+    Real operator()(const std::size_t begin, const std::size_t end) const
+    {
+        return sumLanes<Real>(*this, begin, end);
+    }
+};
+
+//! Block of dot-product, summed using multiple compensated accumulators.
+/*!
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ */
+template <typename Real, typename Vector>
+struct CompensatedDotBlock
+{
+    //! First vector.
+    const Vector& vector1;
+
+    //! Second vector.
+    const Vector& vector2;
+
+    //! Get product of elements.
+    /*!
+     * @param  index  Index of elements
+     * @return        Product of elements
+     */
+    SML_FORCE_INLINE Real operator[](const std::size_t index) const
+    {
+        return static_cast<Real>(vector1[index] * vector2[index]);
+    }
+
+    //! Sum products of elements in range [begin, end), with compensation for rounding error.
+    /*!
+     * @param  begin  Index of first element
+     * @param  end    Index past last element
+     * @return        Compensated sum of products
+     */
+    CompensatedSum<Real> operator()(const std::size_t begin, const std::size_t end) const
+    {
+        return sumLanesCompensated<Real>(*this, begin, end);
+    }
+};
+
+//! Block of sum, summed using multiple accumulators.
+/*!
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ */
+template <typename Real, typename Vector>
+struct SumBlock
+{
+    //! Vector.
+    const Vector& vector;
+
+    //! Sum elements in range [begin, end) (see sumLanes()).
+    /*!
+     * @param  begin  Index of first element
+     * @param  end    Index past last element
+     * @return        Sum of elements
+     */
+    Real operator()(const std::size_t begin, const std::size_t end) const
+    {
+        return sumLanes<Real>(vector, begin, end);
+    }
+};
+
+//! Block of sum, summed using multiple compensated accumulators.
+/*!
+ * @tparam Real    Real type
+ * @tparam Vector  Vector type
+ */
+template <typename Real, typename Vector>
+struct CompensatedSumBlock
+{
+    //! Vector.
+    const Vector& vector;
+
+    //! Sum elements in range [begin, end), with compensation for rounding error.
+    /*!
+     * @param  begin  Index of first element
+     * @param  end    Index past last element
+     * @return        Compensated sum of elements
+     */
+    CompensatedSum<Real> operator()(const std::size_t begin, const std::size_t end) const
+    {
+        return sumLanesCompensated<Real>(vector, begin, end);
+    }
+};
+
+//! Get index that splits range in reduction tree.
+/*!
+ * @param  begin  Index of first element
+ * @param  end    Index past last element
+ * @return        Index of first element of second half of range
+ */
+inline std::size_t getReductionMiddle(const std::size_t begin, const std::size_t end)
+{
+    const std::size_t blockSize = SML_REDUCTION_BLOCK_SIZE;
+    const std::size_t blockCount = (end - begin + blockSize - 1) / blockSize;
+    return begin + (blockCount + 1) / 2 * blockSize;
+}
+
+//! Reduce range pairwise.
+/*!
+ * Reduces the index range [begin, end) by splitting it into blocks of SML_REDUCTION_BLOCK_SIZE
+ * elements, which are reduced by the block function, and combining the block results pairwise
+ * in a binary tree. The tree only depends on the length of the range.
+ *
+ * @tparam Result  Result type (Real or CompensatedSum)
+ * @tparam Block   Block function type, with operator()(begin, end) returning Result
+ * @param  block   Block function
+ * @param  begin   Index of first element
+ * @param  end     Index past last element
+ * @return         Reduced result
+ */
+template <typename Result, typename Block>
+Result reducePairwise(const Block& block, const std::size_t begin, const std::size_t end)
+{
+    if (end - begin <= SML_REDUCTION_BLOCK_SIZE)
+    {
+        return block(begin, end);
+    }
+
+    const std::size_t middle = getReductionMiddle(begin, end);
+    return combineSums(reducePairwise<Result>(block, begin, middle),
+                       reducePairwise<Result>(block, middle, end));
+}
+
+} // namespace detail
+
+} // namespace sml
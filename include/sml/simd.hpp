@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+
+// Portable hints that help the compiler auto-vectorize the batch kernels in sml. The kernels are
+// written as plain loops over contiguous storage, so that they compile to SSE/AVX/AVX-512 (or
+// NEON) instructions depending on the target architecture selected by the user, e.g., by passing
+// -march=native (GCC/Clang) or /arch:AVX2 (MSVC) to the compiler. On x86 with GCC or Clang,
+// kernels executed through detail::executeKernel() are additionally compiled for AVX2 and
+// AVX-512F, and dispatched to the best instruction set supported by the CPU at runtime.
+//
+// Auto-vectorization requires optimization to be enabled, e.g., -O3 (the CMake Release
+// configuration). Kernels that call std::sqrt are only vectorized if the compiler does not have
+// to set errno, e.g., by passing -fno-math-errno (GCC/Clang), which is implied by -ffast-math.
+
+//! Restrict qualifier for pointers that do not alias.
+#if defined(__GNUC__) || defined(__clang__)
+#define SML_RESTRICT __restrict__
+#elif defined(_MSC_VER)
+#define SML_RESTRICT __restrict
+#else
+#define SML_RESTRICT
+#endif
+
+//! Hint to vectorize the loop that follows, ignoring assumed loop-carried dependencies.
+#if defined(__clang__)
+#define SML_SIMD_LOOP _Pragma("clang loop vectorize(enable) interleave(enable)")
+#elif defined(__GNUC__)
+#define SML_SIMD_LOOP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define SML_SIMD_LOOP __pragma(loop(ivdep))
+#else
+#define SML_SIMD_LOOP
+#endif
+
+//! Force inlining of function, e.g., kernels that are instantiated for multiple instruction sets.
+#if defined(__GNUC__) || defined(__clang__)
+#define SML_FORCE_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define SML_FORCE_INLINE __forceinline
+#else
+#define SML_FORCE_INLINE inline
+#endif
+
+//! Flag indicating if kernels can be dispatched to instruction sets detected at runtime.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) \
+    && !defined(SML_DISABLE_RUNTIME_DISPATCH)
+#define SML_HAS_RUNTIME_DISPATCH 1
+#define SML_TARGET_AVX2 __attribute__((target("avx2")))
+#define SML_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define SML_HAS_RUNTIME_DISPATCH 0
+#endif
+
+namespace sml
+{
+
+//! Instruction sets that kernels can be dispatched to at runtime.
+enum class InstructionSet
+{
+    generic,    //!< Instruction set selected at compile time
+    avx2,       //!< x86 AVX2 (256-bit vectors)
+    avx512      //!< x86 AVX-512F (512-bit vectors)
+};
+
+namespace detail
+{
+
+//! Detect best instruction set supported by CPU.
+/*!
+ * @return  Best instruction set supported by CPU
+ */
+inline InstructionSet detectInstructionSet()
+{
+#if SML_HAS_RUNTIME_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return InstructionSet::avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return InstructionSet::avx2;
+    }
+#endif
+    return InstructionSet::generic;
+}
+
+//! Get reference to instruction set used to dispatch kernels.
+/*!
+ * @return  Reference to instruction set used to dispatch kernels, detected on first use
+ */
+inline InstructionSet& getActiveInstructionSet()
+{
+    static InstructionSet instructionSet = detectInstructionSet();
+    return instructionSet;
+}
+
+} // namespace detail
+
+//! Get instruction set used to dispatch kernels.
+/*!
+ * Gets the instruction set that the batch kernels in sml are dispatched to. By default, this is
+ * the best instruction set supported by the CPU that the program runs on, so that a single binary
+ * makes use of the widest vector registers available on each machine.
+ *
+ * @return  Instruction set used to dispatch kernels
+ */
+inline InstructionSet getInstructionSet()
+{
+    return detail::getActiveInstructionSet();
+}
+
+//! Set instruction set used to dispatch kernels.
+/*!
+ * Sets the instruction set that the batch kernels in sml are dispatched to, e.g., to compare
+ * performance of instruction sets, or to restrict kernels to the instruction set selected at
+ * compile time. Requests for instruction sets that are not supported by the CPU are ignored.
+ *
+ * This function is not thread-safe, and should be called before kernels are executed.
+ *
+ * @param  instructionSet  Instruction set to dispatch kernels to
+ * @return                 True if instruction set is supported and was set
+ */
+inline bool setInstructionSet(const InstructionSet instructionSet)
+{
+    const InstructionSet supported = detail::detectInstructionSet();
+    if (static_cast<int>(instructionSet) > static_cast<int>(supported))
+    {
+        return false;
+    }
+    detail::getActiveInstructionSet() = instructionSet;
+    return true;
+}
+
+namespace detail
+{
+
+#if SML_HAS_RUNTIME_DISPATCH
+//! Execute kernel compiled for AVX-512F.
+/*!
+ * @tparam Kernel  Kernel type, with force-inlined operator()(begin, end)
+ * @param  kernel  Kernel to execute
+ * @param  begin   Index of first element to process
+ * @param  end     Index past last element to process
+ */
+template <typename Kernel>
+SML_TARGET_AVX512 void executeKernelAvx512(const Kernel& kernel,
+                                           const std::size_t begin,
+                                           const std::size_t end)
+{
+    kernel(begin, end);
+}
+
+//! Execute kernel compiled for AVX2.
+/*!
+ * @tparam Kernel  Kernel type, with force-inlined operator()(begin, end)
+ * @param  kernel  Kernel to execute
+ * @param  begin   Index of first element to process
+ * @param  end     Index past last element to process
+ */
+template <typename Kernel>
+SML_TARGET_AVX2 void executeKernelAvx2(const Kernel& kernel,
+                                       const std::size_t begin,
+                                       const std::size_t end)
+{
+    kernel(begin, end);
+}
+#endif
+
+//! Execute kernel using instruction set selected at runtime.
+/*!
+ * Executes a kernel over the index range [begin, end), compiled for the instruction set returned
+ * by getInstructionSet(). The kernel is a function object whose operator()(begin, end) is marked
+ * SML_FORCE_INLINE and contains a plain loop over the index range, which the compiler vectorizes
+ * for each instruction set separately.
+ *
+ * @tparam Kernel  Kernel type, with force-inlined operator()(begin, end)
+ * @param  kernel  Kernel to execute
+ * @param  begin   Index of first element to process
+ * @param  end     Index past last element to process
+ */
+template <typename Kernel>
+void executeKernel(const Kernel& kernel, const std::size_t begin, const std::size_t end)
+{
+#if SML_HAS_RUNTIME_DISPATCH
+    switch (getInstructionSet())
+    {
+        case InstructionSet::avx512:
+            executeKernelAvx512(kernel, begin, end);
+            return;
+        case InstructionSet::avx2:
+            executeKernelAvx2(kernel, begin, end);
+            return;
+        default:
+            break;
+    }
+#endif
+    kernel(begin, end);
+}
+
+} // namespace detail
+
+} // namespace sml
@@ -6,6 +6,31 @@
 
 #pragma once
 
+#include "sml/arena.hpp"
+#include "sml/arrayView.hpp"
 #include "sml/basicFunctions.hpp"
+#include "sml/basicFunctionsBatch.hpp"
+#include "sml/chebyshevSeries.hpp"
 #include "sml/constants.hpp"
+#include "sml/cubicSpline.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/fixedVector.hpp"
+#include "sml/hermiteInterpolator.hpp"
+#include "sml/interpolationTable.hpp"
+#include "sml/keplerEquation.hpp"
+#include "sml/lagrangeInterpolator.hpp"
 #include "sml/linearAlgebra.hpp"
+#include "sml/linearAlgebraBatch.hpp"
+#include "sml/matrix3.hpp"
+#include "sml/profileRegistry.hpp"
+#include "sml/profileReport.hpp"
+#include "sml/profiling.hpp"
+#include "sml/quaternion.hpp"
+#include "sml/reduction.hpp"
+#include "sml/simd.hpp"
+#include "sml/tableSearch.hpp"
+#include "sml/threadPool.hpp"
+#include "sml/trigonometry.hpp"
+#include "sml/vector3Batch.hpp"
+#include "sml/vectorExpression.hpp"
+#include "sml/vectorTraits.hpp"
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+namespace sml
+{
+
+//! Find interval in sorted table.
+/*!
+ * Finds the interval in a table of N strictly ascending x-values that brackets a specified
+ * x-value, using binary search. The index i that is returned satisfies:
+ *
+ * \f[
+ *      x_{i} \leq x < x_{i+1}
+ * \f]
+ *
+ * x-values that lie outside of the table are clamped to the first or last interval, i.e., the
+ * index returned is always in the range [0, N-2].
+ *
+ * The search costs O(log N) operations.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa huntInterval
+ * @tparam Real    Floating-point type
+ * @tparam Vector  Vector type
+ * @param  xData   A vector of N >= 2 strictly ascending x-values
+ * @param  x       x-value to find bracketing interval for
+ * @return         Index of first x-value of bracketing interval
+ */
+template <typename Real, typename Vector>
+std::size_t findInterval(const Vector& xData, const Real x)
+{
+    assert(xData.size() >= 2);
+    std::size_t lower = 0;
+    std::size_t upper = xData.size() - 1;
+    while (upper - lower > 1)
+    {
+        const std::size_t middle = lower + (upper - lower) / 2;
+        if (x < xData[middle])
+        {
+            upper = middle;
+        }
+        else
+        {
+            lower = middle;
+        }
+    }
+    return lower;
+}
+
+//! Hunt for interval in sorted table.
+/*!
+ * Finds the interval in a table of N strictly ascending x-values that brackets a specified
+ * x-value, starting from a guess for the interval index. The search expands outwards from the
+ * guess in steps that double in size until the x-value is bracketed, after which the interval is
+ * found using binary search.
+ *
+ * This is efficient when successive x-values are correlated, e.g., time-ordered queries, since
+ * the search costs O(log d) operations, where d is the distance (in table entries) between the
+ * guess and the interval sought. The index returned is the same as for findInterval().
+ *
+ * See Press et al. (2007), Numerical Recipes, section 3.1 for more background information.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa findInterval
+ * @tparam Real    Floating-point type
+ * @tparam Vector  Vector type
+ * @param  xData   A vector of N >= 2 strictly ascending x-values
+ * @param  x       x-value to find bracketing interval for
+ * @param  guess   Guess for index of bracketing interval, e.g., the result of the previous search
+ * @return         Index of first x-value of bracketing interval
+ */
+template <typename Real, typename Vector>
+std::size_t huntInterval(const Vector& xData, const Real x, const std::size_t guess)
+{
+    assert(xData.size() >= 2);
+    const std::size_t last = xData.size() - 1;
+    std::size_t lower = guess < last ? guess : last - 1;
+    std::size_t upper = lower + 1;
+    std::size_t step = 1;
+
+    if (x >= xData[lower])
+    {
+        // Hunt upwards until x < xData[upper] or the end of the table is reached.
+        while (upper < last && x >= xData[upper])
+        {
+            lower = upper;
+            upper = step < last - upper ? upper + step : last;
+            step *= 2;
+        }
+    }
+    else
+    {
+        // Hunt downwards until xData[lower] <= x or the start of the table is reached.
+        while (lower > 0 && x < xData[lower])
+        {
+            upper = lower;
+            lower = step < lower ? lower - step : 0;
+            step *= 2;
+        }
+    }
+
+    // Bisect bracket [lower, upper].
+    while (upper - lower > 1)
+    {
+        const std::size_t middle = lower + (upper - lower) / 2;
+        if (x < xData[middle])
+        {
+            upper = middle;
+        }
+        else
+        {
+            lower = middle;
+        }
+    }
+    return lower;
+}
+
+//! Get start of stencil in table.
+/*!
+ * Gets the index of the first entry of a stencil of M consecutive table entries, centred on a
+ * given interval. Near the start and end of a table of N entries, the stencil is shifted so that
+ * it lies entirely in the table. The index returned is in the range [0, N-M].
+ *
+ * For even M, the interval [i, i+1] lies at the centre of the stencil. For odd M, the stencil
+ * contains one more entry before the interval than after it.
+ *
+ * @param  interval     Index of first entry of interval to centre stencil on
+ * @param  stencilSize  Number of entries M in stencil
+ * @param  tableSize    Number of entries N in table (N >= M)
+ * @return              Index of first entry of stencil
+ */
+inline std::size_t getStencilStart(const std::size_t interval,
+                                   const std::size_t stencilSize,
+                                   const std::size_t tableSize)
+{
+    assert(stencilSize <= tableSize);
+    const std::size_t before = (stencilSize - 1) / 2;
+    const std::size_t start = interval > before ? interval - before : 0;
+    return start + stencilSize <= tableSize ? start : tableSize - stencilSize;
+}
+
+} // namespace sml
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sml
+{
+
+//! Executor of parallel tasks.
+/*!
+ * Interface through which the batch functions in sml run chunks of work in parallel (see
+ * ExecutionPolicy). ThreadPool implements this interface. To run sml on a thread pool that is
+ * owned by the application instead, e.g., so that the two pools do not oversubscribe the CPU,
+ * derive from this interface and forward the tasks in parallelFor() to that pool.
+ */
+class Executor
+{
+public:
+
+    //! Destruct executor.
+    virtual ~Executor() { }
+
+    //! Get concurrency.
+    /*!
+     * @return  Number of tasks that can run concurrently, used to split work into chunks
+     */
+    virtual std::size_t getConcurrency() const = 0;
+
+    //! Run tasks in parallel.
+    /*!
+     * Runs task(i) for all i in [0, taskCount), potentially in parallel, and returns once all
+     * tasks have completed. If tasks throw exceptions, one of them is rethrown once all tasks
+     * have completed.
+     *
+     * Tasks can call parallelFor() themselves, e.g., if a batch function is called from within a
+     * parallel task. To avoid deadlocks, implementations should run tasks on the calling thread
+     * while waiting for the other tasks to complete.
+     *
+     * @param  taskCount  Number of tasks
+     * @param  task       Function to run for each task index
+     */
+    virtual void parallelFor(const std::size_t taskCount,
+                             const std::function<void(std::size_t)>& task) = 0;
+};
+
+namespace detail
+{
+
+//! Identity of thread pool worker running on current thread.
+struct ThreadPoolWorker
+{
+    //! Thread pool that worker belongs to, or null if thread is not a worker.
+    const void* threadPool;
+
+    //! Index of worker in its thread pool.
+    std::size_t index;
+};
+
+//! Get identity of thread pool worker running on current thread.
+/*!
+ * @return  Reference to thread-local identity of worker
+ */
+inline ThreadPoolWorker& getCurrentThreadPoolWorker()
+{
+    static thread_local ThreadPoolWorker worker = {nullptr, 0};
+    return worker;
+}
+
+} // namespace detail
+
+//! Work-stealing thread pool.
+/*!
+ * Thread pool in which each worker thread owns a queue of tasks. parallelFor() distributes its
+ * tasks over the queues in contiguous blocks, so that neighbouring chunks of a batch are
+ * processed by the same worker. Each worker takes tasks from the back of its own queue, and once
+ * its queue is empty, steals tasks from the front of the queues of other workers, which balances
+ * the load if some chunks take longer than others, e.g., because a worker is preempted.
+ *
+ * The thread that calls parallelFor() runs tasks as well, until all of its tasks have completed,
+ * so parallelFor() can be called from within a task without deadlocking. The concurrency of the
+ * pool is therefore the number of worker threads plus one. A pool without worker threads runs
+ * all tasks on the calling thread.
+ *
+ * Idle workers sleep on a condition variable, so an idle pool does not consume CPU time.
+ *
+ * @sa getDefaultThreadPool, ExecutionPolicy
+ */
+class ThreadPool : public Executor
+{
+public:
+
+    //! Construct thread pool.
+    /*!
+     * @param  threadCount  Number of worker threads, in addition to the calling thread
+     */
+    explicit ThreadPool(const std::size_t threadCount = getDefaultThreadCount())
+        : queues(),
+          workers(),
+          sleepMutex(),
+          wakeUp(),
+          pendingTaskCount(0),
+          isStopping(false)
+    {
+        for (std::size_t i = 0; i < threadCount; i++)
+        {
+            queues.emplace_back(new WorkQueue);
+        }
+        for (std::size_t i = 0; i < threadCount; i++)
+        {
+            workers.emplace_back(&ThreadPool::runWorker, this, i);
+        }
+    }
+
+    //! Thread pools are not copyable, since workers refer to them by address.
+    ThreadPool(const ThreadPool&) = delete;
+
+    //! Thread pools are not copyable, since workers refer to them by address.
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Destruct thread pool, after workers have run all queued tasks.
+    ~ThreadPool() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            isStopping = true;
+        }
+        wakeUp.notify_all();
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    //! Get default number of worker threads.
+    /*!
+     * @return  Number of hardware threads minus one (for the calling thread), or zero if unknown
+     */
+    static std::size_t getDefaultThreadCount()
+    {
+        const unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+        return hardwareThreadCount > 1 ? hardwareThreadCount - 1 : 0;
+    }
+
+    //! Get number of worker threads.
+    /*!
+     * @return  Number of worker threads
+     */
+    std::size_t getThreadCount() const { return workers.size(); }
+
+    //! Get concurrency.
+    /*!
+     * @return  Number of worker threads plus one, for the calling thread
+     */
+    std::size_t getConcurrency() const override { return workers.size() + 1; }
+
+    //! Run tasks in parallel.
+    /*!
+     * @sa Executor::parallelFor
+     * @param  taskCount  Number of tasks
+     * @param  task       Function to run for each task index
+     */
+    void parallelFor(const std::size_t taskCount,
+                     const std::function<void(std::size_t)>& task) override
+    {
+        if (taskCount == 0)
+        {
+            return;
+        }
+        if (queues.empty() || taskCount == 1)
+        {
+            for (std::size_t i = 0; i < taskCount; i++)
+            {
+                task(i);
+            }
+            return;
+        }
+
+        Job job;
+        job.task = &task;
+        job.remainingTaskCount = taskCount;
+
+        // Workers of this pool start with their own queue; other threads start with the first.
+        const detail::ThreadPoolWorker& worker = detail::getCurrentThreadPoolWorker();
+        const std::size_t home = worker.threadPool == this ? worker.index : 0;
+        const std::size_t queueCount = queues.size();
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            pendingTaskCount += taskCount;
+        }
+        for (std::size_t k = 0; k < queueCount; k++)
+        {
+            const std::size_t begin = k * taskCount / queueCount;
+            const std::size_t end = (k + 1) * taskCount / queueCount;
+            WorkQueue& queue = *queues[(home + k) % queueCount];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            for (std::size_t i = end; i-- > begin;)
+            {
+                queue.tasks.push_back(Task{&job, i});
+            }
+        }
+        wakeUp.notify_all();
+
+        while (job.remainingTaskCount.load() > 0)
+        {
+            Task next;
+            if (tryTakeTask(home, next))
+            {
+                runTask(next);
+            }
+            else
+            {
+                // All remaining tasks of the job are running on other threads.
+                std::unique_lock<std::mutex> lock(job.mutex);
+                job.isDone.wait(lock, [&job]() { return job.remainingTaskCount.load() == 0; });
+            }
+        }
+
+        // Wait for the thread that completed the last task to release the job.
+        std::lock_guard<std::mutex> lock(job.mutex);
+        if (job.exception)
+        {
+            std::rethrow_exception(job.exception);
+        }
+    }
+
+private:
+
+    //! Tasks that were submitted by a single call of parallelFor().
+    struct Job
+    {
+        //! Function to run for each task index.
+        const std::function<void(std::size_t)>* task;
+
+        //! Number of tasks that have not completed yet.
+        std::atomic<std::size_t> remainingTaskCount;
+
+        //! Mutex guarding completion of tasks and exception.
+        std::mutex mutex;
+
+        //! Condition variable signalled when all tasks have completed.
+        std::condition_variable isDone;
+
+        //! First exception thrown by a task.
+        std::exception_ptr exception;
+    };
+
+    //! Task in queue.
+    struct Task
+    {
+        //! Job that task belongs to.
+        Job* job;
+
+        //! Index of task.
+        std::size_t index;
+    };
+
+    //! Queue of tasks owned by a worker.
+    struct WorkQueue
+    {
+        //! Mutex guarding tasks.
+        std::mutex mutex;
+
+        //! Tasks, taken from the back by the owner and from the front by other threads.
+        std::deque<Task> tasks;
+    };
+
+    //! Take task from own queue, or steal task from queue of other worker.
+    /*!
+     * @param  home  Index of own queue
+     * @param  task  Task taken, if any
+     * @return       True if a task was taken
+     */
+    bool tryTakeTask(const std::size_t home, Task& task)
+    {
+        const std::size_t queueCount = queues.size();
+        for (std::size_t k = 0; k < queueCount; k++)
+        {
+            WorkQueue& queue = *queues[(home + k) % queueCount];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                if (k == 0)
+                {
+                    task = queue.tasks.back();
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    task = queue.tasks.front();
+                    queue.tasks.pop_front();
+                }
+                pendingTaskCount--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Run task and signal its job if it was the last task of the job.
+    /*!
+     * @param  task  Task to run
+     */
+    void runTask(const Task& task)
+    {
+        Job& job = *task.job;
+        try
+        {
+            (*job.task)(task.index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if (!job.exception)
+            {
+                job.exception = std::current_exception();
+            }
+        }
+        std::lock_guard<std::mutex> lock(job.mutex);
+        if (--job.remainingTaskCount == 0)
+        {
+            job.isDone.notify_all();
+        }
+    }
+
+    //! Run worker loop until pool is destructed.
+    /*!
+     * @param  index  Index of worker
+     */
+    void runWorker(const std::size_t index)
+    {
+        detail::ThreadPoolWorker& worker = detail::getCurrentThreadPoolWorker();
+        worker.threadPool = this;
+        worker.index = index;
+        while (true)
+        {
+            Task task;
+            if (tryTakeTask(index, task))
+            {
+                runTask(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this]() { return isStopping || pendingTaskCount.load() > 0; });
+            if (isStopping && pendingTaskCount.load() == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    //! Queues of tasks, one per worker.
+    std::vector<std::unique_ptr<WorkQueue> > queues;
+
+    //! Worker threads.
+    std::vector<std::thread> workers;
+
+    //! Mutex guarding sleeping workers.
+    std::mutex sleepMutex;
+
+    //! Condition variable signalled when tasks are queued or pool is destructed.
+    std::condition_variable wakeUp;
+
+    //! Number of queued tasks that have not been taken yet.
+    std::atomic<std::size_t> pendingTaskCount;
+
+    //! Flag indicating if pool is being destructed.
+    bool isStopping;
+};
+
+//! Get default thread pool.
+/*!
+ * Gets the thread pool that parallel batch functions run on, unless an ExecutionPolicy specifies
+ * another Executor. The pool is created on first use, with ThreadPool::getDefaultThreadCount()
+ * worker threads.
+ *
+ * @return  Reference to default thread pool
+ */
+inline ThreadPool& getDefaultThreadPool()
+{
+    static ThreadPool threadPool;
+    return threadPool;
+}
+
+} // namespace sml
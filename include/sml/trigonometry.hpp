@@ -0,0 +1,638 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "sml/basicFunctionsBatch.hpp"
+#include "sml/constants.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+
+namespace sml
+{
+
+//! Accuracy of batch trigonometric functions, e.g., computeSine().
+enum class TrigonometricAccuracy
+{
+    precise, //!< Error of a few units in the last place (see documentation of each function)
+    coarse   //!< Error below 2e-6 using shorter polynomials, e.g., for visualization
+};
+
+namespace detail
+{
+
+//! Coefficients of trigonometric kernels for given Real type.
+/*!
+ * Each specialization provides the parts of the Cody-Waite split of pi/2 used to reduce angles,
+ * the largest angle magnitude for which the reduction is accurate, and the polynomials that
+ * approximate the sine and cosine on [-pi/4, pi/4] and the arctangent on [-tan(pi/8), tan(pi/8)]
+ * to full precision.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct TrigonometricCoefficients;
+
+//! Coefficients of trigonometric kernels for double (polynomials from fdlibm and Cephes).
+template <>
+struct TrigonometricCoefficients<double>
+{
+    // The first two parts of pi/2 have 33 significant bits, so that their products with the
+    // quadrant number k are exact for |k| < 2^20.
+    static constexpr double halfPi1 = 1.57079632673412561417e+00;
+    static constexpr double halfPi2 = 6.07710050630396597660e-11;
+    static constexpr double halfPi3 = 2.02226624879595063154e-21;
+    static constexpr double reductionLimit = 1048576.0;
+
+    static SML_FORCE_INLINE double computeSine(const double angle, const double square)
+    {
+        return angle + angle * square
+            * (-1.66666666666666324348e-01 + square
+            * (8.33333333332248946124e-03 + square
+            * (-1.98412698298579493134e-04 + square
+            * (2.75573137070700676789e-06 + square
+            * (-2.50507602534068634195e-08 + square * 1.58969099521155010221e-10)))));
+    }
+
+    static SML_FORCE_INLINE double computeCosine(const double square)
+    {
+        return 1.0 - 0.5 * square + square * square
+            * (4.16666666666666019037e-02 + square
+            * (-1.38888888888741095749e-03 + square
+            * (2.48015872894767294178e-05 + square
+            * (-2.75573143513906633035e-07 + square
+            * (2.08757232129817482790e-09 + square * -1.13596475577881948265e-11)))));
+    }
+
+    static SML_FORCE_INLINE double computeArcTangent(const double ratio, const double square)
+    {
+        const double numerator = (((-8.750608600031904122785e-01 * square
+                                    - 1.615753718733365076637e+01) * square
+                                   - 7.500855792314704667340e+01) * square
+                                  - 1.228866684490136173410e+02) * square
+                                 - 6.485021904942025371773e+01;
+        const double denominator = ((((square + 2.485846490142306297962e+01) * square
+                                      + 1.650270098316988542046e+02) * square
+                                     + 4.328810604912902668951e+02) * square
+                                    + 4.853903996359136964868e+02) * square
+                                   + 1.945506571482613964425e+02;
+        return ratio + ratio * square * numerator / denominator;
+    }
+};
+
+//! Coefficients of trigonometric kernels for float (polynomials from Cephes).
+template <>
+struct TrigonometricCoefficients<float>
+{
+    // The first two parts of pi/2 have 11 significant bits, so that their products with the
+    // quadrant number k are exact for |k| < 2^13.
+    static constexpr float halfPi1 = 1.5703125f;
+    static constexpr float halfPi2 = 4.837512969970703125e-4f;
+    static constexpr float halfPi3 = 7.549790126404332e-8f;
+    static constexpr float reductionLimit = 8192.0f;
+
+    static SML_FORCE_INLINE float computeSine(const float angle, const float square)
+    {
+        return angle + angle * square
+            * ((-1.9515295891e-4f * square + 8.3321608736e-3f) * square - 1.6666654611e-1f);
+    }
+
+    static SML_FORCE_INLINE float computeCosine(const float square)
+    {
+        return 1.0f - 0.5f * square + square * square
+            * ((2.443315711809948e-5f * square - 1.388731625493765e-3f) * square
+               + 4.166664568298827e-2f);
+    }
+
+    static SML_FORCE_INLINE float computeArcTangent(const float ratio, const float square)
+    {
+        return ratio + ratio * square
+            * (((8.05374449538e-2f * square - 1.38776856032e-1f) * square + 1.99777106478e-1f)
+               * square - 3.33329491539e-1f);
+    }
+};
+
+//! Evaluate polynomial approximation of sine on [-pi/4, pi/4].
+/*!
+ * The coarse polynomials are near-minimax fits of lower degree, shared by all Real types.
+ *
+ * @tparam Real      Real type
+ * @tparam isCoarse  Flag indicating if coarse polynomial should be used
+ * @param  angle     Angle in radians, in range [-pi/4, pi/4]
+ * @param  square    Square of angle
+ * @return           Sine of angle
+ */
+template <typename Real, bool isCoarse>
+SML_FORCE_INLINE Real computeSinePolynomial(const Real angle, const Real square)
+{
+    return isCoarse ? angle + angle * square
+                          * (Real(-0.16663393088638775) + square * Real(0.008163351759175527))
+                    : TrigonometricCoefficients<Real>::computeSine(angle, square);
+}
+
+//! Evaluate polynomial approximation of cosine on [-pi/4, pi/4].
+/*!
+ * @tparam Real      Real type
+ * @tparam isCoarse  Flag indicating if coarse polynomial should be used
+ * @param  square    Square of angle in radians, with angle in range [-pi/4, pi/4]
+ * @return           Cosine of angle
+ */
+template <typename Real, bool isCoarse>
+SML_FORCE_INLINE Real computeCosinePolynomial(const Real square)
+{
+    return isCoarse ? Real(1) + square
+                          * (Real(-0.49999884906768916) + square
+                          * (Real(0.04165578709294199) + square * Real(-0.0013591989581423925)))
+                    : TrigonometricCoefficients<Real>::computeCosine(square);
+}
+
+//! Evaluate polynomial approximation of arctangent on [-tan(pi/8), tan(pi/8)].
+/*!
+ * @tparam Real      Real type
+ * @tparam isCoarse  Flag indicating if coarse polynomial should be used
+ * @param  ratio     Tangent, in range [-tan(pi/8), tan(pi/8)]
+ * @param  square    Square of tangent
+ * @return           Arctangent in radians
+ */
+template <typename Real, bool isCoarse>
+SML_FORCE_INLINE Real computeArcTangentPolynomial(const Real ratio, const Real square)
+{
+    return isCoarse ? ratio + ratio * square
+                          * (Real(-0.3332551737656587) + square
+                          * (Real(0.19714370153284114) + square * Real(-0.1122630192927965)))
+                    : TrigonometricCoefficients<Real>::computeArcTangent(ratio, square);
+}
+
+//! Compute sine and cosine of angle, without branches.
+/*!
+ * The angle is reduced to the range [-pi/4, pi/4] by subtracting the nearest multiple k of pi/2,
+ * i.e., it is wrapped to one quarter revolution using the branch-free floor of basicFunctions.hpp.
+ * The multiple of pi/2 is subtracted in three parts (Cody-Waite reduction), so that the reduced
+ * angle is accurate for angles up to TrigonometricCoefficients<Real>::reductionLimit in
+ * magnitude. The quadrant, k modulo 4, selects the polynomial and sign of each result.
+ *
+ * @tparam Real      Real type
+ * @tparam isCoarse  Flag indicating if coarse polynomials should be used
+ * @param  angle     Angle in radians
+ * @param  sine      Sine of angle
+ * @param  cosine    Cosine of angle
+ */
+template <typename Real, bool isCoarse>
+SML_FORCE_INLINE void computeSineCosine(const Real angle, Real& sine, Real& cosine)
+{
+    typedef TrigonometricCoefficients<Real> Coefficients;
+    const Real multiple = computeBranchFreeFloor(angle * (Real(1) / halfPi<Real>) + Real(0.5));
+    const Real reducedAngle = ((angle - multiple * Coefficients::halfPi1)
+                               - multiple * Coefficients::halfPi2)
+                              - multiple * Coefficients::halfPi3;
+    const Real quadrant = multiple - Real(4) * computeBranchFreeFloor(multiple * Real(0.25));
+
+    const Real square = reducedAngle * reducedAngle;
+    const Real reducedSine = computeSinePolynomial<Real, isCoarse>(reducedAngle, square);
+    const Real reducedCosine = computeCosinePolynomial<Real, isCoarse>(square);
+
+    // The polynomial and signs are selected with exact arithmetic on the quadrant digits instead
+    // of conditionals, since GCC turns the conditionals for two outputs into branches, which
+    // prevent vectorization. Multiplying by zero or one is exact for finite values.
+    const Real halfQuadrant = computeBranchFreeFloor(quadrant * Real(0.5));
+    const Real isOdd = quadrant - Real(2) * halfQuadrant;
+    const Real isEven = Real(1) - isOdd;
+    const Real sineSign = Real(1) - Real(2) * halfQuadrant;
+    const Real cosineSign
+        = Real(1) - Real(2) * (halfQuadrant + isOdd - Real(2) * halfQuadrant * isOdd);
+    sine = sineSign * (isOdd * reducedCosine + isEven * reducedSine);
+    cosine = cosineSign * (isOdd * reducedSine + isEven * reducedCosine);
+}
+
+//! Compute four-quadrant arctangent, without branches.
+/*!
+ * The ratio of the smaller to the larger magnitude of the coordinates is reduced to the range
+ * [-tan(pi/8), tan(pi/8)] with the identity atan(r) = pi/4 + atan((r - 1) / (r + 1)), which is
+ * applied to the coordinates directly, so that only one division is needed. The arctangent of
+ * the reduced ratio is then mapped to the octant and quadrant of the coordinates.
+ *
+ * @tparam Real      Real type
+ * @tparam isCoarse  Flag indicating if coarse polynomial should be used
+ * @param  y         y-coordinate
+ * @param  x         x-coordinate
+ * @return           Angle in radians, in range [-pi, pi]
+ */
+template <typename Real, bool isCoarse>
+SML_FORCE_INLINE Real computeArcTangent2(const Real y, const Real x)
+{
+    const Real absoluteX = std::fabs(x);
+    const Real absoluteY = std::fabs(y);
+    // The flags are computed from signs instead of with conditionals, since GCC otherwise moves
+    // the multiplications by the flags into branches, which prevent vectorization.
+    const Real steep = Real(0.5) - Real(0.5) * std::copysign(Real(1), absoluteX - absoluteY);
+    const Real smaller = steep * absoluteX + (Real(1) - steep) * absoluteY;
+    const Real larger = steep * absoluteY + (Real(1) - steep) * absoluteX;
+
+    const Real tangentEighthPi = Real(0.41421356237309504880);
+    const Real reduction
+        = Real(0.5) - Real(0.5) * std::copysign(Real(1), tangentEighthPi * larger - smaller);
+    const Real zeroCorrection = larger == Real(0) ? Real(1) : Real(0);
+    const Real ratio = (smaller - reduction * larger)
+                       / (reduction * smaller + larger + zeroCorrection);
+    const Real octantAngle = reduction * (pi<Real> / Real(4))
+                             + computeArcTangentPolynomial<Real, isCoarse>(ratio, ratio * ratio);
+
+    const Real quadrantAngle = steep * halfPi<Real> + (Real(1) - Real(2) * steep) * octantAngle;
+
+    const bool isNegativeX = std::copysign(Real(1), x) < Real(0);
+    const Real negativeOffset = isNegativeX ? pi<Real> : Real(0);
+    const Real negativeSign = isNegativeX ? Real(-1) : Real(1);
+    return std::copysign(negativeOffset + negativeSign * quadrantAngle, y);
+}
+
+//! Check if all real numbers in array are within given magnitude (and not NaN).
+/*!
+ * @tparam Real    Real type
+ * @param  values  Array of real numbers
+ * @param  size    Number of real numbers
+ * @param  limit   Largest allowed magnitude
+ * @return         True if all numbers are within limit in magnitude
+ */
+template <typename Real>
+bool isWithinMagnitude(const Real* values, const std::size_t size, const Real limit)
+{
+    int outside = 0;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        outside |= std::fabs(values[i]) <= limit ? 0 : 1;
+    }
+    return outside == 0;
+}
+
+//! Kernel computing sine of batch of angles.
+template <typename Real, bool isCoarse>
+struct SineKernel
+{
+    const Real* angles;
+    Real* sines;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            Real sine;
+            Real cosine;
+            computeSineCosine<Real, isCoarse>(angles[i], sine, cosine);
+            sines[i] = sine;
+        }
+    }
+};
+
+//! Kernel computing cosine of batch of angles.
+template <typename Real, bool isCoarse>
+struct CosineKernel
+{
+    const Real* angles;
+    Real* cosines;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            Real sine;
+            Real cosine;
+            computeSineCosine<Real, isCoarse>(angles[i], sine, cosine);
+            cosines[i] = cosine;
+        }
+    }
+};
+
+//! Kernel computing sine and cosine of batch of angles.
+template <typename Real, bool isCoarse>
+struct SineCosineKernel
+{
+    const Real* angles;
+    Real* sines;
+    Real* cosines;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            Real sine;
+            Real cosine;
+            computeSineCosine<Real, isCoarse>(angles[i], sine, cosine);
+            sines[i] = sine;
+            cosines[i] = cosine;
+        }
+    }
+};
+
+//! Kernel computing four-quadrant arctangent of batch of coordinates.
+template <typename Real, bool isCoarse>
+struct ArcTangent2Kernel
+{
+    const Real* y;
+    const Real* x;
+    Real* angles;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            angles[i] = computeArcTangent2<Real, isCoarse>(y[i], x[i]);
+        }
+    }
+};
+
+//! Execute trigonometric kernel for given accuracy.
+/*!
+ * @tparam Kernel    Kernel template, with Real type and coarse flag as parameters
+ * @tparam Real      Real type
+ * @tparam Pointers  Types of array pointers that kernel is initialized with
+ * @param  accuracy  Accuracy of kernel
+ * @param  policy    Execution policy
+ * @param  size      Number of elements to process
+ * @param  pointers  Array pointers that kernel is initialized with
+ */
+template <template <typename, bool> class Kernel, typename Real, typename... Pointers>
+void executeTrigonometricKernel(const TrigonometricAccuracy accuracy,
+                                const ExecutionPolicy& policy,
+                                const std::size_t size,
+                                Pointers... pointers)
+{
+    const std::size_t bytesPerElement = sizeof...(Pointers) * sizeof(Real);
+    if (accuracy == TrigonometricAccuracy::coarse)
+    {
+        const Kernel<Real, true> kernel = {pointers...};
+        executeKernel(kernel, size, bytesPerElement, policy);
+    }
+    else
+    {
+        const Kernel<Real, false> kernel = {pointers...};
+        executeKernel(kernel, size, bytesPerElement, policy);
+    }
+}
+
+} // namespace detail
+
+//! Compute sine of batch of angles.
+/*!
+ * Computes the sines of a vector of N angles in radians element-wise, using a vectorized
+ * polynomial approximation instead of calling std::sin() for each angle. The angles are reduced to
+ * [-pi/4, pi/4] with a branch-free wrap to the nearest multiple of pi/2 (as in
+ * computeModuloFast()), so they do not need to be wrapped beforehand. The batch is dispatched at
+ * runtime to the best instruction set supported by the CPU (see getInstructionSet()).
+ *
+ * The maximum error, measured against a long double reference for angles within the reduction
+ * range, is:
+ * - TrigonometricAccuracy::precise: 2.5 units in the last place (ULP) for double and 3 ULP for
+ *   float.
+ * - TrigonometricAccuracy::coarse: an absolute error of 2e-6, i.e., about 19 bits.
+ *
+ * The reduction range is 2^20 (about 1e6) radians for double and 8192 radians for float. For float
+ * angles close to nonzero multiples of pi/2, where the sine or cosine is much smaller than one,
+ * the error of the reduction dominates and is bounded by 1e-11 in absolute value instead. If any
+ * angle is outside the reduction range, or NaN, the batch is computed using std::sin() instead.
+ *
+ * The results can be written to the vector of angles, i.e., the sines can be computed in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeCosine, computeSineAndCosine, TrigonometricAccuracy
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result
+ * @param  angles        A vector of N angles in radians
+ * @param  sines         A vector of N sines (sized by caller)
+ * @param  accuracy      Accuracy of approximation
+ * @param  policy        Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeSine(const Vector& angles,
+                 ResultVector& sines,
+                 const TrigonometricAccuracy accuracy = TrigonometricAccuracy::precise,
+                 const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeSine", angles.size());
+    assert(sines.size() == angles.size());
+    const std::size_t size = angles.size();
+    const Real* angleData = angles.data();
+    Real* sineData = sines.data();
+    if (!detail::isWithinMagnitude(
+            angleData, size, detail::TrigonometricCoefficients<Real>::reductionLimit))
+    {
+        detail::executeInChunks([=](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                sineData[i] = std::sin(angleData[i]);
+            }
+        }, size, 2 * sizeof(Real), policy);
+        return;
+    }
+    detail::executeTrigonometricKernel<detail::SineKernel, Real>(
+        accuracy, policy, size, angleData, sineData);
+}
+
+//! Compute cosine of batch of angles.
+/*!
+ * Computes the cosines of a vector of N angles in radians element-wise, with the same method,
+ * maximum error and reduction range as computeSine(). If any angle is outside the reduction range,
+ * or NaN, the batch is computed using std::cos() instead.
+ *
+ * The results can be written to the vector of angles, i.e., the cosines can be computed in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeSine, computeSineAndCosine, TrigonometricAccuracy
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result
+ * @param  angles        A vector of N angles in radians
+ * @param  cosines       A vector of N cosines (sized by caller)
+ * @param  accuracy      Accuracy of approximation
+ * @param  policy        Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeCosine(const Vector& angles,
+                   ResultVector& cosines,
+                   const TrigonometricAccuracy accuracy = TrigonometricAccuracy::precise,
+                   const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeCosine", angles.size());
+    assert(cosines.size() == angles.size());
+    const std::size_t size = angles.size();
+    const Real* angleData = angles.data();
+    Real* cosineData = cosines.data();
+    if (!detail::isWithinMagnitude(
+            angleData, size, detail::TrigonometricCoefficients<Real>::reductionLimit))
+    {
+        detail::executeInChunks([=](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                cosineData[i] = std::cos(angleData[i]);
+            }
+        }, size, 2 * sizeof(Real), policy);
+        return;
+    }
+    detail::executeTrigonometricKernel<detail::CosineKernel, Real>(
+        accuracy, policy, size, angleData, cosineData);
+}
+
+//! Compute sine and cosine of batch of angles.
+/*!
+ * Computes the sines and cosines of a vector of N angles in radians element-wise, with the same
+ * method, maximum error and reduction range as computeSine(). Since the reduction of each angle is
+ * shared, this costs about as much as computing only the sines. If any angle is outside the
+ * reduction range, or NaN, the batch is computed using std::sin() and std::cos() instead.
+ *
+ * The sines or cosines can be written to the vector of angles, i.e., they can be computed
+ * in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeSine, computeCosine, TrigonometricAccuracy
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of results
+ * @param  angles        A vector of N angles in radians
+ * @param  sines         A vector of N sines (sized by caller)
+ * @param  cosines       A vector of N cosines (sized by caller)
+ * @param  accuracy      Accuracy of approximation
+ * @param  policy        Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeSineAndCosine(const Vector& angles,
+                          ResultVector& sines,
+                          ResultVector& cosines,
+                          const TrigonometricAccuracy accuracy = TrigonometricAccuracy::precise,
+                          const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeSineAndCosine", angles.size());
+    assert(sines.size() == angles.size());
+    assert(cosines.size() == angles.size());
+    const std::size_t size = angles.size();
+    const Real* angleData = angles.data();
+    Real* sineData = sines.data();
+    Real* cosineData = cosines.data();
+    if (!detail::isWithinMagnitude(
+            angleData, size, detail::TrigonometricCoefficients<Real>::reductionLimit))
+    {
+        detail::executeInChunks([=](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                const Real angle = angleData[i];
+                sineData[i] = std::sin(angle);
+                cosineData[i] = std::cos(angle);
+            }
+        }, size, 3 * sizeof(Real), policy);
+        return;
+    }
+    detail::executeTrigonometricKernel<detail::SineCosineKernel, Real>(
+        accuracy, policy, size, angleData, sineData, cosineData);
+}
+
+//! Compute four-quadrant arctangent of batch of coordinates.
+/*!
+ * Computes the angles of a vector of N points (x, y) element-wise, as std::atan2(y, x), using a
+ * vectorized approximation. The angles are in the range [-pi, pi], and the signs of zero
+ * coordinates are handled as by std::atan2(), e.g., the angle of (-0, +0) is pi.
+ *
+ * The maximum error, measured against a long double reference, is:
+ * - TrigonometricAccuracy::precise: 3 units in the last place (ULP) for double and float.
+ * - TrigonometricAccuracy::coarse: a relative error of 2e-6, i.e., about 19 bits.
+ *
+ * If any coordinate is infinite, NaN, or so large that intermediate sums could overflow (larger
+ * than half the largest finite number), the batch is computed using std::atan2() instead.
+ *
+ * The results can be written to either vector of coordinates, i.e., the angles can be computed
+ * in-place.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa computeSineAndCosine, TrigonometricAccuracy
+ * @tparam Real          Real type
+ * @tparam Vector        Vector type
+ * @tparam ResultVector  Vector type of result
+ * @param  y             A vector of N y-coordinates
+ * @param  x             A vector of N x-coordinates
+ * @param  angles        A vector of N angles in radians (sized by caller)
+ * @param  accuracy      Accuracy of approximation
+ * @param  policy        Execution policy
+ */
+template <typename Real, typename Vector, typename ResultVector>
+void computeArcTangent2(const Vector& y,
+                        const Vector& x,
+                        ResultVector& angles,
+                        const TrigonometricAccuracy accuracy = TrigonometricAccuracy::precise,
+                        const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("computeArcTangent2", y.size());
+    assert(x.size() == y.size());
+    assert(angles.size() == y.size());
+    const std::size_t size = y.size();
+    const Real* yData = y.data();
+    const Real* xData = x.data();
+    Real* angleData = angles.data();
+    const Real limit = std::numeric_limits<Real>::max() / Real(2);
+    if (!detail::isWithinMagnitude(yData, size, limit)
+        || !detail::isWithinMagnitude(xData, size, limit))
+    {
+        detail::executeInChunks([=](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                angleData[i] = std::atan2(yData[i], xData[i]);
+            }
+        }, size, 3 * sizeof(Real), policy);
+        return;
+    }
+    detail::executeTrigonometricKernel<detail::ArcTangent2Kernel, Real>(
+        accuracy, policy, size, yData, xData, angleData);
+}
+
+//! Explicitly instantiate batch trigonometric functions for given Real type.
+#define SML_INSTANTIATE_TRIGONOMETRY(qualifier, Real) \
+    qualifier template void computeSine<Real, std::vector<Real>, std::vector<Real> >( \
+        const std::vector<Real>&, std::vector<Real>&, const TrigonometricAccuracy, \
+        const ExecutionPolicy&); \
+    qualifier template void computeCosine<Real, std::vector<Real>, std::vector<Real> >( \
+        const std::vector<Real>&, std::vector<Real>&, const TrigonometricAccuracy, \
+        const ExecutionPolicy&); \
+    qualifier template void computeSineAndCosine<Real, std::vector<Real>, std::vector<Real> >( \
+        const std::vector<Real>&, std::vector<Real>&, std::vector<Real>&, \
+        const TrigonometricAccuracy, const ExecutionPolicy&); \
+    qualifier template void computeArcTangent2<Real, std::vector<Real>, std::vector<Real> >( \
+        const std::vector<Real>&, const std::vector<Real>&, std::vector<Real>&, \
+        const TrigonometricAccuracy, const ExecutionPolicy&);
+
+//! Explicitly instantiate batch trigonometric functions for common types (see sml_compiled).
+#define SML_INSTANTIATE_TRIGONOMETRY_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_TRIGONOMETRY(qualifier, double) \
+    SML_INSTANTIATE_TRIGONOMETRY(qualifier, float)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_TRIGONOMETRY_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
@@ -0,0 +1,707 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "sml/arrayView.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/linearAlgebra.hpp"
+#include "sml/profiling.hpp"
+#include "sml/simd.hpp"
+#include "sml/vectorTraits.hpp"
+
+namespace sml
+{
+
+//! Batch of 3-vectors.
+/*!
+ * Container for a batch of N 3-vectors, e.g., positions of satellites or debris, stored as a
+ * structure-of-arrays (SoA): the x-, y- and z-components of all vectors are stored in three
+ * separate, contiguous arrays. This layout allows the batch functions, e.g., cross(), dot() and
+ * normalize(), to process multiple vectors per instruction using SIMD registers.
+ *
+ * The batch functions are dispatched at runtime to the best instruction set supported by the CPU
+ * (see getInstructionSet()). Since wider instruction sets can fuse multiplications and additions,
+ * results may differ in the last bit between instruction sets. Large batches can be split into
+ * chunks that are processed on multiple threads, by passing an ExecutionPolicy.
+ *
+ * @sa convertToStructureOfArrays, convertToArrayOfStructures
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class Vector3Batch
+{
+public:
+
+    //! Element type.
+    typedef Real value_type;
+
+    //! Construct empty batch.
+    Vector3Batch() { }
+
+    //! Construct batch of zero-vectors.
+    /*!
+     * @param  size  Number of 3-vectors N
+     */
+    explicit Vector3Batch(const std::size_t size)
+        : xComponents(size),
+          yComponents(size),
+          zComponents(size)
+    { }
+
+    //! Get number of 3-vectors.
+    /*!
+     * @return  Number of 3-vectors N
+     */
+    std::size_t size() const { return xComponents.size(); }
+
+    //! Resize batch.
+    /*!
+     * @param  size  Number of 3-vectors N
+     */
+    void resize(const std::size_t size)
+    {
+        xComponents.resize(size);
+        yComponents.resize(size);
+        zComponents.resize(size);
+    }
+
+    //! Set 3-vector.
+    /*!
+     * @tparam Vector3  3-Vector type
+     * @param  index    Index of 3-vector in batch
+     * @param  vector   A 3-vector
+     */
+    template <typename Vector3>
+    void set(const std::size_t index, const Vector3& vector)
+    {
+        assert(index < size() && vector.size() == 3);
+        xComponents[index] = vector[0];
+        yComponents[index] = vector[1];
+        zComponents[index] = vector[2];
+    }
+
+    //! Get 3-vector.
+    /*!
+     * @tparam Vector3  3-Vector type
+     * @param  index    Index of 3-vector in batch
+     * @return          3-vector
+     */
+    template <typename Vector3>
+    Vector3 get(const std::size_t index) const
+    {
+        assert(index < size());
+        return VectorTraits<Vector3>::create(
+            xComponents[index], yComponents[index], zComponents[index]);
+    }
+
+    //! Get x-components.
+    /*!
+     * @return  Pointer to contiguous array of N x-components
+     */
+    Real* getX() { return xComponents.data(); }
+
+    //! Get x-components.
+    /*!
+     * @return  Const pointer to contiguous array of N x-components
+     */
+    const Real* getX() const { return xComponents.data(); }
+
+    //! Get y-components.
+    /*!
+     * @return  Pointer to contiguous array of N y-components
+     */
+    Real* getY() { return yComponents.data(); }
+
+    //! Get y-components.
+    /*!
+     * @return  Const pointer to contiguous array of N y-components
+     */
+    const Real* getY() const { return yComponents.data(); }
+
+    //! Get z-components.
+    /*!
+     * @return  Pointer to contiguous array of N z-components
+     */
+    Real* getZ() { return zComponents.data(); }
+
+    //! Get z-components.
+    /*!
+     * @return  Const pointer to contiguous array of N z-components
+     */
+    const Real* getZ() const { return zComponents.data(); }
+
+private:
+
+    //! x-components of 3-vectors.
+    std::vector<Real> xComponents;
+
+    //! y-components of 3-vectors.
+    std::vector<Real> yComponents;
+
+    //! z-components of 3-vectors.
+    std::vector<Real> zComponents;
+};
+
+//! Convert array of 3-vectors to structure-of-arrays.
+/*!
+ * Converts a collection of N 3-vectors (array-of-structures), e.g., std::vector<std::array<Real,3>>,
+ * to a batch of 3-vectors (structure-of-arrays).
+ *
+ * @sa convertToArrayOfStructures
+ * @tparam Real               Real type
+ * @tparam Vector3Collection  Collection type of 3-vectors
+ * @param  vectors            A collection of N 3-vectors
+ * @return                    Batch of N 3-vectors
+ */
+template <typename Real, typename Vector3Collection>
+Vector3Batch<Real> convertToStructureOfArrays(const Vector3Collection& vectors)
+{
+    Vector3Batch<Real> batch(vectors.size());
+    std::size_t index = 0;
+    for (auto& vector : vectors)
+    {
+        batch.set(index++, vector);
+    }
+    return batch;
+}
+
+//! Convert structure-of-arrays to array of 3-vectors.
+/*!
+ * Converts a batch of N 3-vectors (structure-of-arrays) to a std::vector of N 3-vectors
+ * (array-of-structures).
+ *
+ * @sa convertToStructureOfArrays
+ * @tparam Vector3  3-Vector type
+ * @tparam Real     Real type
+ * @param  batch    Batch of N 3-vectors
+ * @return          Vector of N 3-vectors
+ */
+template <typename Vector3, typename Real>
+std::vector<Vector3> convertToArrayOfStructures(const Vector3Batch<Real>& batch)
+{
+    std::vector<Vector3> vectors;
+    vectors.reserve(batch.size());
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+        vectors.push_back(batch.template get<Vector3>(i));
+    }
+    return vectors;
+}
+
+namespace detail
+{
+
+//! Kernel computing cross-products of batches of 3-vectors.
+template <typename Real>
+struct CrossKernel
+{
+    const Real* x1; const Real* y1; const Real* z1;
+    const Real* x2; const Real* y2; const Real* z2;
+    Real* x; Real* y; Real* z;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Real resultX = y1[i] * z2[i] - z1[i] * y2[i];
+            const Real resultY = z1[i] * x2[i] - x1[i] * z2[i];
+            const Real resultZ = x1[i] * y2[i] - y1[i] * x2[i];
+            x[i] = resultX;
+            y[i] = resultY;
+            z[i] = resultZ;
+        }
+    }
+};
+
+//! Kernel computing dot-products of batches of 3-vectors.
+template <typename Real>
+struct DotKernel
+{
+    const Real* x1; const Real* y1; const Real* z1;
+    const Real* x2; const Real* y2; const Real* z2;
+    Real* results;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            results[i] = x1[i] * x2[i] + y1[i] * y2[i] + z1[i] * z2[i];
+        }
+    }
+};
+
+//! Kernel computing (squared) norms of batch of 3-vectors.
+template <typename Real, bool isSquared>
+struct NormKernel
+{
+    const Real* x; const Real* y; const Real* z;
+    Real* results;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Real squaredNorm = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+            results[i] = isSquared ? squaredNorm : std::sqrt(squaredNorm);
+        }
+    }
+};
+
+//! Kernel normalizing batch of 3-vectors.
+template <typename Real>
+struct NormalizeKernel
+{
+    const Real* x; const Real* y; const Real* z;
+    Real* resultX; Real* resultY; Real* resultZ;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Real norm = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+            resultX[i] = x[i] / norm;
+            resultY[i] = y[i] / norm;
+            resultZ[i] = z[i] / norm;
+        }
+    }
+};
+
+//! Kernel multiplying array by scalar element-wise.
+template <typename Real>
+struct MultiplyKernel
+{
+    const Real* array;
+    Real multiplier;
+    Real* result;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            result[i] = multiplier * array[i];
+        }
+    }
+};
+
+//! Kernel adding scalar to array element-wise.
+template <typename Real>
+struct AddScalarKernel
+{
+    const Real* array;
+    Real adder;
+    Real* result;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            result[i] = adder + array[i];
+        }
+    }
+};
+
+//! Kernel adding two arrays element-wise.
+template <typename Real>
+struct AddKernel
+{
+    const Real* array1;
+    const Real* array2;
+    Real* result;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            result[i] = array1[i] + array2[i];
+        }
+    }
+};
+
+//! Kernel filling array with constant value.
+template <typename Real>
+struct FillKernel
+{
+    Real value;
+    Real* result;
+
+    SML_FORCE_INLINE void operator()(const std::size_t begin, const std::size_t end) const
+    {
+        SML_SIMD_LOOP
+        for (std::size_t i = begin; i < end; i++)
+        {
+            result[i] = value;
+        }
+    }
+};
+
+//! Create batch of unit-vectors.
+/*!
+ * @tparam Real  Real type
+ * @param  size  Number of 3-vectors N
+ * @param  axis  Index of non-zero component (0: x, 1: y, 2: z)
+ * @return       Batch of N unit-vectors along specified axis
+ */
+template <typename Real>
+Vector3Batch<Real> createUnitVectors(const std::size_t size, const std::size_t axis)
+{
+    Vector3Batch<Real> batch(size);
+    Real* components[3] = {batch.getX(), batch.getY(), batch.getZ()};
+    const FillKernel<Real> kernel = {Real(1), components[axis]};
+    executeKernel(kernel, 0, size);
+    return batch;
+}
+
+} // namespace detail
+
+//! Compute cross-products of batches of 3-vectors.
+/*!
+ * Computes the cross-products of two batches of N 3-vectors element-wise, i.e.,
+ * \f$\bar{R}_{i} = \bar{X}_{i} \times \bar{Y}_{i}\f$. The result can be one of the input batches.
+ *
+ * The kernel is vectorized for the instruction set selected at runtime (see getInstructionSet()).
+ *
+ * @sa cross
+ * @tparam Real    Real type
+ * @param  batch1  A batch of N 3-vectors
+ * @param  batch2  A batch of N 3-vectors
+ * @param  result  Batch of N 3-vectors resulting from cross-products (resized if necessary)
+ * @param  policy  Execution policy
+ */
+template <typename Real>
+void cross(const Vector3Batch<Real>& batch1,
+           const Vector3Batch<Real>& batch2,
+           Vector3Batch<Real>& result,
+           const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("cross(batch)", batch1.size());
+    assert(batch1.size() == batch2.size());
+    result.resize(batch1.size());
+    const detail::CrossKernel<Real> kernel = {batch1.getX(), batch1.getY(), batch1.getZ(),
+                                              batch2.getX(), batch2.getY(), batch2.getZ(),
+                                              result.getX(), result.getY(), result.getZ()};
+    detail::executeKernel(kernel, batch1.size(), 9 * sizeof(Real), policy);
+}
+
+//! Compute dot-products of batches of 3-vectors.
+/*!
+ * Computes the dot-products of two batches of N 3-vectors element-wise, i.e.,
+ * \f$r_{i} = \bar{X}_{i} \cdot \bar{Y}_{i}\f$.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa dot
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  batch1   A batch of N 3-vectors
+ * @param  batch2   A batch of N 3-vectors
+ * @param  results  A vector of N dot-products (sized by caller)
+ * @param  policy   Execution policy
+ */
+template <typename Real, typename Vector>
+void dot(const Vector3Batch<Real>& batch1,
+         const Vector3Batch<Real>& batch2,
+         Vector& results,
+         const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("dot(batch)", batch1.size());
+    assert(batch1.size() == batch2.size() && results.size() == batch1.size());
+    const detail::DotKernel<Real> kernel = {batch1.getX(), batch1.getY(), batch1.getZ(),
+                                            batch2.getX(), batch2.getY(), batch2.getZ(),
+                                            results.data()};
+    detail::executeKernel(kernel, batch1.size(), 7 * sizeof(Real), policy);
+}
+
+//! Compute squared-norms of batch of 3-vectors.
+/*!
+ * Computes the squared Euclidean norms of a batch of N 3-vectors.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa squaredNorm
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  batch    A batch of N 3-vectors
+ * @param  results  A vector of N squared-norms (sized by caller)
+ * @param  policy   Execution policy
+ */
+template <typename Real, typename Vector>
+void squaredNorm(const Vector3Batch<Real>& batch,
+                 Vector& results,
+                 const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("squaredNorm(batch)", batch.size());
+    assert(results.size() == batch.size());
+    const detail::NormKernel<Real, true> kernel = {batch.getX(), batch.getY(), batch.getZ(),
+                                                   results.data()};
+    detail::executeKernel(kernel, batch.size(), 4 * sizeof(Real), policy);
+}
+
+//! Compute norms of batch of 3-vectors.
+/*!
+ * Computes the Euclidean norms of a batch of N 3-vectors.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - .size() (vector length function)
+ * - .data() (pointer to contiguous storage)
+ *
+ * @sa norm
+ * @tparam Real     Real type
+ * @tparam Vector   Vector type
+ * @param  batch    A batch of N 3-vectors
+ * @param  results  A vector of N norms (sized by caller)
+ * @param  policy   Execution policy
+ */
+template <typename Real, typename Vector>
+void norm(const Vector3Batch<Real>& batch,
+          Vector& results,
+          const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("norm(batch)", batch.size());
+    assert(results.size() == batch.size());
+    const detail::NormKernel<Real, false> kernel = {batch.getX(), batch.getY(), batch.getZ(),
+                                                    results.data()};
+    detail::executeKernel(kernel, batch.size(), 4 * sizeof(Real), policy);
+}
+
+//! Normalize batch of 3-vectors.
+/*!
+ * Normalizes a batch of N 3-vectors, by dividing each 3-vector by its Euclidean norm. The result
+ * can be the input batch.
+ *
+ * @sa normalize
+ * @tparam Real    Real type
+ * @param  batch   A batch of N 3-vectors
+ * @param  result  Batch of N unit-vectors (resized if necessary)
+ * @param  policy  Execution policy
+ */
+template <typename Real>
+void normalize(const Vector3Batch<Real>& batch,
+               Vector3Batch<Real>& result,
+               const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("normalize(batch)", batch.size());
+    result.resize(batch.size());
+    const detail::NormalizeKernel<Real> kernel = {batch.getX(), batch.getY(), batch.getZ(),
+                                                  result.getX(), result.getY(), result.getZ()};
+    detail::executeKernel(kernel, batch.size(), 6 * sizeof(Real), policy);
+}
+
+//! Multiply batch of 3-vectors by scalar element-wise.
+/*!
+ * Multiplies each component of a batch of N 3-vectors by a scalar. The result can be the input
+ * batch.
+ *
+ * @sa multiply
+ * @tparam Real        Real type
+ * @param  batch       A batch of N 3-vectors
+ * @param  multiplier  Multiplier to multiply 3-vectors element-wise
+ * @param  result      Batch of N 3-vectors multiplied element-wise (resized if necessary)
+ * @param  policy      Execution policy
+ */
+template <typename Real>
+void multiply(const Vector3Batch<Real>& batch,
+              const Real multiplier,
+              Vector3Batch<Real>& result,
+              const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("multiply(batch)", batch.size());
+    result.resize(batch.size());
+    const Real* components[3] = {batch.getX(), batch.getY(), batch.getZ()};
+    Real* results[3] = {result.getX(), result.getY(), result.getZ()};
+    for (std::size_t k = 0; k < 3; k++)
+    {
+        const detail::MultiplyKernel<Real> kernel = {components[k], multiplier, results[k]};
+        detail::executeKernel(kernel, batch.size(), 2 * sizeof(Real), policy);
+    }
+}
+
+//! Add scalar to batch of 3-vectors element-wise.
+/*!
+ * Adds a scalar to each component of a batch of N 3-vectors. The result can be the input batch.
+ *
+ * @sa add
+ * @tparam Real    Real type
+ * @param  batch   A batch of N 3-vectors
+ * @param  adder   Scalar to add to 3-vectors element-wise
+ * @param  result  Batch of N 3-vectors added to element-wise (resized if necessary)
+ * @param  policy  Execution policy
+ */
+template <typename Real>
+void add(const Vector3Batch<Real>& batch,
+         const Real adder,
+         Vector3Batch<Real>& result,
+         const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("add(batch)", batch.size());
+    result.resize(batch.size());
+    const Real* components[3] = {batch.getX(), batch.getY(), batch.getZ()};
+    Real* results[3] = {result.getX(), result.getY(), result.getZ()};
+    for (std::size_t k = 0; k < 3; k++)
+    {
+        const detail::AddScalarKernel<Real> kernel = {components[k], adder, results[k]};
+        detail::executeKernel(kernel, batch.size(), 2 * sizeof(Real), policy);
+    }
+}
+
+//! Add two batches of 3-vectors element-wise.
+/*!
+ * Adds two batches of N 3-vectors element-wise. The result can be one of the input batches.
+ *
+ * @sa add
+ * @tparam Real    Real type
+ * @param  batch1  A batch of N 3-vectors
+ * @param  batch2  A batch of N 3-vectors
+ * @param  result  Batch of N 3-vectors resulting from element-wise addition (resized if necessary)
+ * @param  policy  Execution policy
+ */
+template <typename Real>
+void add(const Vector3Batch<Real>& batch1,
+         const Vector3Batch<Real>& batch2,
+         Vector3Batch<Real>& result,
+         const ExecutionPolicy& policy = ExecutionPolicy())
+{
+    SML_PROFILE("add(batch)", batch1.size());
+    assert(batch1.size() == batch2.size());
+    result.resize(batch1.size());
+    const Real* components1[3] = {batch1.getX(), batch1.getY(), batch1.getZ()};
+    const Real* components2[3] = {batch2.getX(), batch2.getY(), batch2.getZ()};
+    Real* results[3] = {result.getX(), result.getY(), result.getZ()};
+    for (std::size_t k = 0; k < 3; k++)
+    {
+        const detail::AddKernel<Real> kernel = {components1[k], components2[k], results[k]};
+        detail::executeKernel(kernel, batch1.size(), 3 * sizeof(Real), policy);
+    }
+}
+
+//! Compute centroid of batch of 3-vectors using specified summation method.
+/*!
+ * Computes the centroid (mean) of a batch of N 3-vectors, e.g., a point cloud, by summing each
+ * component array using the specified method (see sum()). With SummationMethod::kahan, a
+ * single-precision batch yields a centroid that is accurate to single precision irrespective of
+ * N, at half the memory traffic of a double-precision batch.
+ *
+ * @sa sum, SummationMethod
+ * @tparam Vector3  3-Vector type
+ * @tparam Real     Real type
+ * @param  batch    A batch of N 3-vectors (N > 0)
+ * @param  method   Summation method
+ * @return          Centroid of 3-vectors
+ */
+template <typename Vector3, typename Real>
+Vector3 computeCentroid(const Vector3Batch<Real>& batch, const SummationMethod method)
+{
+    SML_PROFILE("computeCentroid", batch.size());
+    assert(batch.size() > 0);
+    const std::size_t size = batch.size();
+    const Real inverseSize = Real(1) / static_cast<Real>(size);
+    return VectorTraits<Vector3>::create(
+        sum<Real>(ArrayView<const Real>(batch.getX(), size), method) * inverseSize,
+        sum<Real>(ArrayView<const Real>(batch.getY(), size), method) * inverseSize,
+        sum<Real>(ArrayView<const Real>(batch.getZ(), size), method) * inverseSize);
+}
+
+//! Compute centroid of batch of 3-vectors.
+/*!
+ * Computes the centroid (mean) of a batch of N 3-vectors, summing the components pairwise.
+ *
+ * @sa sum
+ * @tparam Vector3  3-Vector type
+ * @tparam Real     Real type
+ * @param  batch    A batch of N 3-vectors (N > 0)
+ * @return          Centroid of 3-vectors
+ */
+template <typename Vector3, typename Real>
+Vector3 computeCentroid(const Vector3Batch<Real>& batch)
+{
+    return computeCentroid<Vector3>(batch, SummationMethod::pairwise);
+}
+
+//! Get batch of unit-vectors in x-direction.
+/*!
+ * @sa getXUnitVector
+ * @tparam Real  Real type
+ * @param  size  Number of 3-vectors N
+ * @return       Batch of N unit-vectors in x-direction
+ */
+template <typename Real>
+Vector3Batch<Real> getXUnitVectors(const std::size_t size)
+{
+    return detail::createUnitVectors<Real>(size, 0);
+}
+
+//! Get batch of unit-vectors in y-direction.
+/*!
+ * @sa getYUnitVector
+ * @tparam Real  Real type
+ * @param  size  Number of 3-vectors N
+ * @return       Batch of N unit-vectors in y-direction
+ */
+template <typename Real>
+Vector3Batch<Real> getYUnitVectors(const std::size_t size)
+{
+    return detail::createUnitVectors<Real>(size, 1);
+}
+
+//! Get batch of unit-vectors in z-direction.
+/*!
+ * @sa getZUnitVector
+ * @tparam Real  Real type
+ * @param  size  Number of 3-vectors N
+ * @return       Batch of N unit-vectors in z-direction
+ */
+template <typename Real>
+Vector3Batch<Real> getZUnitVectors(const std::size_t size)
+{
+    return detail::createUnitVectors<Real>(size, 2);
+}
+
+//! Explicitly instantiate batch functions of 3-vectors for given Real type.
+#define SML_INSTANTIATE_VECTOR3_BATCH(qualifier, Real) \
+    qualifier template class Vector3Batch<Real>; \
+    qualifier template void cross<Real>(const Vector3Batch<Real>&, const Vector3Batch<Real>&, \
+        Vector3Batch<Real>&, const ExecutionPolicy&); \
+    qualifier template void dot<Real, std::vector<Real> >(const Vector3Batch<Real>&, \
+        const Vector3Batch<Real>&, std::vector<Real>&, const ExecutionPolicy&); \
+    qualifier template void squaredNorm<Real, std::vector<Real> >( \
+        const Vector3Batch<Real>&, std::vector<Real>&, const ExecutionPolicy&); \
+    qualifier template void norm<Real, std::vector<Real> >( \
+        const Vector3Batch<Real>&, std::vector<Real>&, const ExecutionPolicy&); \
+    qualifier template void normalize( \
+        const Vector3Batch<Real>&, Vector3Batch<Real>&, const ExecutionPolicy&); \
+    qualifier template void multiply<Real>( \
+        const Vector3Batch<Real>&, const Real, Vector3Batch<Real>&, const ExecutionPolicy&); \
+    qualifier template void add<Real>( \
+        const Vector3Batch<Real>&, const Real, Vector3Batch<Real>&, const ExecutionPolicy&); \
+    qualifier template void add<Real>(const Vector3Batch<Real>&, const Vector3Batch<Real>&, \
+        Vector3Batch<Real>&, const ExecutionPolicy&);
+
+//! Explicitly instantiate batch functions of 3-vectors for common types (see sml_compiled).
+#define SML_INSTANTIATE_VECTOR3_BATCH_FOR_COMMON_TYPES(qualifier) \
+    SML_INSTANTIATE_VECTOR3_BATCH(qualifier, double) \
+    SML_INSTANTIATE_VECTOR3_BATCH(qualifier, float)
+
+#ifdef SML_USE_COMPILED_LIBRARY
+SML_INSTANTIATE_VECTOR3_BATCH_FOR_COMMON_TYPES(extern)
+#endif
+
+} // namespace sml
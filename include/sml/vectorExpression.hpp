@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "sml/simd.hpp"
+#include "sml/vectorTraits.hpp"
+
+// Lazy (expression template) counterparts of the element-wise functions in linearAlgebra.hpp.
+// The functions in the sml::expression namespace do not compute anything: they return lightweight
+// objects that describe the operation. Chains of these objects are evaluated in a single loop by
+// evaluate(), which writes straight into the destination vector, e.g.:
+//
+//     evaluate(expression::add(expression::multiply<Real>(velocity, dt), position), position);
+//
+// computes position = dt * velocity + position in one pass over memory, without the temporaries
+// created by add(multiply(velocity, dt), position).
+//
+// Expressions store references to the vectors that they are built from, so the vectors must
+// outlive the expression. Expressions built from other expressions store copies of them, so that
+// chains can be built from temporaries in a single statement.
+
+namespace sml
+{
+
+//! Trait indicating if type is a vector expression.
+/*!
+ * @tparam T  Type
+ */
+template <typename T>
+struct IsVectorExpression : std::false_type { };
+
+namespace detail
+{
+
+//! Type used to store operand of vector expression.
+/*!
+ * Vectors are stored by reference, and expressions are stored by value.
+ *
+ * @tparam T                   Operand type
+ * @tparam isVectorExpression  Flag indicating if operand is a vector expression
+ */
+template <typename T, bool isVectorExpression = IsVectorExpression<T>::value>
+struct ExpressionOperand
+{
+    typedef const T& Type;
+};
+
+template <typename T>
+struct ExpressionOperand<T, true>
+{
+    typedef T Type;
+};
+
+//! Element type of vector or vector expression.
+/*!
+ * @tparam T  Vector or vector expression type
+ */
+template <typename T>
+struct ExpressionValue
+{
+    typedef typename std::decay<decltype(std::declval<const T&>()[0])>::type Type;
+};
+
+} // namespace detail
+
+//! Expression for multiplication of vector by scalar element-wise.
+/*!
+ * Lazy counterpart of multiply(vector, multiplier). Element i is computed when accessed.
+ *
+ * @sa expression::multiply
+ * @tparam Operand  Vector or vector expression type
+ * @tparam Real     Real type
+ */
+template <typename Operand, typename Real>
+class MultiplyExpression
+{
+public:
+
+    //! Element type.
+    typedef typename detail::ExpressionValue<Operand>::Type value_type;
+
+    //! Construct expression.
+    /*!
+     * @param  someOperand     Vector or vector expression to multiply element-wise
+     * @param  someMultiplier  Multiplier to multiply vector element-wise
+     */
+    MultiplyExpression(const Operand& someOperand, const Real someMultiplier)
+        : operand(someOperand),
+          multiplier(someMultiplier)
+    { }
+
+    //! Compute element.
+    /*!
+     * @param  index  Index of element
+     * @return        Element of vector multiplied element-wise
+     */
+    SML_FORCE_INLINE value_type operator[](const std::size_t index) const
+    {
+        return multiplier * operand[index];
+    }
+
+    //! Get number of elements.
+    /*!
+     * @return  Number of elements N
+     */
+    std::size_t size() const { return operand.size(); }
+
+private:
+
+    //! Vector or vector expression to multiply element-wise.
+    typename detail::ExpressionOperand<Operand>::Type operand;
+
+    //! Multiplier.
+    Real multiplier;
+};
+
+//! Expression for addition of scalar element-wise.
+/*!
+ * Lazy counterpart of add(vector, adder). Element i is computed when accessed.
+ *
+ * @sa expression::add
+ * @tparam Operand  Vector or vector expression type
+ * @tparam Real     Real type
+ */
+template <typename Operand, typename Real>
+class AddScalarExpression
+{
+public:
+
+    //! Element type.
+    typedef typename detail::ExpressionValue<Operand>::Type value_type;
+
+    //! Construct expression.
+    /*!
+     * @param  someOperand  Vector or vector expression to add to element-wise
+     * @param  someAdder    Scalar to add element-wise
+     */
+    AddScalarExpression(const Operand& someOperand, const Real someAdder)
+        : operand(someOperand),
+          adder(someAdder)
+    { }
+
+    //! Compute element.
+    /*!
+     * @param  index  Index of element
+     * @return        Element of vector added to element-wise
+     */
+    SML_FORCE_INLINE value_type operator[](const std::size_t index) const
+    {
+        return adder + operand[index];
+    }
+
+    //! Get number of elements.
+    /*!
+     * @return  Number of elements N
+     */
+    std::size_t size() const { return operand.size(); }
+
+private:
+
+    //! Vector or vector expression to add to element-wise.
+    typename detail::ExpressionOperand<Operand>::Type operand;
+
+    //! Scalar to add element-wise.
+    Real adder;
+};
+
+//! Expression for addition of two vectors element-wise.
+/*!
+ * Lazy counterpart of add(vector1, vector2). Element i is computed when accessed.
+ *
+ * @sa expression::add
+ * @tparam Operand1  Vector or vector expression type
+ * @tparam Operand2  Vector or vector expression type
+ */
+template <typename Operand1, typename Operand2>
+class AddExpression
+{
+public:
+
+    //! Element type.
+    typedef typename detail::ExpressionValue<Operand1>::Type value_type;
+
+    //! Construct expression.
+    /*!
+     * @param  someOperand1  Vector or vector expression of length N
+     * @param  someOperand2  Vector or vector expression of length N
+     */
+    AddExpression(const Operand1& someOperand1, const Operand2& someOperand2)
+        : operand1(someOperand1),
+          operand2(someOperand2)
+    {
+        assert(operand1.size() == operand2.size());
+    }
+
+    //! Compute element.
+    /*!
+     * @param  index  Index of element
+     * @return        Element of vector resulting from element-wise addition
+     */
+    SML_FORCE_INLINE value_type operator[](const std::size_t index) const
+    {
+        return operand1[index] + operand2[index];
+    }
+
+    //! Get number of elements.
+    /*!
+     * @return  Number of elements N
+     */
+    std::size_t size() const { return operand1.size(); }
+
+private:
+
+    //! First vector or vector expression.
+    typename detail::ExpressionOperand<Operand1>::Type operand1;
+
+    //! Second vector or vector expression.
+    typename detail::ExpressionOperand<Operand2>::Type operand2;
+};
+
+template <typename Operand, typename Real>
+struct IsVectorExpression<MultiplyExpression<Operand, Real> > : std::true_type { };
+
+template <typename Operand, typename Real>
+struct IsVectorExpression<AddScalarExpression<Operand, Real> > : std::true_type { };
+
+template <typename Operand1, typename Operand2>
+struct IsVectorExpression<AddExpression<Operand1, Operand2> > : std::true_type { };
+
+namespace expression
+{
+
+//! Multiply by scalar element-wise, lazily.
+/*!
+ * Returns an expression that multiplies each element of a vector (or vector expression) of length
+ * N by a scalar, when evaluated.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa sml::multiply, evaluate
+ * @tparam Real        Real type
+ * @tparam Vector      Vector or vector expression type
+ * @param  vector      Vector or vector expression to multiply element-wise
+ * @param  multiplier  Multiplier to multiply vector element-wise
+ * @return             Expression for vector multiplied element-wise
+ */
+template <typename Real, typename Vector>
+MultiplyExpression<Vector, Real> multiply(const Vector& vector, const Real multiplier)
+{
+    return MultiplyExpression<Vector, Real>(vector, multiplier);
+}
+
+//! Add scalar element-wise, lazily.
+/*!
+ * Returns an expression that adds a scalar to each element of a vector (or vector expression) of
+ * length N, when evaluated.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa sml::add, evaluate
+ * @tparam Real    Real type
+ * @tparam Vector  Vector or vector expression type
+ * @param  vector  Vector or vector expression to add to element-wise
+ * @param  adder   Scalar to add element-wise
+ * @return         Expression for vector added to element-wise
+ */
+template <typename Real, typename Vector>
+typename std::enable_if<std::is_arithmetic<Real>::value, AddScalarExpression<Vector, Real> >::type
+add(const Vector& vector, const Real adder)
+{
+    return AddScalarExpression<Vector, Real>(vector, adder);
+}
+
+//! Add two vectors element-wise, lazily.
+/*!
+ * Returns an expression that adds two vectors (or vector expressions) of length N element-wise,
+ * when evaluated. The operands can be of different types, e.g., a vector and an expression.
+ *
+ * Note that the Vector types must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa sml::add, evaluate
+ * @tparam Vector1  Vector or vector expression type
+ * @tparam Vector2  Vector or vector expression type
+ * @param  vector1  A vector or vector expression to add to element-wise
+ * @param  vector2  A vector or vector expression to add to element-wise
+ * @return          Expression for element-wise addition of two vectors
+ */
+template <typename Vector1, typename Vector2>
+typename std::enable_if<!std::is_arithmetic<Vector2>::value,
+                        AddExpression<Vector1, Vector2> >::type
+add(const Vector1& vector1, const Vector2& vector2)
+{
+    return AddExpression<Vector1, Vector2>(vector1, vector2);
+}
+
+} // namespace expression
+
+//! Evaluate vector expression into destination vector.
+/*!
+ * Evaluates a vector expression of length N in a single loop, writing each element straight into
+ * the destination vector. The destination may be one of the vectors that the expression is built
+ * from, e.g., to update a vector in-place, since element i of an expression only depends on
+ * element i of its operands.
+ *
+ * The result is identical to that of the equivalent chain of eager functions, e.g.,
+ * add(multiply(vector1, multiplier), vector2), unless the compiler contracts multiplications and
+ * additions into fused multiply-add instructions (e.g., -ffp-contract=fast, the GCC default when
+ * FMA instructions are available).
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - [] (element access operator, returning floating-point number)
+ * - .size() (vector length function)
+ *
+ * @sa expression::multiply, expression::add
+ * @tparam Expression        Vector expression type
+ * @tparam Vector            Vector type
+ * @param  vectorExpression  Vector expression of length N
+ * @param  destination       Vector of length N to write result to
+ */
+template <typename Expression, typename Vector>
+void evaluate(const Expression& vectorExpression, Vector& destination)
+{
+    assert(destination.size() == vectorExpression.size());
+    const std::size_t size = vectorExpression.size();
+    SML_SIMD_LOOP
+    for (std::size_t i = 0; i < size; i++)
+    {
+        destination[i] = vectorExpression[i];
+    }
+}
+
+//! Evaluate vector expression into new vector.
+/*!
+ * Evaluates a vector expression of length N in a single loop, and returns the result as a new
+ * vector, created using VectorTraits.
+ *
+ * Note that the Vector type must support the following operation/functions:
+ * - constructor to create object with array of specified length (or a VectorTraits
+ *   specialization, e.g., for std::array and FixedVector)
+ * - [] (element access operator, returning floating-point number)
+ *
+ * @sa evaluate, VectorTraits
+ * @tparam Vector            Vector type
+ * @tparam Expression        Vector expression type
+ * @param  vectorExpression  Vector expression of length N
+ * @return                   Vector of length N containing result
+ */
+template <typename Vector, typename Expression>
+Vector evaluate(const Expression& vectorExpression)
+{
+    Vector result = VectorTraits<Vector>::create(vectorExpression.size());
+    evaluate(vectorExpression, result);
+    return result;
+}
+
+} // namespace sml
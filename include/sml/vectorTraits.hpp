@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+#include "sml/fixedVector.hpp"
+
+namespace sml
+{
+
+//! Vector traits.
+/*!
+ * Traits that describe how the generic functions in sml create vectors of a given type. The
+ * traits are resolved at compile time, so that functions such as cross() and getXUnitVector()
+ * construct dynamically-sized vectors (e.g., std::vector) with the required length, and
+ * fixed-size vectors (e.g., std::array, FixedVector) on the stack, without heap allocation.
+ * Dynamically-sized vectors can also be created with a caller-supplied allocator, e.g., an
+ * ArenaAllocator, which fixed-size vectors ignore.
+ *
+ * By default, a vector of length N is created by calling the constructor Vector(N). To use a
+ * vector type that cannot be constructed like this, specialize VectorTraits for that type.
+ *
+ * @tparam Vector  Vector type
+ */
+template <typename Vector>
+struct VectorTraits
+{
+    //! Flag indicating if size of vector is fixed at compile time.
+    static const bool isFixedSize = false;
+
+    //! Create vector.
+    /*!
+     * @param  size  Number of elements N
+     * @return       Vector of length N
+     */
+    static Vector create(const std::size_t size)
+    {
+        return Vector(size);
+    }
+
+    //! Create 3-vector with specified elements.
+    /*!
+     * @param  x  First element
+     * @param  y  Second element
+     * @param  z  Third element
+     * @return    3-vector
+     */
+    template <typename Real>
+    static Vector create(const Real x, const Real y, const Real z)
+    {
+        Vector vector(3);
+        vector[0] = x;
+        vector[1] = y;
+        vector[2] = z;
+        return vector;
+    }
+
+    //! Create vector using allocator.
+    /*!
+     * Creates vector by calling the allocator-extended constructor Vector(N, allocator), e.g., to
+     * allocate the elements from a MonotonicArena instead of the heap.
+     *
+     * @tparam Allocator  Allocator type, convertible to allocator type of Vector
+     * @param  size       Number of elements N
+     * @param  allocator  Allocator to allocate elements with
+     * @return            Vector of length N
+     */
+    template <typename Allocator>
+    static Vector create(const std::size_t size, const Allocator& allocator)
+    {
+        return Vector(size, allocator);
+    }
+
+    //! Create 3-vector with specified elements using allocator.
+    /*!
+     * @tparam Allocator  Allocator type, convertible to allocator type of Vector
+     * @param  x          First element
+     * @param  y          Second element
+     * @param  z          Third element
+     * @param  allocator  Allocator to allocate elements with
+     * @return            3-vector
+     */
+    template <typename Real, typename Allocator>
+    static Vector create(const Real x, const Real y, const Real z, const Allocator& allocator)
+    {
+        Vector vector(3, allocator);
+        vector[0] = x;
+        vector[1] = y;
+        vector[2] = z;
+        return vector;
+    }
+};
+
+//! Vector traits for std::array.
+/*!
+ * @sa VectorTraits
+ * @tparam Real  Real type
+ * @tparam Size  Number of elements N
+ */
+template <typename Real, std::size_t Size>
+struct VectorTraits<std::array<Real, Size> >
+{
+    //! Flag indicating if size of vector is fixed at compile time.
+    static const bool isFixedSize = true;
+
+    //! Create vector.
+    /*!
+     * @param  size  Number of elements (must be equal to N)
+     * @return       Zero-initialized vector of length N
+     */
+    static constexpr std::array<Real, Size> create(const std::size_t size)
+    {
+        assert(size == Size);
+        static_cast<void>(size);
+        return std::array<Real, Size>();
+    }
+
+    //! Create 3-vector with specified elements.
+    /*!
+     * @param  x  First element
+     * @param  y  Second element
+     * @param  z  Third element
+     * @return    3-vector
+     */
+    static constexpr std::array<Real, Size> create(const Real x, const Real y, const Real z)
+    {
+        static_assert(Size == 3, "3-vector must have 3 elements");
+        return std::array<Real, Size>{{x, y, z}};
+    }
+
+    //! Create vector, ignoring allocator.
+    /*!
+     * @tparam Allocator  Allocator type (unused, since elements are stored in the vector)
+     * @param  size       Number of elements (must be equal to N)
+     * @param  allocator  Allocator (unused)
+     * @return            Zero-initialized vector of length N
+     */
+    template <typename Allocator>
+    static constexpr std::array<Real, Size> create(const std::size_t size,
+                                                   const Allocator& allocator)
+    {
+        static_cast<void>(allocator);
+        return create(size);
+    }
+
+    //! Create 3-vector with specified elements, ignoring allocator.
+    /*!
+     * @tparam Allocator  Allocator type (unused, since elements are stored in the vector)
+     * @param  x          First element
+     * @param  y          Second element
+     * @param  z          Third element
+     * @param  allocator  Allocator (unused)
+     * @return            3-vector
+     */
+    template <typename Allocator>
+    static constexpr std::array<Real, Size> create(const Real x,
+                                                   const Real y,
+                                                   const Real z,
+                                                   const Allocator& allocator)
+    {
+        static_cast<void>(allocator);
+        return create(x, y, z);
+    }
+};
+
+//! Vector traits for FixedVector.
+/*!
+ * @sa VectorTraits
+ * @tparam Real  Real type
+ * @tparam Size  Number of elements N
+ */
+template <typename Real, std::size_t Size>
+struct VectorTraits<FixedVector<Real, Size> >
+{
+    //! Flag indicating if size of vector is fixed at compile time.
+    static const bool isFixedSize = true;
+
+    //! Create vector.
+    /*!
+     * @param  size  Number of elements (must be equal to N)
+     * @return       Zero-initialized vector of length N
+     */
+    static constexpr FixedVector<Real, Size> create(const std::size_t size)
+    {
+        assert(size == Size);
+        static_cast<void>(size);
+        return FixedVector<Real, Size>();
+    }
+
+    //! Create 3-vector with specified elements.
+    /*!
+     * @param  x  First element
+     * @param  y  Second element
+     * @param  z  Third element
+     * @return    3-vector
+     */
+    static constexpr FixedVector<Real, Size> create(const Real x, const Real y, const Real z)
+    {
+        static_assert(Size == 3, "3-vector must have 3 elements");
+        return FixedVector<Real, Size>{{x, y, z}};
+    }
+
+    //! Create vector, ignoring allocator.
+    /*!
+     * @tparam Allocator  Allocator type (unused, since elements are stored in the vector)
+     * @param  size       Number of elements (must be equal to N)
+     * @param  allocator  Allocator (unused)
+     * @return            Zero-initialized vector of length N
+     */
+    template <typename Allocator>
+    static constexpr FixedVector<Real, Size> create(const std::size_t size,
+                                                    const Allocator& allocator)
+    {
+        static_cast<void>(allocator);
+        return create(size);
+    }
+
+    //! Create 3-vector with specified elements, ignoring allocator.
+    /*!
+     * @tparam Allocator  Allocator type (unused, since elements are stored in the vector)
+     * @param  x          First element
+     * @param  y          Second element
+     * @param  z          Third element
+     * @param  allocator  Allocator (unused)
+     * @return            3-vector
+     */
+    template <typename Allocator>
+    static constexpr FixedVector<Real, Size> create(const Real x,
+                                                    const Real y,
+                                                    const Real z,
+                                                    const Allocator& allocator)
+    {
+        static_cast<void>(allocator);
+        return create(x, y, z);
+    }
+};
+
+} // namespace sml
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include "sml/lagrangeInterpolator.hpp"
+
+namespace sml
+{
+
+// Explicit instantiations of Lagrange interpolation for common types.
+SML_INSTANTIATE_LAGRANGE_INTERPOLATOR_FOR_COMMON_TYPES()
+
+} // namespace sml
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include "sml/vector3Batch.hpp"
+
+namespace sml
+{
+
+// Explicit instantiations of batch functions of 3-vectors for common types.
+SML_INSTANTIATE_VECTOR3_BATCH_FOR_COMMON_TYPES()
+
+} // namespace sml
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/arena.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+TEST_CASE("Test monotonic arena", "[arena]")
+{
+    SECTION("Test aligned allocation")
+    {
+        MonotonicArena arena(256);
+        void* first = arena.allocate(3, 1);
+        void* second = arena.allocate(8, 8);
+        void* third = arena.allocate(16, 64);
+
+        REQUIRE(static_cast<unsigned char*>(second) >= static_cast<unsigned char*>(first) + 3);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 8 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(third) % 64 == 0);
+        REQUIRE(arena.getSize() == 27);
+        REQUIRE(arena.getCapacity() == 256);
+    }
+
+    SECTION("Test growth and reset")
+    {
+        MonotonicArena arena(64);
+        arena.allocate(48);
+        arena.allocate(100);
+        REQUIRE(arena.getCapacity() > 64);
+        const std::size_t capacity = arena.getCapacity();
+
+        // After reset, the arena consists of a single buffer with the combined capacity.
+        arena.reset();
+        REQUIRE(arena.getSize() == 0);
+        REQUIRE(arena.getCapacity() == capacity);
+        void* first = arena.allocate(48, 1);
+        void* second = arena.allocate(100, 1);
+        REQUIRE(static_cast<unsigned char*>(second) == static_cast<unsigned char*>(first) + 48);
+        REQUIRE(arena.getCapacity() == capacity);
+    }
+
+    SECTION("Test standard container with arena allocator")
+    {
+        MonotonicArena arena(1024);
+        const ArenaAllocator<double> allocator(arena);
+        std::vector<double, ArenaAllocator<double> > vector(allocator);
+        for (int i = 0; i < 100; i++)
+        {
+            vector.push_back(0.5 * i);
+        }
+        REQUIRE(vector.size() == 100);
+        REQUIRE(vector[99] == 49.5);
+        REQUIRE(vector.get_allocator().getArena() == &arena);
+
+        MonotonicArena otherArena(64);
+        const ArenaAllocator<float> converted(allocator);
+        REQUIRE(converted == allocator);
+        REQUIRE(ArenaAllocator<double>(otherArena) != allocator);
+    }
+}
+
+} // namespace tests
+} // namespace sml
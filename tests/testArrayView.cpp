@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/arrayView.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Test array view", "[array-view]")
+{
+    SECTION("Test empty view")
+    {
+        const ArrayView<const Real> view;
+        REQUIRE(view.size() == 0);
+        REQUIRE(view.empty());
+        REQUIRE(view.begin() == view.end());
+    }
+
+    SECTION("Test view of std::vector")
+    {
+        const Vector vector = {1.0, -2.0, 3.5};
+        const ArrayView<const Real> view(vector);
+        REQUIRE(view.size() == 3);
+        REQUIRE(view.data() == vector.data());
+        REQUIRE(view[0] == 1.0);
+        REQUIRE(view[1] == -2.0);
+        REQUIRE(view[2] == 3.5);
+    }
+
+    SECTION("Test writing through mutable view of std::array")
+    {
+        std::array<Real, 3> array = {{0.0, 0.0, 0.0}};
+        const ArrayView<Real> view(array);
+        view[1] = 4.2;
+        REQUIRE(array[1] == 4.2);
+    }
+
+    SECTION("Test sub-view and iteration")
+    {
+        const Vector vector = {1.0, 2.0, 3.0, 4.0, 5.0};
+        const ArrayView<const Real> view = ArrayView<const Real>(vector).subview(1, 3);
+        REQUIRE(view.size() == 3);
+        Real sum = 0.0;
+        for (const Real element : view)
+        {
+            sum += element;
+        }
+        REQUIRE(sum == 9.0);
+    }
+}
+
+} // namespace tests
+} // namespace sml
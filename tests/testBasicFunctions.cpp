@@ -7,9 +7,15 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <limits>
+#include <vector>
 
+#include "sml/arrayView.hpp"
 #include "sml/basicFunctions.hpp"
+#include "sml/basicFunctionsBatch.hpp"
 
 namespace sml
 {
@@ -39,6 +45,40 @@ TEST_CASE("Test modulo function", "[modulo]")
     }
 }
 
+TEST_CASE("Test compile-time evaluation of basic functions", "[constexpr]")
+{
+    SECTION("Test modulo")
+    {
+        static_assert(computeModulo(3.0, 2.5) == 0.5, "modulo");
+        static_assert(computeModulo(-1.0, 3.0) == 2.0, "negative modulo");
+        static_assert(detail::computeFloor(-0.5) == -1.0, "floor");
+        REQUIRE(computeModulo(-7.25, 2.0) == 0.75);
+    }
+
+    SECTION("Test angle conversion")
+    {
+        constexpr Real degrees = convertRadiansToDegrees(3.14159265358979323846);
+        static_assert(degrees == 180.0, "radians to degrees");
+        static_assert(convertDegreesToRadians(90.0) == 3.14159265358979323846 / 2.0,
+                      "degrees to radians");
+        static_assert(convertDegreesToRadians(180.0f) == pi<float>, "float conversion");
+        REQUIRE(degrees == 180.0);
+    }
+
+    SECTION("Test floor")
+    {
+        const Real values[] = {0.0, -0.0, 0.5, -0.5, 1.0, -1.0, 2.5, -2.5, -1.0e-300,
+                               4503599627370495.5, -4503599627370495.5, 1.0e300, -1.0e300,
+                               std::numeric_limits<Real>::infinity()};
+        for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+        {
+            REQUIRE(detail::computeFloor(values[i]) == std::floor(values[i]));
+            REQUIRE(std::signbit(detail::computeFloor(values[i])) == std::signbit(values[i]));
+        }
+        REQUIRE(detail::computeFloor(2.7f) == 2.0f);
+    }
+}
+
 TEST_CASE("Test radian-to-degree conversion function", "[radians-to-degrees]")
 {
     SECTION("Test PI/2 radians to degrees")
@@ -89,5 +129,109 @@ TEST_CASE("Test degree-to-radians conversion function", "[degrees-to-radians]")
     }
 }
 
+TEST_CASE("Test batch angle functions", "[batch-angles]")
+{
+    typedef std::vector<Real> Vector;
+
+    const Real pi = 3.14159265358979323846;
+    const Real twoPi = 2.0 * pi;
+
+    // Size that is not a multiple of SIMD width, including multiples of a revolution.
+    Vector angles;
+    for (std::size_t i = 0; i < 37; i++)
+    {
+        angles.push_back(-20.0 + 1.17 * static_cast<Real>(i));
+    }
+    angles.push_back(0.0);
+    angles.push_back(twoPi);
+    angles.push_back(-twoPi);
+    angles.push_back(-1.0e-20);
+
+    Vector results(angles.size());
+
+    SECTION("Test branch-free floor")
+    {
+        const Real values[] = {0.0, -0.0, 0.5, -0.5, 1.0, -1.0, 2.5, -2.5, -1.0e-300, 0.9999999999999999,
+                               4503599627370495.5, -4503599627370495.5, 4503599627370497.0,
+                               1.0e300, -1.0e300, std::numeric_limits<Real>::infinity()};
+        for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+        {
+            REQUIRE(detail::computeBranchFreeFloor(values[i]) == std::floor(values[i]));
+            REQUIRE(std::signbit(detail::computeBranchFreeFloor(values[i])) == std::signbit(values[i]));
+        }
+        REQUIRE(std::isnan(detail::computeBranchFreeFloor(std::numeric_limits<Real>::quiet_NaN())));
+    }
+
+    SECTION("Test batch modulo")
+    {
+        computeModulo(angles, twoPi, results);
+        for (std::size_t i = 0; i < angles.size(); i++)
+        {
+            REQUIRE(results[i] == Catch::Approx(computeModulo(angles[i], twoPi)).margin(1.0e-14));
+        }
+    }
+
+    SECTION("Test fast batch modulo")
+    {
+        computeModuloFast(angles, twoPi, results);
+        for (std::size_t i = 0; i < angles.size(); i++)
+        {
+            REQUIRE(results[i] >= 0.0);
+            REQUIRE(results[i] < twoPi);
+            const Real remainder = computeModulo(angles[i], twoPi);
+            const Real difference = std::min(std::fabs(results[i] - remainder),
+                                             twoPi - std::fabs(results[i] - remainder));
+            REQUIRE(difference < 1.0e-13);
+        }
+    }
+
+    SECTION("Test batch conversion")
+    {
+        convertRadiansToDegrees<Real>(angles, results);
+        for (std::size_t i = 0; i < angles.size(); i++)
+        {
+            REQUIRE(results[i] == Catch::Approx(convertRadiansToDegrees(angles[i])));
+        }
+
+        convertDegreesToRadians<Real>(angles, results);
+        for (std::size_t i = 0; i < angles.size(); i++)
+        {
+            REQUIRE(results[i] == Catch::Approx(convertDegreesToRadians(angles[i])));
+        }
+    }
+
+    SECTION("Test fused wrap and conversion")
+    {
+        convertRadiansToWrappedDegrees<Real>(angles, results);
+        for (std::size_t i = 0; i < angles.size(); i++)
+        {
+            REQUIRE(results[i] >= 0.0);
+            REQUIRE(results[i] < 360.0);
+            const Real degrees = convertRadiansToDegrees(computeModulo(angles[i], twoPi));
+            REQUIRE(std::min(std::fabs(results[i] - degrees),
+                             360.0 - std::fabs(results[i] - degrees)) < 1.0e-11);
+        }
+
+        convertDegreesToWrappedRadians<Real>(angles, results);
+        for (std::size_t i = 0; i < angles.size(); i++)
+        {
+            REQUIRE(results[i] >= 0.0);
+            REQUIRE(results[i] < twoPi);
+            const Real radians = convertDegreesToRadians(computeModulo(angles[i], 360.0));
+            REQUIRE(std::min(std::fabs(results[i] - radians),
+                             twoPi - std::fabs(results[i] - radians)) < 1.0e-14);
+        }
+    }
+
+    SECTION("Test in-place batch on view")
+    {
+        Vector buffer = angles;
+        ArrayView<Real> view(buffer);
+        convertRadiansToWrappedDegrees<Real>(view, view);
+        REQUIRE(buffer[angles.size() - 3] == 0.0);
+        REQUIRE(buffer[0] == Catch::Approx(convertRadiansToDegrees(computeModulo(-20.0, twoPi))));
+    }
+}
+
 } // namespace tests
 } // namespace sml
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "sml/chebyshevSeries.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Test Chebyshev series functions", "[chebyshev-series]")
+{
+    SECTION("Test Clenshaw recurrence against Chebyshev polynomials")
+    {
+        // T_3(t) = 4t^3 - 3t, T_3'(t) = 12t^2 - 3
+        const Vector coefficients = {0.5, 0.0, 0.0, 2.0};
+        const Real t = 0.3;
+        Real derivative = 0.0;
+        const Real value = evaluateChebyshevSeries(coefficients, t, derivative);
+        REQUIRE(value == Catch::Approx(0.5 + 2.0 * (4.0 * t * t * t - 3.0 * t)).epsilon(1.0e-15));
+        REQUIRE(derivative == Catch::Approx(2.0 * (12.0 * t * t - 3.0)).epsilon(1.0e-15));
+        // The overloads may contract to fused multiply-add differently, e.g., with -march=native.
+        REQUIRE(evaluateChebyshevSeries(coefficients, t) == Catch::Approx(value).epsilon(1.0e-15));
+
+        const Vector constant = {1.5};
+        REQUIRE(evaluateChebyshevSeries(constant, t, derivative) == 1.5);
+        REQUIRE(derivative == 0.0);
+    }
+
+    SECTION("Test that fit reproduces polynomial")
+    {
+        // p(t) = 1 - 2t + 3t^3 = 1 + 0.25 T_1(t) + 0.75 T_3(t), sampled at more points than needed.
+        Vector tData;
+        Vector yData;
+        for (int i = 0; i <= 10; i++)
+        {
+            const Real t = -1.0 + 0.2 * i;
+            tData.push_back(t);
+            yData.push_back(1.0 - 2.0 * t + 3.0 * t * t * t);
+        }
+        const Vector coefficients = fitChebyshevSeries<Real>(tData, yData, 4);
+
+        REQUIRE(coefficients.size() == 5);
+        REQUIRE(coefficients[0] == Catch::Approx(1.0).epsilon(1.0e-14));
+        REQUIRE(coefficients[1] == Catch::Approx(0.25).epsilon(1.0e-14));
+        REQUIRE(std::fabs(coefficients[2]) <= 1.0e-14);
+        REQUIRE(coefficients[3] == Catch::Approx(0.75).epsilon(1.0e-14));
+        REQUIRE(std::fabs(coefficients[4]) <= 1.0e-14);
+    }
+
+    SECTION("Test that fit rejects too few or duplicate samples")
+    {
+        const Vector tData = {-1.0, 0.0, 1.0};
+        const Vector yData = {1.0, 2.0, 3.0};
+        REQUIRE_THROWS_AS(fitChebyshevSeries<Real>(tData, yData, 3), std::invalid_argument);
+
+        const Vector duplicateTData = {-1.0, 0.5, 0.5, 0.5};
+        const Vector duplicateYData = {1.0, 2.0, 2.0, 2.0};
+        REQUIRE_THROWS_AS(fitChebyshevSeries<Real>(duplicateTData, duplicateYData, 2),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("Test piecewise Chebyshev series class", "[chebyshev-series]")
+{
+    // Sample of sin(x) with 20 samples per segment, over 8 segments.
+    Vector xData;
+    Vector yData;
+    for (int i = 0; i <= 160; i++)
+    {
+        const Real x = 0.0625 * i;
+        xData.push_back(x);
+        yData.push_back(std::sin(x));
+    }
+    const ChebyshevSeries<Real> series(xData, yData, 8, 12);
+
+    SECTION("Test layout of coefficients")
+    {
+        REQUIRE(series.getStart() == 0.0);
+        REQUIRE(series.getSegmentLength() == 1.25);
+        REQUIRE(series.getSegmentCount() == 8);
+        REQUIRE(series.getOrder() == 12);
+        REQUIRE(series.getCoefficients().size() == 8 * 13);
+    }
+
+    SECTION("Test values and derivatives")
+    {
+        for (int i = 0; i <= 1000; i++)
+        {
+            const Real x = 0.01 * i;
+            Real derivative = 0.0;
+            const Real value = series.evaluate(x, derivative);
+            REQUIRE(std::fabs(value - std::sin(x)) <= 1.0e-13);
+            REQUIRE(std::fabs(derivative - std::cos(x)) <= 1.0e-11);
+            REQUIRE(series(x) == value);
+        }
+    }
+
+    SECTION("Test batch evaluation against scalar evaluation")
+    {
+        // Unsorted queries, including extrapolation and an odd size.
+        Vector queries;
+        for (int i = 0; i < 77; i++)
+        {
+            queries.push_back(-0.5 + std::fmod(3.7 * i, 11.0));
+        }
+        Vector values;
+        Vector derivatives;
+        series.evaluate(queries, values, derivatives);
+
+        Vector inPlace = queries;
+        series.evaluate(inPlace, inPlace);
+
+        REQUIRE(values.size() == queries.size());
+        for (std::size_t i = 0; i < queries.size(); i++)
+        {
+            Real derivative = 0.0;
+            const Real value = series.evaluate(queries[i], derivative);
+            REQUIRE(values[i] == Catch::Approx(value).epsilon(1.0e-14).margin(1.0e-15));
+            REQUIRE(derivatives[i] == Catch::Approx(derivative).epsilon(1.0e-14).margin(1.0e-15));
+            REQUIRE(inPlace[i] == values[i]);
+        }
+    }
+
+    SECTION("Test construction from precomputed coefficients")
+    {
+        const ChebyshevSeries<Real> copy(series.getStart(),
+                                         series.getSegmentLength(),
+                                         series.getOrder(),
+                                         series.getCoefficients());
+        REQUIRE(copy.getSegmentCount() == 8);
+        REQUIRE(copy(3.3) == series(3.3));
+    }
+
+    SECTION("Test that segments with too few samples are rejected")
+    {
+        REQUIRE_THROWS_AS(ChebyshevSeries<Real>(xData, yData, 20, 12), std::invalid_argument);
+        const Vector descending = {1.0, 0.0};
+        REQUIRE_THROWS_AS(ChebyshevSeries<Real>(descending, descending, 1, 1),
+                          std::invalid_argument);
+    }
+}
+
+} // namespace tests
+} // namespace sml
@@ -19,6 +19,19 @@ TEST_CASE("Test definition of constants", "[constants]")
     {
         REQUIRE(SML_PI == 3.14159265358979323846);
     }
+
+    SECTION("Test that typed constants are rounded to Real type")
+    {
+        static_assert(pi<double> == 3.14159265358979323846, "pi<double>");
+        static_assert(pi<float> == 3.14159265358979323846f, "pi<float>");
+        static_assert(twoPi<double> == 2.0 * pi<double>, "twoPi<double>");
+        static_assert(twoPi<float> == 2.0f * pi<float>, "twoPi<float>");
+        static_assert(halfPi<double> == pi<double> / 2.0, "halfPi<double>");
+        REQUIRE(degreesPerRadian<double> == 57.295779513082320877);
+        REQUIRE(degreesPerRadian<float> == 57.295779513082320877f);
+        REQUIRE(radiansPerDegree<double> == 0.017453292519943295769);
+        REQUIRE(radiansPerDegree<float> == 0.017453292519943295769f);
+    }
 }
 
 } // namespace tests
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "sml/cubicSpline.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Test cubic spline class", "[cubic-spline]")
+{
+    // Sample cubic polynomial on non-evenly distributed nodes.
+    Vector xData(40);
+    Vector yData(40);
+    for (std::size_t i = 0; i < xData.size(); i++)
+    {
+        xData[i] = 0.25 * static_cast<Real>(i) + 0.05 * std::sin(static_cast<Real>(i));
+        yData[i] = 2.0 * xData[i] * xData[i] * xData[i] - xData[i] + 5.0;
+    }
+    const Real startSlope = 6.0 * xData.front() * xData.front() - 1.0;
+    const Real endSlope = 6.0 * xData.back() * xData.back() - 1.0;
+
+    SECTION("Test that clamped and not-a-knot splines reproduce cubic polynomial")
+    {
+        const CubicSpline<Real> clamped(
+            xData, yData, SplineBoundary::clamped, startSlope, endSlope);
+        const CubicSpline<Real> notAKnot(xData, yData, SplineBoundary::notAKnot);
+        for (Real x = 0.0; x < 9.7; x += 0.13)
+        {
+            const Real expected = 2.0 * x * x * x - x + 5.0;
+            REQUIRE(clamped(x) == Catch::Approx(expected).epsilon(1.0e-12));
+            REQUIRE(notAKnot(x) == Catch::Approx(expected).epsilon(1.0e-12));
+        }
+    }
+
+    SECTION("Test that natural spline has zero second derivative at ends")
+    {
+        const CubicSpline<Real> spline(xData, yData);
+        const Vector& coefficients = spline.getCoefficients();
+        const std::size_t last = 4 * (xData.size() - 2);
+        const Real step = xData[xData.size() - 1] - xData[xData.size() - 2];
+        REQUIRE(coefficients.size() == 4 * (xData.size() - 1));
+        REQUIRE(coefficients[2] == 0.0);
+        REQUIRE(std::fabs(2.0 * coefficients[last + 2] + 6.0 * coefficients[last + 3] * step)
+                <= 1.0e-12);
+    }
+
+    SECTION("Test interpolation at nodes yields exact y-values")
+    {
+        const CubicSpline<Real> spline(xData, yData, SplineBoundary::notAKnot);
+        for (std::size_t i = 0; i + 1 < xData.size(); i++)
+        {
+            REQUIRE(spline(xData[i]) == yData[i]);
+        }
+        REQUIRE(spline(xData.back()) == Catch::Approx(yData.back()).epsilon(1.0e-14));
+    }
+
+    SECTION("Test accuracy of natural spline for smooth function")
+    {
+        Vector sineXData(101);
+        Vector sineYData(101);
+        for (std::size_t i = 0; i < sineXData.size(); i++)
+        {
+            sineXData[i] = 0.1 * static_cast<Real>(i);
+            sineYData[i] = std::sin(sineXData[i]);
+        }
+        const CubicSpline<Real> spline(sineXData, sineYData);
+        for (Real x = 1.0; x < 9.0; x += 0.0123)
+        {
+            REQUIRE(std::fabs(spline(x) - std::sin(x)) <= 1.0e-5);
+        }
+    }
+
+    SECTION("Test small tables")
+    {
+        // Not-a-knot spline through 3 points is the interpolating parabola.
+        const Vector parabolaX = {0.0, 1.0, 3.0};
+        const Vector parabolaY = {1.0, 2.0, 10.0};
+        const CubicSpline<Real> parabola(parabolaX, parabolaY, SplineBoundary::notAKnot);
+        REQUIRE(parabola(2.0) == Catch::Approx(2.0 * 2.0 - 1.0 * 2.0 + 1.0 + 2.0));
+
+        const Vector lineX = {1.0, 2.0};
+        const Vector lineY = {3.0, 5.0};
+        const CubicSpline<Real> line(lineX, lineY);
+        REQUIRE(line(1.5) == Catch::Approx(4.0));
+        REQUIRE(line(3.0) == Catch::Approx(7.0));
+    }
+
+    SECTION("Test that cursor and batch yield same results as binary search")
+    {
+        const CubicSpline<Real> spline(xData, yData, SplineBoundary::notAKnot);
+        Vector sortedQueries;
+        Vector unsortedQueries;
+        std::size_t cursor = 0;
+        for (int i = 0; i < 101; i++)
+        {
+            const Real x = -0.5 + 0.1 * i;
+            REQUIRE(spline.interpolate(x, cursor) == spline.interpolate(x));
+            REQUIRE(cursor == findInterval(xData, x));
+            sortedQueries.push_back(x);
+            unsortedQueries.push_back(std::fmod(3.7 * i, 10.0) - 0.5);
+        }
+
+        Vector results;
+        spline.interpolate(sortedQueries, results);
+        REQUIRE(results.size() == sortedQueries.size());
+        Vector inPlace = unsortedQueries;
+        spline.interpolate(inPlace, inPlace);
+        for (std::size_t i = 0; i < sortedQueries.size(); i++)
+        {
+            REQUIRE(results[i] == spline(sortedQueries[i]));
+            REQUIRE(inPlace[i] == spline(unsortedQueries[i]));
+        }
+    }
+
+    SECTION("Test that invalid data is rejected")
+    {
+        const Vector single = {1.0};
+        const Vector descending = {2.0, 1.0};
+        REQUIRE_THROWS_AS(CubicSpline<Real>(single, single), std::invalid_argument);
+        REQUIRE_THROWS_AS(CubicSpline<Real>(descending, descending), std::invalid_argument);
+        REQUIRE_THROWS_AS(CubicSpline<Real>(xData, single), std::invalid_argument);
+    }
+}
+
+} // namespace tests
+} // namespace sml
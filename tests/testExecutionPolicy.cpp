@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/cubicSpline.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/keplerEquation.hpp"
+#include "sml/lagrangeInterpolator.hpp"
+#include "sml/threadPool.hpp"
+#include "sml/trigonometry.hpp"
+#include "sml/vector3Batch.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+//! Executor that forwards tasks to a thread pool and counts calls, like an application adapter.
+class CountingExecutor : public Executor
+{
+public:
+
+    explicit CountingExecutor(ThreadPool& someThreadPool)
+        : threadPool(someThreadPool),
+          callCount(0),
+          taskCount(0)
+    { }
+
+    std::size_t getConcurrency() const override { return threadPool.getConcurrency(); }
+
+    void parallelFor(const std::size_t someTaskCount,
+                     const std::function<void(std::size_t)>& task) override
+    {
+        callCount++;
+        taskCount += someTaskCount;
+        threadPool.parallelFor(someTaskCount, task);
+    }
+
+    ThreadPool& threadPool;
+    std::size_t callCount;
+    std::size_t taskCount;
+};
+
+//! Create arbitrary vector of N values in [start, start + span), not in sorted order.
+Vector createValues(const std::size_t size, const Real start, const Real span)
+{
+    Vector values(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        values[i] = start + span * std::fmod(0.618033988749895 * static_cast<Real>(i), 1.0);
+    }
+    return values;
+}
+
+//! Check if results of batch function are equal to expected results.
+/*!
+ * Results computed with ExecutionMode::parallelVectorized must be identical to the sequential
+ * results, since both are dispatched to the same instruction set. Results computed with
+ * ExecutionMode::parallel may differ by rounding, if the instruction set selected at runtime
+ * differs from the one selected at compile time.
+ */
+bool isEqual(const Real* results,
+             const Real* expected,
+             const std::size_t size,
+             const ExecutionPolicy& policy)
+{
+    const Real tolerance = policy.getMode() == ExecutionMode::parallelVectorized ? 0.0 : 1.0e-13;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (std::fabs(results[i] - expected[i]) > tolerance * (1.0 + std::fabs(expected[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Test thread pool", "[thread-pool]")
+{
+    ThreadPool threadPool(3);
+    REQUIRE(threadPool.getThreadCount() == 3);
+    REQUIRE(threadPool.getConcurrency() == 4);
+
+    SECTION("Test that all tasks run exactly once")
+    {
+        std::vector<std::atomic<int> > counts(1000);
+        for (std::atomic<int>& count : counts)
+        {
+            count = 0;
+        }
+        threadPool.parallelFor(counts.size(), [&counts](const std::size_t i) { counts[i]++; });
+        bool isEachRunOnce = true;
+        for (const std::atomic<int>& count : counts)
+        {
+            isEachRunOnce = isEachRunOnce && count.load() == 1;
+        }
+        REQUIRE(isEachRunOnce);
+        threadPool.parallelFor(0, [](const std::size_t) { throw std::runtime_error("no tasks"); });
+    }
+
+    SECTION("Test nested parallel for")
+    {
+        std::atomic<std::size_t> sum(0);
+        threadPool.parallelFor(8, [&threadPool, &sum](const std::size_t i)
+        {
+            threadPool.parallelFor(10, [&sum, i](const std::size_t j) { sum += 10 * i + j; });
+        });
+        REQUIRE(sum.load() == 79 * 80 / 2);
+    }
+
+    SECTION("Test propagation of exceptions")
+    {
+        std::atomic<int> runCount(0);
+        REQUIRE_THROWS_AS(threadPool.parallelFor(16, [&runCount](const std::size_t i)
+        {
+            runCount++;
+            if (i == 5)
+            {
+                throw std::runtime_error("task failed");
+            }
+        }), std::runtime_error);
+        REQUIRE(runCount.load() == 16);
+    }
+
+    SECTION("Test thread pool without worker threads")
+    {
+        ThreadPool serialThreadPool(0);
+        REQUIRE(serialThreadPool.getConcurrency() == 1);
+        std::vector<std::size_t> order;
+        serialThreadPool.parallelFor(4, [&order](const std::size_t i) { order.push_back(i); });
+        REQUIRE(order == std::vector<std::size_t>({0, 1, 2, 3}));
+    }
+}
+
+TEST_CASE("Test execution policy", "[execution-policy]")
+{
+    ThreadPool threadPool(3);
+
+    SECTION("Test construction")
+    {
+        const ExecutionPolicy defaultPolicy;
+        REQUIRE(defaultPolicy.getMode() == ExecutionMode::sequential);
+        REQUIRE(&defaultPolicy.getExecutor() == &getDefaultThreadPool());
+        REQUIRE(defaultPolicy.getChunkSize() == 0);
+
+        const ExecutionPolicy policy(ExecutionMode::parallel, &threadPool, 100);
+        REQUIRE(policy.getMode() == ExecutionMode::parallel);
+        REQUIRE(&policy.getExecutor() == &threadPool);
+        REQUIRE(policy.getChunkSize() == 100);
+    }
+
+    SECTION("Test computation of chunk size")
+    {
+        const std::size_t bytesPerElement = 3 * sizeof(Real);
+        const std::size_t smallChunkSize = detail::computeChunkSize(1000, bytesPerElement, 4);
+        REQUIRE(smallChunkSize % detail::chunkSizeMultiple == 0);
+        REQUIRE(smallChunkSize * bytesPerElement >= detail::minimumChunkByteCount);
+
+        const std::size_t largeChunkSize
+            = detail::computeChunkSize(100000000, bytesPerElement, 4);
+        REQUIRE(largeChunkSize % detail::chunkSizeMultiple == 0);
+        REQUIRE((largeChunkSize - detail::chunkSizeMultiple) * bytesPerElement
+                <= detail::getL2CacheSize() / 2);
+
+        REQUIRE(detail::computeChunkSize(1, 1000000, 1) == detail::chunkSizeMultiple);
+    }
+
+    SECTION("Test execution in chunks")
+    {
+        CountingExecutor executor(threadPool);
+        std::vector<std::atomic<int> > counts(1001);
+        for (std::atomic<int>& count : counts)
+        {
+            count = 0;
+        }
+        const auto function = [&counts](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                counts[i]++;
+            }
+        };
+        detail::executeInChunks(
+            function, counts.size(), 8, ExecutionPolicy(ExecutionMode::parallel, &executor, 64));
+        REQUIRE(executor.callCount == 1);
+        REQUIRE(executor.taskCount == 16);
+
+        detail::executeInChunks(function, counts.size(), 8, ExecutionPolicy(
+            ExecutionMode::sequential, &executor, 64));
+        detail::executeInChunks(function, 10, 8, ExecutionPolicy(
+            ExecutionMode::parallel, &executor, 64));
+        REQUIRE(executor.callCount == 1);
+
+        bool isCountCorrect = true;
+        for (std::size_t i = 0; i < counts.size(); i++)
+        {
+            isCountCorrect = isCountCorrect && counts[i].load() == (i < 10 ? 3 : 2);
+        }
+        REQUIRE(isCountCorrect);
+    }
+}
+
+TEST_CASE("Test parallel batch functions", "[execution-policy]")
+{
+    ThreadPool threadPool(3);
+    const std::size_t size = 1003;
+    const ExecutionPolicy policies[] = {
+        ExecutionPolicy(ExecutionMode::parallel, &threadPool, 64),
+        ExecutionPolicy(ExecutionMode::parallelVectorized, &threadPool, 64)};
+
+    SECTION("Test normalization of batch of 3-vectors")
+    {
+        Vector3Batch<Real> batch(size);
+        const Vector values = createValues(3 * size, -5.0, 10.0);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            batch.set(i, Vector({values[3 * i], values[3 * i + 1], values[3 * i + 2]}));
+        }
+        Vector3Batch<Real> expected(size);
+        normalize(batch, expected);
+        for (const ExecutionPolicy& policy : policies)
+        {
+            Vector3Batch<Real> result(size);
+            normalize(batch, result, policy);
+            REQUIRE(isEqual(result.getX(), expected.getX(), size, policy));
+            REQUIRE(isEqual(result.getY(), expected.getY(), size, policy));
+            REQUIRE(isEqual(result.getZ(), expected.getZ(), size, policy));
+        }
+    }
+
+    SECTION("Test sine of batch of angles")
+    {
+        const Vector angles = createValues(size, -100.0, 200.0);
+        Vector expected(size);
+        computeSine<Real>(angles, expected);
+        for (const ExecutionPolicy& policy : policies)
+        {
+            Vector sines(size);
+            computeSine<Real>(angles, sines, TrigonometricAccuracy::precise, policy);
+            REQUIRE(isEqual(sines.data(), expected.data(), size, policy));
+        }
+    }
+
+    SECTION("Test solution of Kepler's equation for batch of orbits")
+    {
+        const Vector meanAnomalies = createValues(size, -10.0, 20.0);
+        const Vector ellipticEccentricities = createValues(size, 0.0, 0.999);
+        const Vector mixedEccentricities = createValues(size, 0.0, 3.0);
+
+        Vector expectedEccentric(size);
+        Vector expectedTrue(size);
+        Vector expectedMixedTrue(size);
+        computeEccentricAnomaly<Real>(meanAnomalies, ellipticEccentricities, expectedEccentric);
+        computeTrueAnomaly<Real>(meanAnomalies, ellipticEccentricities, expectedTrue);
+        computeTrueAnomaly<Real>(meanAnomalies, mixedEccentricities, expectedMixedTrue);
+        for (const ExecutionPolicy& policy : policies)
+        {
+            Vector eccentricAnomalies(size);
+            Vector trueAnomalies(size);
+            Vector mixedTrueAnomalies(size);
+            computeEccentricAnomaly<Real>(
+                meanAnomalies, ellipticEccentricities, eccentricAnomalies, policy);
+            computeTrueAnomaly<Real>(meanAnomalies, ellipticEccentricities, trueAnomalies, policy);
+            computeTrueAnomaly<Real>(
+                meanAnomalies, mixedEccentricities, mixedTrueAnomalies, policy);
+            REQUIRE(isEqual(eccentricAnomalies.data(), expectedEccentric.data(), size, policy));
+            REQUIRE(isEqual(trueAnomalies.data(), expectedTrue.data(), size, policy));
+            REQUIRE(isEqual(mixedTrueAnomalies.data(), expectedMixedTrue.data(), size, policy));
+        }
+    }
+
+    SECTION("Test interpolation of batch of queries")
+    {
+        Vector xData(50);
+        Vector yData(50);
+        for (std::size_t i = 0; i < xData.size(); i++)
+        {
+            xData[i] = 0.2 * static_cast<Real>(i);
+            yData[i] = std::sin(xData[i]);
+        }
+        const Vector queries = createValues(size, 0.0, 9.8);
+        const LagrangeTableInterpolator<Real> tableInterpolator(xData, yData, 6);
+        const CubicSpline<Real> spline(xData, yData);
+
+        Vector expectedTable;
+        Vector expectedSpline;
+        tableInterpolator.interpolate(queries, expectedTable);
+        spline.interpolate(queries, expectedSpline);
+        for (const ExecutionPolicy& policy : policies)
+        {
+            Vector tableResults;
+            Vector splineResults;
+            tableInterpolator.interpolate(queries, tableResults, policy);
+            spline.interpolate(queries, splineResults, policy);
+            REQUIRE(isEqual(tableResults.data(), expectedTable.data(), size, policy));
+            REQUIRE(isEqual(splineResults.data(), expectedSpline.data(), size, policy));
+        }
+    }
+}
+
+} // namespace tests
+} // namespace sml
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/fixedVector.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef FixedVector<Real, 3> Vector3;
+
+TEST_CASE("Test fixed-size vector", "[fixed-vector]")
+{
+    SECTION("Test construction and element access")
+    {
+        Vector3 vector = {{1.0, -2.0, 3.5}};
+        REQUIRE(vector.size() == 3);
+        REQUIRE(vector[0] == 1.0);
+        REQUIRE(vector[1] == -2.0);
+        REQUIRE(vector[2] == 3.5);
+
+        vector[1] = 4.0;
+        REQUIRE(vector[1] == 4.0);
+        REQUIRE(vector.data() == &vector[0]);
+        REQUIRE(vector.end() - vector.begin() == 3);
+    }
+
+    SECTION("Test value-initialization yields zero-vector")
+    {
+        const Vector3 vector = Vector3();
+        REQUIRE(vector[0] == 0.0);
+        REQUIRE(vector[1] == 0.0);
+        REQUIRE(vector[2] == 0.0);
+    }
+
+    SECTION("Test use in constant expressions")
+    {
+        constexpr Vector3 vector = {{1.0, 2.0, 3.0}};
+        static_assert(vector.size() == 3, "Size of fixed-size vector must be known at compile time");
+        static_assert(vector[2] == 3.0, "Elements of fixed-size vector must be known at compile time");
+        REQUIRE(vector[2] == 3.0);
+    }
+
+    SECTION("Test comparison operators")
+    {
+        const Vector3 vector1 = {{1.0, 2.0, 3.0}};
+        const Vector3 vector2 = {{1.0, 2.0, 3.0}};
+        const Vector3 vector3 = {{1.0, 2.0, 3.1}};
+        REQUIRE(vector1 == vector2);
+        REQUIRE(vector1 != vector3);
+    }
+}
+
+} // namespace tests
+} // namespace sml
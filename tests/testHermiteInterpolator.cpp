@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "sml/arrayView.hpp"
+#include "sml/hermiteInterpolator.hpp"
+#include "sml/lagrangeInterpolator.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Test hermite table interpolator class", "[hermite-interpolator]")
+{
+    // Sample quintic polynomial on non-evenly distributed nodes, which is reproduced exactly (up to
+    // rounding) by stencils of 3 or more entries with derivatives.
+    Vector xData(50);
+    Vector yData(50);
+    Vector dyData(50);
+    for (std::size_t i = 0; i < xData.size(); i++)
+    {
+        const Real x = 0.1 * static_cast<Real>(i) + 0.01 * std::sin(static_cast<Real>(i));
+        xData[i] = x;
+        yData[i] = x * x * x * x * x - 2.0 * x * x + 1.0;
+        dyData[i] = 5.0 * x * x * x * x - 4.0 * x;
+    }
+
+    SECTION("Test interpolation of quintic polynomial with binary search")
+    {
+        const HermiteTableInterpolator<Real> interpolator(xData, yData, dyData, 3);
+        for (Real x = 0.0; x < 4.9; x += 0.037)
+        {
+            REQUIRE(interpolator(x) == Catch::Approx(x * x * x * x * x - 2.0 * x * x + 1.0)
+                                           .epsilon(1.0e-12));
+        }
+    }
+
+    SECTION("Test interpolation near start and end of table")
+    {
+        const HermiteTableInterpolator<Real> interpolator(xData, yData, dyData, 4);
+        const Real xStart = xData.front() + 0.001;
+        const Real xEnd = xData.back() - 0.001;
+        REQUIRE(interpolator(xStart)
+                == Catch::Approx(xStart * xStart * xStart * xStart * xStart
+                                 - 2.0 * xStart * xStart + 1.0));
+        REQUIRE(interpolator(xEnd)
+                == Catch::Approx(xEnd * xEnd * xEnd * xEnd * xEnd - 2.0 * xEnd * xEnd + 1.0));
+    }
+
+    SECTION("Test interpolation at nodes yields exact y-values")
+    {
+        const HermiteTableInterpolator<Real> interpolator(xData, yData, dyData, 3);
+        for (std::size_t i = 0; i < xData.size(); i++)
+        {
+            REQUIRE(interpolator(xData[i]) == yData[i]);
+        }
+    }
+
+    SECTION("Test that derivatives halve number of nodes compared to Lagrange interpolation")
+    {
+        // Cubic Hermite interpolation (2 nodes) matches cubic Lagrange interpolation (4 nodes) for
+        // a cubic polynomial.
+        Vector cubicYData(xData.size());
+        Vector cubicDyData(xData.size());
+        for (std::size_t i = 0; i < xData.size(); i++)
+        {
+            const Real x = xData[i];
+            cubicYData[i] = 3.0 * x * x * x - x;
+            cubicDyData[i] = 9.0 * x * x - 1.0;
+        }
+        const HermiteTableInterpolator<Real> hermite(xData, cubicYData, cubicDyData, 2);
+        const LagrangeTableInterpolator<Real> lagrange(xData, cubicYData, 4);
+        for (Real x = 0.0; x < 4.9; x += 0.037)
+        {
+            REQUIRE(hermite(x) == Catch::Approx(lagrange(x)).epsilon(1.0e-12).margin(1.0e-12));
+        }
+    }
+
+    SECTION("Test that cursor and batch yield same results as binary search")
+    {
+        const HermiteTableInterpolator<Real> interpolator(xData, yData, dyData, 3);
+        Vector queries;
+        std::size_t cursor = 0;
+        for (Real x = 0.0; x < 4.9; x += 0.037)
+        {
+            REQUIRE(interpolator.interpolate(x, cursor) == interpolator.interpolate(x));
+            REQUIRE(cursor == findInterval(xData, x));
+            queries.push_back(x);
+        }
+        Vector results;
+        interpolator.interpolate(queries, results);
+        REQUIRE(results.size() == queries.size());
+        for (std::size_t i = 0; i < queries.size(); i++)
+        {
+            REQUIRE(results[i] == interpolator(queries[i]));
+        }
+    }
+
+    SECTION("Test interpolation on views of data")
+    {
+        typedef ArrayView<const Real> View;
+        const HermiteTableInterpolator<Real, View> interpolator(
+            View(xData.data(), xData.size()),
+            View(yData.data(), yData.size()),
+            View(dyData.data(), dyData.size()),
+            3);
+        const HermiteTableInterpolator<Real> copy(xData, yData, dyData, 3);
+        REQUIRE(interpolator.getStencilSize() == 3);
+        REQUIRE(interpolator.getDyData().size() == dyData.size());
+        REQUIRE(interpolator(2.345) == copy(2.345));
+    }
+}
+
+} // namespace tests
+} // namespace sml
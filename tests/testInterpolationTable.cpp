@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/interpolationTable.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::vector<Vector> Matrix;
+
+TEST_CASE("Test binary interpolation table", "[interpolation-table]")
+{
+    const std::string path = "sml_test_interpolation_table.bin";
+
+    Vector xData(101);
+    Matrix yColumns(3, Vector(xData.size()));
+    for (std::size_t i = 0; i < xData.size(); i++)
+    {
+        xData[i] = 0.1 * static_cast<Real>(i);
+        yColumns[0][i] = std::sin(xData[i]);
+        yColumns[1][i] = std::cos(xData[i]);
+        yColumns[2][i] = xData[i] * xData[i];
+    }
+
+    SECTION("Test round trip of table without weights")
+    {
+        writeInterpolationTable<Real>(path, xData, yColumns);
+        const MappedInterpolationTable<Real> table(path);
+
+        REQUIRE(table.getRowCount() == xData.size());
+        REQUIRE(table.getColumnCount() == yColumns.size());
+        REQUIRE_FALSE(table.hasWeights());
+        REQUIRE(table.getWeights().empty());
+
+        const MappedInterpolationTable<Real>::Column x = table.getXData();
+        for (std::size_t i = 0; i < xData.size(); i++)
+        {
+            REQUIRE(x[i] == xData[i]);
+            for (std::size_t k = 0; k < yColumns.size(); k++)
+            {
+                REQUIRE(table.getYColumn(k)[i] == yColumns[k][i]);
+            }
+        }
+    }
+
+    SECTION("Test round trip of table with weights")
+    {
+        const Vector nodes = {0.0, 0.5, 1.5, 2.0};
+        const Matrix values = {{1.0, 2.0, 0.5, -1.0}};
+        writeInterpolationTable<Real>(path, nodes, values, true);
+        const MappedInterpolationTable<Real> table(path);
+
+        REQUIRE(table.hasWeights());
+        const Vector weights = computeBarycentricWeights<Real>(nodes);
+        for (std::size_t i = 0; i < nodes.size(); i++)
+        {
+            REQUIRE(table.getWeights()[i] == weights[i]);
+        }
+
+        // Interpolate zero-copy on memory-mapped columns
+        REQUIRE(barycentricInterpolate(table.getXData(), table.getYColumn(0), table.getWeights(),
+                                       Real(1.0))
+                == barycentricInterpolate(nodes, values[0], weights, Real(1.0)));
+    }
+
+    SECTION("Test zero-copy table interpolation on memory-mapped columns")
+    {
+        writeInterpolationTable<Real>(path, xData, yColumns);
+        const MappedInterpolationTable<Real> table(path);
+
+        typedef ArrayView<const Real> Column;
+        const LagrangeTableInterpolator<Real, Column> mappedInterpolator(
+            table.getXData(), table.getYColumn(1), 6);
+        const LagrangeTableInterpolator<Real> interpolator(xData, yColumns[1], 6);
+        REQUIRE(mappedInterpolator.getXData().data() == table.getXData().data());
+
+        for (Real x = 0.0; x < 10.0; x += 0.23)
+        {
+            REQUIRE(mappedInterpolator(x) == interpolator(x));
+        }
+    }
+
+    SECTION("Test that invalid tables are rejected by writer")
+    {
+        Vector unsorted = xData;
+        unsorted[10] = unsorted[9];
+        REQUIRE_THROWS_AS(writeInterpolationTable<Real>(path, unsorted, yColumns),
+                          std::invalid_argument);
+
+        Matrix shortColumns = yColumns;
+        shortColumns[2].pop_back();
+        REQUIRE_THROWS_AS(writeInterpolationTable<Real>(path, xData, shortColumns),
+                          std::invalid_argument);
+
+        REQUIRE(xData.size() > INTERPOLATION_TABLE_MAX_WEIGHTED_ROWS);
+        REQUIRE_THROWS_AS(writeInterpolationTable<Real>(path, xData, yColumns, true),
+                          std::invalid_argument);
+    }
+
+    SECTION("Test that invalid files are rejected by reader")
+    {
+        REQUIRE_THROWS_AS(MappedInterpolationTable<Real>("non_existent_table.bin"),
+                          std::runtime_error);
+
+        writeInterpolationTable<Real>(path, xData, yColumns);
+        REQUIRE_THROWS_AS(MappedInterpolationTable<float>(path), std::runtime_error);
+
+        {
+            std::fstream file(path.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(0);
+            file.write("XXXXXXXX", 8);
+        }
+        REQUIRE_THROWS_AS(MappedInterpolationTable<Real>(path), std::runtime_error);
+
+        {
+            std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+            file.write("SMLTABLE", 8);
+        }
+        REQUIRE_THROWS_AS(MappedInterpolationTable<Real>(path), std::runtime_error);
+    }
+
+    std::remove(path.c_str());
+}
+
+} // namespace tests
+} // namespace sml
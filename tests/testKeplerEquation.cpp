@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/constants.hpp"
+#include "sml/keplerEquation.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+//! Solve Kepler's equation for m in [0, pi] (elliptic) or m >= 0 (hyperbolic) in long double.
+/*!
+ * Uses Newton iterations, evaluating x - sin(x) and sinh(x) - x with their Taylor series for
+ * x < 1 to avoid cancellation, until the correction is negligible.
+ */
+long double solveReferenceKeplerEquation(const long double m, const long double e)
+{
+    const bool isHyperbolic = e > 1.0L;
+    long double anomaly = isHyperbolic ? std::fmin(m / (e - 1.0L), std::cbrt(6.0L * m / e))
+                                       : std::fmin(std::cbrt(6.0L * m), 3.14159265358979323846L);
+    for (int iteration = 0; iteration < 500; iteration++)
+    {
+        long double remainder = 0.0L;
+        if (anomaly < 1.0L)
+        {
+            const long double square = isHyperbolic ? anomaly * anomaly : -anomaly * anomaly;
+            long double term = anomaly;
+            for (int k = 3; k < 60; k += 2)
+            {
+                term *= square / ((k - 1) * k);
+                remainder += term;
+            }
+            remainder = isHyperbolic ? remainder : -remainder;
+        }
+        else
+        {
+            remainder = isHyperbolic ? std::sinh(anomaly) - anomaly : anomaly - std::sin(anomaly);
+        }
+        const long double f0 = isHyperbolic ? (e - 1.0L) * anomaly + e * remainder - m
+                                            : (1.0L - e) * anomaly + e * remainder - m;
+        const long double f1 = isHyperbolic ? e * std::cosh(anomaly) - 1.0L
+                                            : 1.0L - e * std::cos(anomaly);
+        const long double correction = f0 / f1;
+        anomaly -= correction;
+        if (std::fabs(correction) <= 1.0e-21L * anomaly)
+        {
+            break;
+        }
+    }
+    return anomaly;
+}
+
+//! Check maximum error of batch Kepler solvers for given Real type.
+template <typename Real>
+void checkKeplerErrors()
+{
+    typedef std::vector<Real> Vector;
+    const long double epsilon = std::numeric_limits<Real>::epsilon();
+
+    // Mean anomalies of several revolutions and close to zero, for eccentricities up to nearly
+    // parabolic orbits.
+    Vector meanAnomalies;
+    Vector eccentricities;
+    for (int i = 0; i < 200; i++)
+    {
+        const Real m = i < 100 ? static_cast<Real>(std::pow(10.0L, -8.0L + 8.0L * i / 100))
+                               : static_cast<Real>(-10.0L + 20.0L * (i - 100) / 99);
+        for (int j = 0; j < 60; j++)
+        {
+            meanAnomalies.push_back(m);
+            eccentricities.push_back(
+                j < 40 ? static_cast<Real>(j / 40.0L)
+                       : static_cast<Real>(1.0L - std::pow(10.0L, -1.5L - 5.0L * (j - 40) / 20)));
+        }
+    }
+
+    Vector eccentricAnomalies(meanAnomalies.size());
+    computeEccentricAnomaly<Real>(meanAnomalies, eccentricities, eccentricAnomalies);
+    long double maximumError = 0.0L;
+    for (std::size_t i = 0; i < meanAnomalies.size(); i++)
+    {
+        // Wrap reference to [0, 2pi) in the same way, since revolutions of 2pi are rounded.
+        const Real m = meanAnomalies[i];
+        const Real wrappedAnomaly
+            = m - twoPi<Real> * std::floor(m * (Real(1) / twoPi<Real>) + Real(0.5));
+        long double reference = solveReferenceKeplerEquation(
+            std::fabs(static_cast<long double>(wrappedAnomaly)), eccentricities[i]);
+        reference = wrappedAnomaly < Real(0) ? twoPi<long double> - reference : reference;
+
+        REQUIRE(eccentricAnomalies[i] >= Real(0));
+        REQUIRE(eccentricAnomalies[i] < twoPi<Real>);
+        const long double scale = wrappedAnomaly < Real(0) ? twoPi<long double> : reference;
+        maximumError = std::fmax(maximumError,
+                                 std::fabs(eccentricAnomalies[i] - reference) / (epsilon * scale));
+    }
+    REQUIRE(maximumError <= 4.0L);
+
+    // Hyperbolic orbits, from close to parabolic to very eccentric.
+    Vector hyperbolicMeanAnomalies;
+    Vector hyperbolicEccentricities;
+    for (int i = 0; i < 100; i++)
+    {
+        for (int j = 0; j < 40; j++)
+        {
+            const long double sign = i % 2 == 0 ? 1.0L : -1.0L;
+            hyperbolicMeanAnomalies.push_back(
+                static_cast<Real>(sign * std::pow(10.0L, -8.0L + 12.0L * i / 99)));
+            hyperbolicEccentricities.push_back(
+                static_cast<Real>(1.0L + std::pow(10.0L, -6.0L + 8.0L * j / 39)));
+        }
+    }
+
+    Vector hyperbolicAnomalies(hyperbolicMeanAnomalies.size());
+    computeHyperbolicAnomaly<Real>(
+        hyperbolicMeanAnomalies, hyperbolicEccentricities, hyperbolicAnomalies);
+    maximumError = 0.0L;
+    for (std::size_t i = 0; i < hyperbolicMeanAnomalies.size(); i++)
+    {
+        const long double reference = std::copysign(
+            solveReferenceKeplerEquation(std::fabs(hyperbolicMeanAnomalies[i]),
+                                         hyperbolicEccentricities[i]),
+            hyperbolicMeanAnomalies[i]);
+        maximumError = std::fmax(
+            maximumError,
+            std::fabs(hyperbolicAnomalies[i] - reference) / (epsilon * std::fabs(reference)));
+    }
+    REQUIRE(maximumError <= 4.0L);
+}
+
+TEST_CASE("Test Kepler equation solvers", "[kepler-equation]")
+{
+    typedef double Real;
+    typedef std::vector<Real> Vector;
+
+    SECTION("Test maximum error for double and float")
+    {
+        checkKeplerErrors<double>();
+        checkKeplerErrors<float>();
+    }
+
+    SECTION("Test true anomaly of elliptic orbits")
+    {
+        const Vector meanAnomalies = {0.0, 0.1, 1.0, -1.0, 3.0, 10.0, -20.0};
+        const Vector eccentricities = {0.0, 0.5, 0.9, 0.2, 0.999, 0.05, 0.7};
+        Vector eccentricAnomalies(meanAnomalies.size());
+        Vector trueAnomalies(meanAnomalies.size());
+        computeEccentricAnomaly<Real>(meanAnomalies, eccentricities, eccentricAnomalies);
+        computeTrueAnomaly<Real>(meanAnomalies, eccentricities, trueAnomalies);
+
+        for (std::size_t i = 0; i < meanAnomalies.size(); i++)
+        {
+            const Real e = eccentricities[i];
+            const Real E = eccentricAnomalies[i];
+            Real expected = std::atan2(std::sqrt(1.0 - e * e) * std::sin(E), std::cos(E) - e);
+            expected = expected < 0.0 ? expected + twoPi<Real> : expected;
+            REQUIRE(trueAnomalies[i] >= 0.0);
+            REQUIRE(trueAnomalies[i] < twoPi<Real>);
+            REQUIRE(std::fabs(trueAnomalies[i] - expected) <= 1.0e-13);
+        }
+
+        // Circular orbits have equal mean, eccentric and true anomalies.
+        REQUIRE(std::fabs(eccentricAnomalies[0]) == 0.0);
+        REQUIRE(std::fabs(trueAnomalies[0]) == 0.0);
+    }
+
+    SECTION("Test true anomaly of mixed elliptic and hyperbolic orbits in-place")
+    {
+        const Vector meanAnomalies = {1.0, 2.0, -2.0, 50.0};
+        const Vector eccentricities = {0.3, 1.5, 1.5, 3.0};
+        Vector trueAnomalies = meanAnomalies;
+        computeTrueAnomaly<Real>(trueAnomalies, eccentricities, trueAnomalies);
+
+        Vector hyperbolicAnomalies(meanAnomalies.size() - 1);
+        computeHyperbolicAnomaly<Real>(
+            Vector(meanAnomalies.begin() + 1, meanAnomalies.end()),
+            Vector(eccentricities.begin() + 1, eccentricities.end()),
+            hyperbolicAnomalies);
+        for (std::size_t i = 1; i < meanAnomalies.size(); i++)
+        {
+            const Real e = eccentricities[i];
+            const Real H = hyperbolicAnomalies[i - 1];
+            REQUIRE(std::fabs(e * std::sinh(H) - H - meanAnomalies[i])
+                    <= 1.0e-14 * std::fabs(meanAnomalies[i]));
+            Real expected = std::atan2(std::sqrt(e * e - 1.0) * std::sinh(H), e - std::cosh(H));
+            expected = expected < 0.0 ? expected + twoPi<Real> : expected;
+            REQUIRE(std::fabs(trueAnomalies[i] - expected) <= 1.0e-13);
+        }
+        REQUIRE(std::fabs(trueAnomalies[1] + trueAnomalies[2] - twoPi<Real>) <= 1.0e-15);
+    }
+}
+
+} // namespace tests
+} // namespace sml
@@ -4,9 +4,13 @@
  * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
  */
 
+#include <cmath>
+#include <cstddef>
 #include <map>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 
 #include "sml/lagrangeInterpolator.hpp"
 
@@ -17,6 +21,8 @@ namespace tests
 
 typedef double Real;
 typedef std::map<Real,Real> FunctionDataMap;
+typedef std::vector<Real> Vector;
+typedef std::vector<Vector> Matrix;
 
 TEST_CASE("Test langrange interpolator function", "[lagrange-interpolator]")
 {
@@ -53,5 +59,306 @@ TEST_CASE("Test langrange interpolator function", "[lagrange-interpolator]")
     }
 }
 
+TEST_CASE("Test barycentric weights function", "[lagrange-interpolator]")
+{
+    SECTION("Test weights of equidistant nodes")
+    {
+        // Weights of equidistant nodes are proportional to (-1)^j * binomial(N-1, j)
+        const Vector xData = {0.0, 1.0, 2.0, 3.0};
+        const Vector weights = computeBarycentricWeights<Real>(xData);
+
+        REQUIRE(weights.size() == 4);
+        REQUIRE(weights[1] / weights[0] == Catch::Approx(-3.0));
+        REQUIRE(weights[2] / weights[0] == Catch::Approx(3.0));
+        REQUIRE(weights[3] / weights[0] == Catch::Approx(-1.0));
+    }
+}
+
+TEST_CASE("Test langrange interpolator class", "[lagrange-interpolator]")
+{
+    SECTION("Test that interpolator reproduces test cases of lagrangeInterpolate()")
+    {
+        const FunctionDataMap functionDataMap1 = {{0.0,3.0}, {1.0,2.0}, {6.0,9.0}, {10.0,17.0}};
+        const LagrangeInterpolator<Real> interpolator1(functionDataMap1);
+        REQUIRE(interpolator1.interpolate(3.0) == Catch::Approx(3.0));
+
+        const FunctionDataMap functionDataMap2 = {{0.0,0.0},
+                                                  {1.0,1.0},
+                                                  {2.0,8.0},
+                                                  {3.0,27.0},
+                                                  {4.0,64.0},
+                                                  {5.0,125.0},
+                                                  {6.0,216.0}};
+        const LagrangeInterpolator<Real> interpolator2(functionDataMap2);
+        REQUIRE(interpolator2.interpolate(3.25) == Catch::Approx(34.328125));
+
+        const FunctionDataMap functionDataMap3 = {{0.0,2.0}, {1.0,3.0}, {2.0,12.0}, {5.0,147.0}};
+        const LagrangeInterpolator<Real> interpolator3(functionDataMap3);
+        REQUIRE(interpolator3(3.0) == Catch::Approx(35.0));
+    }
+
+    SECTION("Test that interpolator matches lagrangeInterpolate() for repeated queries")
+    {
+        const FunctionDataMap functionDataMap = {{-1.5,0.25}, {0.0,1.0}, {0.5,-2.0}, {2.0,0.5}};
+        const LagrangeInterpolator<Real> interpolator(functionDataMap);
+        for (Real x = -1.4; x < 2.0; x += 0.1)
+        {
+            REQUIRE(interpolator(x) == Catch::Approx(lagrangeInterpolate(functionDataMap, x)));
+        }
+    }
+
+    SECTION("Test interpolation at nodes yields exact y-values")
+    {
+        const Vector xData = {0.0, 1.0, 6.0, 10.0};
+        const Vector yData = {3.0, 2.0, 9.0, 17.0};
+        const LagrangeInterpolator<Real> interpolator(xData, yData);
+
+        REQUIRE(interpolator(0.0) == 3.0);
+        REQUIRE(interpolator(1.0) == 2.0);
+        REQUIRE(interpolator(6.0) == 9.0);
+        REQUIRE(interpolator(10.0) == 17.0);
+    }
+
+    SECTION("Test accessors")
+    {
+        const Vector xData = {0.0, 1.0, 2.0};
+        const Vector yData = {1.0, 3.0, 7.0};
+        const LagrangeInterpolator<Real> interpolator(xData, yData);
+
+        REQUIRE(interpolator.getXData() == xData);
+        REQUIRE(interpolator.getYData() == yData);
+        REQUIRE(interpolator.getWeights() == computeBarycentricWeights<Real>(xData));
+    }
+}
+
+TEST_CASE("Test batch barycentric interpolation function", "[lagrange-interpolator]")
+{
+    const Vector xData = {-2.0, -1.25, 0.0, 0.5, 1.5, 3.0, 3.5};
+    const Vector weights = computeBarycentricWeights<Real>(xData);
+
+    // Use more y-columns than are processed per pass over the nodes
+    Matrix yColumns(11, Vector(xData.size()));
+    for (std::size_t k = 0; k < yColumns.size(); k++)
+    {
+        for (std::size_t j = 0; j < xData.size(); j++)
+        {
+            yColumns[k][j] = std::cos(static_cast<Real>(k + 1) * xData[j]);
+        }
+    }
+
+    // Use number of queries that is not a multiple of the query block size, including nodes
+    Vector queries;
+    for (Real x = -2.0; x <= 3.5; x += 0.05)
+    {
+        queries.push_back(x);
+    }
+    queries.push_back(0.5);
+    queries.push_back(-2.0);
+
+    Matrix results(yColumns.size(), Vector(queries.size()));
+    barycentricInterpolateBatch<Real>(xData, yColumns, weights, queries, results);
+
+    SECTION("Test that batch results match single-query results")
+    {
+        for (std::size_t k = 0; k < yColumns.size(); k++)
+        {
+            for (std::size_t q = 0; q < queries.size(); q++)
+            {
+                REQUIRE(results[k][q]
+                        == Catch::Approx(barycentricInterpolate(
+                               xData, yColumns[k], weights, queries[q])).margin(1.0e-12));
+            }
+        }
+    }
+
+    SECTION("Test that queries at nodes yield exact y-values")
+    {
+        const std::size_t last = queries.size() - 1;
+        for (std::size_t k = 0; k < yColumns.size(); k++)
+        {
+            REQUIRE(results[k][last - 1] == yColumns[k][3]);
+            REQUIRE(results[k][last] == yColumns[k][0]);
+        }
+    }
+
+    SECTION("Test batch interpolation using interpolator class")
+    {
+        const LagrangeInterpolator<Real> interpolator(xData, yColumns[2]);
+        Vector interpolatorResults;
+        interpolator.interpolate(queries, interpolatorResults);
+        REQUIRE(interpolatorResults == results[2]);
+    }
+}
+
+TEST_CASE("Test lagrange table interpolator class", "[lagrange-interpolator]")
+{
+    // Sample cubic polynomial on non-evenly distributed nodes, which is reproduced exactly (up to
+    // rounding) by stencils of 4 or more entries
+    Vector xData(50);
+    Vector yData(50);
+    for (std::size_t i = 0; i < xData.size(); i++)
+    {
+        xData[i] = static_cast<Real>(i) + 0.1 * std::sin(static_cast<Real>(i));
+        yData[i] = 2.0 * xData[i] * xData[i] * xData[i] - xData[i] + 5.0;
+    }
+
+    SECTION("Test interpolation of cubic polynomial with binary search")
+    {
+        const LagrangeTableInterpolator<Real> interpolator(xData, yData, 4);
+        for (Real x = 0.0; x < 49.0; x += 0.37)
+        {
+            REQUIRE(interpolator(x) == Catch::Approx(2.0 * x * x * x - x + 5.0));
+        }
+    }
+
+    SECTION("Test interpolation near start and end of table")
+    {
+        const LagrangeTableInterpolator<Real> interpolator(xData, yData, 6);
+        const Real xStart = xData.front() + 0.01;
+        const Real xEnd = xData.back() - 0.01;
+        REQUIRE(interpolator(xStart) == Catch::Approx(2.0 * xStart * xStart * xStart - xStart + 5.0));
+        REQUIRE(interpolator(xEnd) == Catch::Approx(2.0 * xEnd * xEnd * xEnd - xEnd + 5.0));
+    }
+
+    SECTION("Test interpolation at nodes yields exact y-values")
+    {
+        const LagrangeTableInterpolator<Real> interpolator(xData, yData, 5);
+        for (std::size_t i = 0; i < xData.size(); i++)
+        {
+            REQUIRE(interpolator(xData[i]) == yData[i]);
+        }
+    }
+
+    SECTION("Test that cursor yields same results as binary search")
+    {
+        const LagrangeTableInterpolator<Real> interpolator(xData, yData, 4);
+        std::size_t cursor = 0;
+        for (Real x = 0.0; x < 49.0; x += 0.37)
+        {
+            REQUIRE(interpolator.interpolate(x, cursor) == interpolator.interpolate(x));
+            REQUIRE(cursor == findInterval(xData, x));
+        }
+    }
+
+    SECTION("Test that batch interpolation yields same results as single queries")
+    {
+        const LagrangeTableInterpolator<Real> interpolator(xData, yData, 4);
+        Vector queries;
+        for (Real x = 0.0; x < 49.0; x += 0.37)
+        {
+            queries.push_back(x);
+        }
+        Vector results;
+        interpolator.interpolate(queries, results);
+        REQUIRE(results.size() == queries.size());
+        for (std::size_t i = 0; i < queries.size(); i++)
+        {
+            REQUIRE(results[i] == interpolator(queries[i]));
+        }
+    }
+
+    SECTION("Test that stencil spanning whole table matches lagrangeInterpolate()")
+    {
+        const FunctionDataMap functionDataMap = {{0.0,3.0}, {1.0,2.0}, {6.0,9.0}, {10.0,17.0}};
+        const LagrangeTableInterpolator<Real> interpolator(functionDataMap, 4);
+        REQUIRE(interpolator.getStencilSize() == 4);
+        REQUIRE(interpolator(3.0) == Catch::Approx(lagrangeInterpolate(functionDataMap, 3.0)));
+    }
+}
+
+TEST_CASE("Test adaptive-order Neville interpolation function", "[lagrange-interpolator]")
+{
+    Vector xData(101);
+    Vector yData(101);
+    for (std::size_t i = 0; i < xData.size(); i++)
+    {
+        xData[i] = 0.1 * static_cast<Real>(i);
+        yData[i] = std::sin(xData[i]);
+    }
+
+    SECTION("Test that estimated error meets tolerance for smooth function")
+    {
+        for (Real x = 0.0; x < 10.0; x += 0.0731)
+        {
+            const AdaptiveInterpolationResult<Real> result
+                = nevilleInterpolate(xData, yData, x, 1.0e-10);
+            REQUIRE(result.isConverged);
+            REQUIRE(result.errorEstimate <= 1.0e-10);
+            REQUIRE(result.order < 15);
+            REQUIRE(std::fabs(result.value - std::sin(x)) <= 1.0e-10);
+        }
+    }
+
+    SECTION("Test that order increases with tighter tolerance")
+    {
+        const AdaptiveInterpolationResult<Real> coarse
+            = nevilleInterpolate(xData, yData, 4.321, 1.0e-4);
+        const AdaptiveInterpolationResult<Real> fine
+            = nevilleInterpolate(xData, yData, 4.321, 1.0e-12);
+        REQUIRE(coarse.order < fine.order);
+        REQUIRE(std::fabs(coarse.value - std::sin(4.321)) <= 1.0e-4);
+        REQUIRE(std::fabs(fine.value - std::sin(4.321)) <= 1.0e-12);
+    }
+
+    SECTION("Test that cubic polynomial is reproduced at low order")
+    {
+        Vector cubicYData(xData.size());
+        for (std::size_t i = 0; i < xData.size(); i++)
+        {
+            cubicYData[i] = 2.0 * xData[i] * xData[i] * xData[i] - xData[i] + 5.0;
+        }
+        const Real x = 7.777;
+        const AdaptiveInterpolationResult<Real> result
+            = nevilleInterpolate(xData, cubicYData, x, 1.0e-9);
+        REQUIRE(result.isConverged);
+        REQUIRE(result.order <= 5);
+        REQUIRE(result.value == Catch::Approx(2.0 * x * x * x - x + 5.0).epsilon(1.0e-13));
+    }
+
+    SECTION("Test interpolation at nodes yields exact y-values at zeroth order")
+    {
+        for (std::size_t i = 0; i < xData.size(); i++)
+        {
+            const AdaptiveInterpolationResult<Real> result
+                = nevilleInterpolate(xData, yData, xData[i], 0.0);
+            REQUIRE(result.value == yData[i]);
+            REQUIRE(result.errorEstimate == 0.0);
+            REQUIRE(result.order == 0);
+            REQUIRE(result.isConverged);
+        }
+    }
+
+    SECTION("Test that maximum order and table size limit order")
+    {
+        const AdaptiveInterpolationResult<Real> limited
+            = nevilleInterpolate(xData, yData, 0.55, 1.0e-15, 2);
+        REQUIRE(!limited.isConverged);
+        REQUIRE(limited.order == 2);
+        REQUIRE(limited.errorEstimate > 1.0e-15);
+
+        const Vector smallXData = {1.0, 2.0, 4.0};
+        const Vector smallYData = {1.0, 4.0, 16.0};
+        const AdaptiveInterpolationResult<Real> small
+            = nevilleInterpolate(smallXData, smallYData, 3.0, 1.0e-15);
+        REQUIRE(small.order == 2);
+        REQUIRE(small.value == Catch::Approx(9.0));
+    }
+
+    SECTION("Test that cursor yields same results as binary search")
+    {
+        std::size_t cursor = 0;
+        for (Real x = -0.2; x < 10.2; x += 0.0731)
+        {
+            const AdaptiveInterpolationResult<Real> expected
+                = nevilleInterpolate(xData, yData, x, 1.0e-8);
+            const AdaptiveInterpolationResult<Real> result
+                = nevilleInterpolate(xData, yData, x, 1.0e-8, 15, cursor);
+            REQUIRE(result.value == expected.value);
+            REQUIRE(result.order == expected.order);
+            REQUIRE(cursor == findInterval(xData, x));
+        }
+    }
+}
+
 } // namespace tests
 } // namespace sml
\ No newline at end of file
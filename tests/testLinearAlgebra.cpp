@@ -6,8 +6,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <memory>
 #include <vector>
 
+#include "sml/arena.hpp"
+#include "sml/arrayView.hpp"
 #include "sml/linearAlgebra.hpp"
 
 namespace sml
@@ -17,6 +21,8 @@ namespace tests
 
 typedef double Real;
 typedef std::vector<Real> Vector;
+typedef std::array<Real, 3> Array3;
+typedef FixedVector<Real, 3> FixedVector3;
 
 TEST_CASE("Test cross product function", "[linear-algebra, cross-product]")
 {
@@ -64,6 +70,19 @@ TEST_CASE("Test cross product function", "[linear-algebra, cross-product]")
         REQUIRE(cross(vector1, vector2) == result);
     }
 
+    SECTION("Test computation of cross-product of fixed-size 3-vectors")
+    {
+        const Array3 array1 = {{1.342, -3.576, 12.113}};
+        const Array3 array2 = {{-0.024, 10.125, -9.645}};
+        const Array3 arrayResult = {{-88.153605, 12.652878000000001, 13.501926000000001}};
+        REQUIRE(cross(array1, array2) == arrayResult);
+
+        const FixedVector3 fixedVector1 = {{1.342, -3.576, 12.113}};
+        const FixedVector3 fixedVector2 = {{-0.024, 10.125, -9.645}};
+        const FixedVector3 fixedResult = {{-88.153605, 12.652878000000001, 13.501926000000001}};
+        REQUIRE(cross(fixedVector1, fixedVector2) == fixedResult);
+    }
+
     // @TODO: find a way to test assert statement in cross()
 
 }
@@ -180,6 +199,16 @@ TEST_CASE("Test normalize vector function", "[linear-algebra, norm]")
 
         REQUIRE(normalize<Real>(vector) == result);
     }
+
+    SECTION("Test normalization of fixed-size vectors")
+    {
+        const Array3 array = {{3.0, 0.0, -4.0}};
+        REQUIRE(normalize<Real>(array) == Array3({{0.6, 0.0, -0.8}}));
+
+        const FixedVector3 fixedVector = {{3.0, 0.0, -4.0}};
+        REQUIRE(normalize<Real>(fixedVector) == FixedVector3({{0.6, 0.0, -0.8}}));
+        REQUIRE(norm<Real>(fixedVector) == 5.0);
+    }
 }
 
 TEST_CASE("Test function that returns unit-vectors", "[linear-algebra, unit-vector]")
@@ -216,6 +245,17 @@ TEST_CASE("Test function that returns unit-vectors", "[linear-algebra, unit-vect
 
         REQUIRE(getZUnitVector<Vector>() == zUnitVector);
     }
+
+    SECTION("Test return of fixed-size unit-vectors")
+    {
+        REQUIRE(getXUnitVector<Array3>() == Array3({{1.0, 0.0, 0.0}}));
+        REQUIRE(getYUnitVector<Array3>() == Array3({{0.0, 1.0, 0.0}}));
+        REQUIRE(getZUnitVector<Array3>() == Array3({{0.0, 0.0, 1.0}}));
+
+        REQUIRE(getXUnitVector<FixedVector3>() == FixedVector3({{1.0, 0.0, 0.0}}));
+        REQUIRE(getYUnitVector<FixedVector3>() == FixedVector3({{0.0, 1.0, 0.0}}));
+        REQUIRE(getZUnitVector<FixedVector3>() == FixedVector3({{0.0, 0.0, 1.0}}));
+    }
 }
 
 TEST_CASE("Test element-wise operations", "[linear-algebra, element-wise]")
@@ -387,5 +427,169 @@ TEST_CASE("Test element-wise operations", "[linear-algebra, element-wise]")
 
 }
 
+TEST_CASE("Test in-place and output-parameter operations", "[linear-algebra, in-place]")
+{
+    const Vector vector1({1.234, -2.674, 10.812});
+    const Vector vector2({-0.54, 12.3, 3.75});
+
+    SECTION("Test cross product written to output vector")
+    {
+        Vector result(3);
+        cross(vector1, vector2, result);
+        REQUIRE(result == cross(vector1, vector2));
+
+        Vector aliased = vector1;
+        cross(aliased, vector2, aliased);
+        REQUIRE(aliased == cross(vector1, vector2));
+
+        const Array3 array1 = {{1.0, 0.0, 0.0}};
+        const Array3 array2 = {{0.0, 1.0, 0.0}};
+        Array3 arrayResult;
+        cross(array1, array2, arrayResult);
+        REQUIRE(arrayResult == Array3({{0.0, 0.0, 1.0}}));
+    }
+
+    SECTION("Test normalization written to output vector and in-place")
+    {
+        Vector result(3);
+        normalize<Real>(vector1, result);
+        REQUIRE(result == normalize<Real>(vector1));
+
+        Vector vector = vector1;
+        normalizeInPlace<Real>(vector);
+        REQUIRE(vector == normalize<Real>(vector1));
+
+        FixedVector3 fixedVector = {{3.0, 0.0, -4.0}};
+        normalizeInPlace<Real>(fixedVector);
+        REQUIRE(fixedVector == FixedVector3({{0.6, 0.0, -0.8}}));
+    }
+
+    SECTION("Test multiplication written to output vector and in-place")
+    {
+        Vector result(3);
+        multiply(vector1, -2.5, result);
+        REQUIRE(result == multiply(vector1, -2.5));
+
+        Vector vector = vector1;
+        multiplyInPlace(vector, -2.5);
+        REQUIRE(vector == multiply(vector1, -2.5));
+    }
+
+    SECTION("Test addition of scalar written to output vector and in-place")
+    {
+        Vector result(3);
+        add(vector1, 0.75, result);
+        REQUIRE(result == add(vector1, 0.75));
+
+        Vector vector = vector1;
+        addInPlace(vector, 0.75);
+        REQUIRE(vector == add(vector1, 0.75));
+    }
+
+    SECTION("Test addition of vectors written to output vector and in-place")
+    {
+        Vector result(3);
+        add(vector1, vector2, result);
+        REQUIRE(result == add(vector1, vector2));
+
+        Vector vector = vector1;
+        addInPlace(vector, vector2);
+        REQUIRE(vector == add(vector1, vector2));
+    }
+
+    SECTION("Test operations written to caller-owned storage")
+    {
+        Real buffer[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+        ArrayView<Real> first(buffer, 3);
+        ArrayView<Real> second(buffer + 3, 3);
+
+        add(vector1, vector2, first);
+        multiply(vector1, 2.0, second);
+
+        const Vector sum = add(vector1, vector2);
+        const Vector product = multiply(vector1, 2.0);
+        for (unsigned int i = 0; i < 3; i++)
+        {
+            REQUIRE(buffer[i] == sum[i]);
+            REQUIRE(buffer[i + 3] == product[i]);
+        }
+    }
+}
+
+TEST_CASE("Test allocator-extended operations", "[linear-algebra, allocator]")
+{
+    typedef ArenaAllocator<Real> Allocator;
+    typedef std::vector<Real, Allocator> ArenaVector;
+
+    MonotonicArena arena(1024);
+    const Allocator allocator(arena);
+    const Vector vector1({1.234, -2.674, 10.812});
+    const Vector vector2({-0.54, 12.3, 3.75});
+    const ArenaVector arenaVector1(vector1.begin(), vector1.end(), allocator);
+    const ArenaVector arenaVector2(vector2.begin(), vector2.end(), allocator);
+
+    SECTION("Test that results are allocated from arena")
+    {
+        const std::size_t size = arena.getSize();
+        const ArenaVector sum = add(std::allocator_arg, allocator, arenaVector1, arenaVector2);
+        REQUIRE(sum.get_allocator() == allocator);
+        REQUIRE(arena.getSize() == size + 3 * sizeof(Real));
+
+        const Vector expected = add(vector1, vector2);
+        REQUIRE(Vector(sum.begin(), sum.end()) == expected);
+    }
+
+    SECTION("Test that results match default-allocated results")
+    {
+        const ArenaVector crossProduct
+            = cross(std::allocator_arg, allocator, arenaVector1, arenaVector2);
+        const ArenaVector normalized = normalize<Real>(std::allocator_arg, allocator, arenaVector1);
+        const ArenaVector product = multiply(std::allocator_arg, allocator, arenaVector1, -2.5);
+        const ArenaVector sum = add(std::allocator_arg, allocator, arenaVector1, 0.75);
+        const ArenaVector unitVector = getYUnitVector<ArenaVector>(std::allocator_arg, allocator);
+
+        REQUIRE(Vector(crossProduct.begin(), crossProduct.end()) == cross(vector1, vector2));
+        REQUIRE(Vector(normalized.begin(), normalized.end()) == normalize<Real>(vector1));
+        REQUIRE(Vector(product.begin(), product.end()) == multiply(vector1, -2.5));
+        REQUIRE(Vector(sum.begin(), sum.end()) == add(vector1, 0.75));
+        REQUIRE(Vector(unitVector.begin(), unitVector.end()) == getYUnitVector<Vector>());
+    }
+
+    SECTION("Test that fixed-size vectors ignore allocator")
+    {
+        const FixedVector3 fixedVector1 = {{1.0, 2.0, 3.0}};
+        const FixedVector3 fixedVector2 = {{-2.0, 0.5, 4.0}};
+        const std::size_t size = arena.getSize();
+        REQUIRE(cross(std::allocator_arg, allocator, fixedVector1, fixedVector2)
+                == cross(fixedVector1, fixedVector2));
+        REQUIRE(getXUnitVector<Array3>(std::allocator_arg, allocator)
+                == getXUnitVector<Array3>());
+        REQUIRE(arena.getSize() == size);
+    }
+}
+
+TEST_CASE("Test compile-time evaluation", "[linear-algebra, constexpr]")
+{
+    constexpr FixedVector3 vector1 = {{1.0, 2.0, 3.0}};
+    constexpr FixedVector3 vector2 = {{-2.0, 0.5, 4.0}};
+
+    SECTION("Test products")
+    {
+        constexpr FixedVector3 crossProduct = cross(vector1, vector2);
+        static_assert(crossProduct == FixedVector3({{6.5, -10.0, 4.5}}), "cross");
+        static_assert(dot<Real>(vector1, vector2) == 11.0, "dot");
+        static_assert(squaredNorm<Real>(vector1) == 14.0, "squaredNorm");
+        REQUIRE(crossProduct == cross(vector1, vector2));
+    }
+
+    SECTION("Test element-wise operations and unit-vectors")
+    {
+        constexpr FixedVector3 sum = add(multiply(vector1, 2.0), add(vector2, 0.5));
+        static_assert(sum == FixedVector3({{0.5, 5.0, 10.5}}), "element-wise");
+        static_assert(getZUnitVector<FixedVector3>()[2] == 1.0, "unit-vector");
+        REQUIRE(sum == add(multiply(vector1, 2.0), add(vector2, 0.5)));
+    }
+}
+
 } // namespace tests
 } // namespace sml
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "sml/constants.hpp"
+#include "sml/fixedVector.hpp"
+#include "sml/matrix3.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 3> Vector3;
+typedef Matrix3<Real> Matrix;
+
+//! Check if two 3x3 matrices are equal up to rounding.
+bool isApproximatelyEqual(const Matrix& matrix1, const Matrix& matrix2)
+{
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        for (std::size_t j = 0; j < 3; j++)
+        {
+            if (matrix1(i, j) != Catch::Approx(matrix2(i, j)).margin(1.0e-15))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Test 3x3 matrix", "[matrix3]")
+{
+    constexpr Matrix matrix = {{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}}};
+
+    SECTION("Test element access and comparison")
+    {
+        static_assert(matrix(1, 2) == 6.0, "element access");
+        REQUIRE(matrix(2, 0) == 7.0);
+        Matrix copy = matrix;
+        REQUIRE(copy == matrix);
+        copy(0, 1) = -2.0;
+        REQUIRE(copy != matrix);
+    }
+
+    SECTION("Test transpose")
+    {
+        constexpr Matrix transposed = transpose(matrix);
+        static_assert(transposed(0, 2) == 7.0 && transposed(2, 0) == 3.0, "transpose");
+        REQUIRE(transpose(transposed) == matrix);
+    }
+
+    SECTION("Test matrix-matrix product")
+    {
+        constexpr Matrix square = multiply(matrix, matrix);
+        REQUIRE(square
+                == Matrix({{{30.0, 36.0, 42.0}, {66.0, 81.0, 96.0}, {102.0, 126.0, 150.0}}}));
+        REQUIRE(multiply(matrix, getIdentityMatrix<Real>()) == matrix);
+        REQUIRE(multiply(getIdentityMatrix<Real>(), matrix) == matrix);
+    }
+
+    SECTION("Test matrix-vector product")
+    {
+        const Vector3 vector = {{1.0, -1.0, 2.0}};
+        REQUIRE(multiply(matrix, vector) == Vector3({{5.0, 11.0, 17.0}}));
+        REQUIRE(multiply(matrix, Vector({1.0, -1.0, 2.0})) == Vector({5.0, 11.0, 17.0}));
+        constexpr FixedVector<Real, 3> fixedVector = {{1.0, -1.0, 2.0}};
+        static_assert(multiply(matrix, fixedVector)[2] == 17.0, "matrix-vector product");
+    }
+}
+
+TEST_CASE("Test rotation matrices", "[matrix3, rotation]")
+{
+    const Real angle = 0.3;
+
+    SECTION("Test rotations of unit-vectors by a quarter turn")
+    {
+        const Vector3 x = {{1.0, 0.0, 0.0}};
+        const Vector3 y = {{0.0, 1.0, 0.0}};
+        const Vector3 z = {{0.0, 0.0, 1.0}};
+        const Vector3 rotatedY = multiply(getXRotationMatrix(halfPi<Real>), y);
+        const Vector3 rotatedZ = multiply(getYRotationMatrix(halfPi<Real>), z);
+        const Vector3 rotatedX = multiply(getZRotationMatrix(halfPi<Real>), x);
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            REQUIRE(rotatedY[i] == Catch::Approx(z[i]).margin(1.0e-15));
+            REQUIRE(rotatedZ[i] == Catch::Approx(x[i]).margin(1.0e-15));
+            REQUIRE(rotatedX[i] == Catch::Approx(y[i]).margin(1.0e-15));
+        }
+    }
+
+    SECTION("Test that transpose is inverse rotation")
+    {
+        const Matrix rotation = multiply(getZRotationMatrix(angle), getXRotationMatrix(-angle));
+        REQUIRE(isApproximatelyEqual(multiply(transpose(rotation), rotation),
+                                     getIdentityMatrix<Real>()));
+        REQUIRE(isApproximatelyEqual(transpose(getYRotationMatrix(angle)),
+                                     getYRotationMatrix(-angle)));
+    }
+
+    SECTION("Test composition of rotations about same axis")
+    {
+        const Matrix rotation = getZRotationMatrix(angle);
+        REQUIRE(isApproximatelyEqual(multiply(rotation, rotation),
+                                     getZRotationMatrix(2.0 * angle)));
+    }
+}
+
+TEST_CASE("Test batch rotation of 3-vectors", "[matrix3, vector3-batch]")
+{
+    // Size that is not a multiple of SIMD width.
+    const std::size_t size = 37;
+    std::vector<Vector3> vectors(size);
+    std::vector<Matrix> matrices(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const Real value = 0.1 * static_cast<Real>(i);
+        vectors[i] = {{std::cos(value) * (1.0 + value), std::sin(value) - 2.0, value - 1.0}};
+        matrices[i] = multiply(getZRotationMatrix(value), getXRotationMatrix(0.5 - value));
+    }
+    const Vector3Batch<Real> batch = convertToStructureOfArrays<Real>(vectors);
+    const Matrix matrix = matrices[5];
+
+    SECTION("Test rotation by one matrix")
+    {
+        Vector3Batch<Real> result;
+        multiply(matrix, batch, result);
+        REQUIRE(result.size() == size);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const Vector3 expected = multiply(matrix, vectors[i]);
+            const Vector3 actual = result.get<Vector3>(i);
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                REQUIRE(actual[j] == Catch::Approx(expected[j]).epsilon(1.0e-14).margin(1.0e-14));
+            }
+        }
+    }
+
+    SECTION("Test batch of matrices")
+    {
+        Matrix3Batch<Real> matrixBatch(size);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            matrixBatch.set(i, matrices[i]);
+        }
+        REQUIRE(matrixBatch.size() == size);
+        REQUIRE(matrixBatch.get(7) == matrices[7]);
+        REQUIRE(matrixBatch.getElements(1, 2)[7] == matrices[7](1, 2));
+        matrixBatch.resize(3);
+        REQUIRE(matrixBatch.size() == 3);
+    }
+
+    SECTION("Test rotation by one matrix per vector, in-place")
+    {
+        Matrix3Batch<Real> matrixBatch(size);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            matrixBatch.set(i, matrices[i]);
+        }
+        Vector3Batch<Real> result = batch;
+        multiply(matrixBatch, result, result);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const Vector3 expected = multiply(matrices[i], vectors[i]);
+            const Vector3 actual = result.get<Vector3>(i);
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                REQUIRE(actual[j] == Catch::Approx(expected[j]).epsilon(1.0e-14).margin(1.0e-14));
+            }
+        }
+    }
+}
+
+} // namespace tests
+} // namespace sml
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "sml/basicFunctionsBatch.hpp"
+#include "sml/lagrangeInterpolator.hpp"
+#include "sml/linearAlgebra.hpp"
+#include "sml/profileReport.hpp"
+#include "sml/profiling.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::deque<Real> Vector;
+
+//! Get profile of function with given name.
+ProfileEntry getProfileEntry(const std::string& name)
+{
+    const std::vector<ProfileEntry> entries = getProfile();
+    for (const ProfileEntry& entry : entries)
+    {
+        if (entry.name == name)
+        {
+            return entry;
+        }
+    }
+    ProfileEntry empty = {name, 0, 0, {{}}};
+    return empty;
+}
+
+TEST_CASE("Test profiling of functions", "[profiling]")
+{
+    SECTION("Test histogram bins")
+    {
+        REQUIRE(detail::getProfileHistogramBin(0) == 0);
+        REQUIRE(detail::getProfileHistogramBin(1) == 1);
+        REQUIRE(detail::getProfileHistogramBin(3) == 2);
+        REQUIRE(detail::getProfileHistogramBin(4) == 3);
+        REQUIRE(detail::getProfileHistogramBin(static_cast<std::size_t>(1) << 40)
+                == profileHistogramSize - 1);
+    }
+
+    SECTION("Test call counts and input sizes")
+    {
+        resetProfile();
+        const Vector vector20(20, 2.0);
+        const Vector vector100(100, 1.0);
+        for (int i = 0; i < 5; i++)
+        {
+            REQUIRE(dot<Real>(vector20, vector20) == 80.0);
+        }
+        REQUIRE(sum<Real>(vector100, SummationMethod::kahan) == 100.0);
+        REQUIRE(norm<Real>(vector100) == Catch::Approx(10.0));
+
+        const std::deque<std::pair<Real, Real> > functionData
+            = {{0.0, 1.0}, {1.0, 2.0}, {2.0, 5.0}};
+        REQUIRE(lagrangeInterpolate(functionData, 3.0) == Catch::Approx(10.0));
+
+        const ProfileEntry dotEntry = getProfileEntry("dot");
+        REQUIRE(dotEntry.callCount == 6);
+        REQUIRE(dotEntry.sizeHistogram[5] == 5);
+        REQUIRE(dotEntry.sizeHistogram[7] == 1);
+        REQUIRE(getProfileEntry("sum").callCount == 1);
+        REQUIRE(getProfileEntry("lagrangeInterpolate").callCount == 1);
+        REQUIRE(getProfileEntry("lagrangeInterpolate").sizeHistogram[2] == 1);
+
+        resetProfile();
+        REQUIRE(getProfileEntry("dot").callCount == 0);
+    }
+
+    SECTION("Test profiling of interpolation with cursor")
+    {
+        resetProfile();
+        const Vector xData = {0.0, 1.0, 2.0, 3.0, 4.0};
+        const Vector yData = {0.0, 1.0, 4.0, 9.0, 16.0};
+        std::size_t cursor = 0;
+        nevilleInterpolate(xData, yData, 1.5, 1.0e-12, 3, cursor);
+        nevilleInterpolate(xData, yData, 2.5, 1.0e-12);
+        REQUIRE(getProfileEntry("nevilleInterpolate").callCount == 2);
+
+        const std::vector<long double> tableXData(xData.begin(), xData.end());
+        const std::vector<long double> tableYData(yData.begin(), yData.end());
+        const LagrangeTableInterpolator<long double> interpolator(tableXData, tableYData, 3);
+        REQUIRE(interpolator.interpolate(2.5L, cursor) == Catch::Approx(6.25));
+        std::vector<long double> results;
+        interpolator.interpolate(std::vector<long double>(10, 1.5L), results);
+        REQUIRE(getProfileEntry("LagrangeTableInterpolator::interpolate").callCount == 1);
+        REQUIRE(getProfileEntry("LagrangeTableInterpolator::interpolate(batch)").callCount == 1);
+    }
+
+    SECTION("Test profiling of batch modulo and angle conversions")
+    {
+        resetProfile();
+        const std::vector<Real> angles(10, 1.0);
+        std::vector<Real> results(angles.size());
+        computeModulo(angles, 2.0 * pi<Real>, results);
+        computeModuloFast(angles, 2.0 * pi<Real>, results);
+        convertRadiansToDegrees<Real>(angles, results);
+        convertDegreesToRadians<Real>(angles, results);
+        convertRadiansToWrappedDegrees<Real>(angles, results);
+        convertDegreesToWrappedRadians<Real>(angles, results);
+        REQUIRE(getProfileEntry("computeModulo").callCount == 1);
+        REQUIRE(getProfileEntry("computeModulo").sizeHistogram[4] == 1);
+        REQUIRE(getProfileEntry("computeModuloFast").callCount == 1);
+        REQUIRE(getProfileEntry("convertRadiansToDegrees").callCount == 1);
+        REQUIRE(getProfileEntry("convertDegreesToRadians").callCount == 1);
+        REQUIRE(getProfileEntry("convertRadiansToWrappedDegrees").callCount == 1);
+        REQUIRE(getProfileEntry("convertDegreesToWrappedRadians").callCount == 1);
+    }
+
+    SECTION("Test merging of threads")
+    {
+        resetProfile();
+        const Vector vector(16, 1.0);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; i++)
+        {
+            threads.emplace_back([&vector]()
+            {
+                for (int j = 0; j < 10; j++)
+                {
+                    sum<Real>(vector, SummationMethod::pairwise);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        sum<Real>(vector, SummationMethod::pairwise);
+
+        const ProfileEntry entry = getProfileEntry("sum");
+        REQUIRE(entry.callCount == 41);
+        REQUIRE(entry.sizeHistogram[5] == 41);
+    }
+
+    SECTION("Test profiling of user code and timings")
+    {
+        resetProfile();
+        {
+            SML_PROFILE("user code", 1000);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        const ProfileEntry entry = getProfileEntry("user code");
+        REQUIRE(entry.callCount == 1);
+        REQUIRE(entry.nanoseconds >= 2000000);
+        REQUIRE(getProfile().front().name == "user code");
+    }
+
+    SECTION("Test JSON report")
+    {
+        resetProfile();
+        const Vector vector(2, 1.0);
+        sum<Real>(vector, SummationMethod::sequential);
+        std::ostringstream stream;
+        writeProfile(stream);
+        const std::string report = stream.str();
+        REQUIRE(report.find("{\"functions\": [") == 0);
+        REQUIRE(report.find("\"name\": \"sum\", \"callCount\": 1") != std::string::npos);
+        REQUIRE(report.find("\"sizeHistogram\": [{\"minimumSize\": 2, \"maximumSize\": 3, "
+                            "\"callCount\": 1}]") != std::string::npos);
+
+        resetProfile();
+        std::ostringstream emptyStream;
+        writeProfile(emptyStream);
+        REQUIRE(emptyStream.str() == "{\"functions\": []}\n");
+    }
+}
+
+} // namespace tests
+} // namespace sml
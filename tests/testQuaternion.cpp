@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "sml/constants.hpp"
+#include "sml/executionPolicy.hpp"
+#include "sml/linearAlgebra.hpp"
+#include "sml/matrix3.hpp"
+#include "sml/quaternion.hpp"
+#include "sml/threadPool.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 3> Vector3;
+typedef Quaternion<Real> Quat;
+
+//! Check if two 3-vectors are equal up to rounding.
+bool isSameVector(const Vector3& vector1, const Vector3& vector2)
+{
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        if (vector1[i] != Catch::Approx(vector2[i]).epsilon(1.0e-14).margin(1.0e-14))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Check if two unit quaternions represent the same rotation up to rounding.
+bool isSameRotation(const Quat& quaternion1, const Quat& quaternion2)
+{
+    return std::fabs(dot<Real>(quaternion1, quaternion2)) == Catch::Approx(1.0).epsilon(1.0e-14);
+}
+
+TEST_CASE("Test quaternion", "[quaternion]")
+{
+    constexpr Quat quaternion = {{1.0, 2.0, 3.0, 4.0}};
+
+    SECTION("Test element access, comparison and compile-time evaluation")
+    {
+        static_assert(quaternion[2] == 3.0 && Quat::size() == 4, "element access");
+        constexpr Quat conjugated = conjugate(quaternion);
+        static_assert(conjugated == Quat({{1.0, -2.0, -3.0, -4.0}}), "conjugate");
+        static_assert(conjugate(conjugated) == quaternion, "conjugate");
+        static_assert(multiply(quaternion, getIdentityQuaternion<Real>()) == quaternion,
+                      "identity");
+        REQUIRE(quaternion != conjugated);
+    }
+
+    SECTION("Test Hamilton product")
+    {
+        constexpr Quat i = {{0.0, 1.0, 0.0, 0.0}};
+        constexpr Quat j = {{0.0, 0.0, 1.0, 0.0}};
+        constexpr Quat k = {{0.0, 0.0, 0.0, 1.0}};
+        REQUIRE(multiply(i, j) == k);
+        REQUIRE(multiply(j, i) == conjugate(k));
+        REQUIRE(multiply(multiply(i, j), k) == Quat({{-1.0, 0.0, 0.0, 0.0}}));
+        REQUIRE(multiply(quaternion, conjugate(quaternion)) == Quat({{30.0, 0.0, 0.0, 0.0}}));
+    }
+
+    SECTION("Test normalization reusing generic norm")
+    {
+        REQUIRE(norm<Real>(quaternion) == Catch::Approx(std::sqrt(30.0)));
+        const Quat normalized = normalize<Real>(quaternion);
+        REQUIRE(norm<Real>(normalized) == Catch::Approx(1.0));
+        REQUIRE(normalized[3] == Catch::Approx(4.0 / std::sqrt(30.0)));
+    }
+}
+
+TEST_CASE("Test quaternion rotations", "[quaternion, rotation]")
+{
+    const Vector3 xAxis = {{1.0, 0.0, 0.0}};
+    const Vector3 zAxis = {{0.0, 0.0, 1.0}};
+    const Vector3 axis = normalize<Real>(Vector3({{1.0, -2.0, 0.5}}));
+    const Quat rotation = convertAxisAngleToQuaternion(axis, 0.7);
+    const Vector3 vector = {{0.3, -1.2, 2.5}};
+
+    SECTION("Test rotation is consistent with rotation matrices")
+    {
+        const Quat zRotation = convertAxisAngleToQuaternion(zAxis, halfPi<Real>);
+        REQUIRE(isSameVector(rotate(zRotation, xAxis), Vector3({{0.0, 1.0, 0.0}})));
+        REQUIRE(isSameVector(rotate(convertAxisAngleToQuaternion(xAxis, 0.3), vector),
+                             multiply(getXRotationMatrix(0.3), vector)));
+        REQUIRE(isSameVector(rotate(rotation, vector),
+                             multiply(convertQuaternionToMatrix(rotation), vector)));
+        REQUIRE(rotate(getIdentityQuaternion<Real>(), Vector({1.0, 2.0, 3.0}))
+                == Vector({1.0, 2.0, 3.0}));
+    }
+
+    SECTION("Test composition and inverse")
+    {
+        const Quat other = convertAxisAngleToQuaternion(xAxis, -1.1);
+        REQUIRE(isSameVector(rotate(multiply(rotation, other), vector),
+                             rotate(rotation, rotate(other, vector))));
+        REQUIRE(isSameVector(rotate(conjugate(rotation), rotate(rotation, vector)), vector));
+        const Quat twice = multiply(rotation, rotation);
+        REQUIRE(isSameRotation(twice, convertAxisAngleToQuaternion(axis, 1.4)));
+    }
+
+    SECTION("Test conversion to and from rotation matrix")
+    {
+        REQUIRE(isSameRotation(convertMatrixToQuaternion(convertQuaternionToMatrix(rotation)),
+                               rotation));
+
+        // Rotations by (nearly) 180 degrees about each axis exercise all branches.
+        const Real angles[] = {0.0, 0.5, pi<Real>, pi<Real> - 1.0e-9};
+        const Vector3 axes[] = {xAxis, {{0.0, 1.0, 0.0}}, zAxis, axis};
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            for (std::size_t j = 0; j < 4; j++)
+            {
+                const Quat expected = convertAxisAngleToQuaternion(axes[j], angles[i]);
+                const Quat actual = convertMatrixToQuaternion(convertQuaternionToMatrix(expected));
+                REQUIRE(norm<Real>(actual) == Catch::Approx(1.0).epsilon(1.0e-14));
+                REQUIRE(isSameRotation(actual, expected));
+            }
+        }
+    }
+
+    SECTION("Test spherical linear interpolation")
+    {
+        const Quat start = convertAxisAngleToQuaternion(axis, 0.2);
+        const Quat end = convertAxisAngleToQuaternion(axis, 1.4);
+        REQUIRE(isSameRotation(slerp(start, end, 0.0), start));
+        REQUIRE(isSameRotation(slerp(start, end, 1.0), end));
+        REQUIRE(isSameRotation(slerp(start, end, 0.25), convertAxisAngleToQuaternion(axis, 0.5)));
+
+        // Shortest path: negated end quaternion represents the same rotation.
+        const Quat negatedEnd = {{-end[0], -end[1], -end[2], -end[3]}};
+        REQUIRE(isSameRotation(slerp(start, negatedEnd, 0.5),
+                               convertAxisAngleToQuaternion(axis, 0.8)));
+
+        // Nearly equal quaternions fall back to normalized linear interpolation.
+        const Quat nearStart = convertAxisAngleToQuaternion(axis, 0.2 + 1.0e-6);
+        const Quat interpolated = slerp(start, nearStart, 0.5);
+        REQUIRE(norm<Real>(interpolated) == Catch::Approx(1.0).epsilon(1.0e-15));
+        REQUIRE(isSameRotation(interpolated, convertAxisAngleToQuaternion(axis, 0.2 + 0.5e-6)));
+    }
+}
+
+TEST_CASE("Test batch rotation of 3-vectors by quaternion", "[quaternion, vector3-batch]")
+{
+    // Size that is not a multiple of SIMD width.
+    const std::size_t size = 37;
+    std::vector<Vector3> vectors(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const Real value = 0.1 * static_cast<Real>(i);
+        vectors[i] = {{std::cos(value) * (1.0 + value), std::sin(value) - 2.0, value - 1.0}};
+    }
+    const Quat rotation
+        = convertAxisAngleToQuaternion(normalize<Real>(Vector3({{-0.3, 0.4, 1.0}})), 2.1);
+
+    Vector3Batch<Real> result = convertToStructureOfArrays<Real>(vectors);
+    rotate(rotation, result, result);
+    REQUIRE(result.size() == size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        REQUIRE(isSameVector(result.get<Vector3>(i), rotate(rotation, vectors[i])));
+    }
+
+    ThreadPool threadPool(2);
+    Vector3Batch<Real> parallelResult;
+    rotate(rotation,
+           convertToStructureOfArrays<Real>(vectors),
+           parallelResult,
+           ExecutionPolicy(ExecutionMode::parallelVectorized, &threadPool, 8));
+    REQUIRE(convertToArrayOfStructures<Vector3>(parallelResult)
+            == convertToArrayOfStructures<Vector3>(result));
+}
+
+} // namespace tests
+} // namespace sml
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/executionPolicy.hpp"
+#include "sml/linearAlgebra.hpp"
+#include "sml/linearAlgebraBatch.hpp"
+#include "sml/reduction.hpp"
+#include "sml/threadPool.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Test reductions", "[reduction]")
+{
+    // Sum of 1 and 2^20 values of 2^-60, which is 1 + 2^-40. Summing sequentially loses all
+    // small values, since 1 + 2^-60 rounds to 1.
+    const std::size_t size = 1048577;
+    Vector values(size, std::ldexp(1.0, -60));
+    values[0] = 1.0;
+    const Vector ones(size, 1.0);
+    const Real exactSum = 1.0 + std::ldexp(1.0, -40);
+
+    SECTION("Test sequential summation")
+    {
+        REQUIRE(dot<Real>(values, ones, SummationMethod::sequential) == 1.0);
+    }
+
+    SECTION("Test pairwise summation")
+    {
+        const Real tolerance = 4.0 * std::numeric_limits<Real>::epsilon();
+        REQUIRE(std::fabs(dot<Real>(values, ones, SummationMethod::pairwise) - exactSum)
+                <= tolerance);
+    }
+
+    SECTION("Test Kahan summation")
+    {
+        REQUIRE(dot<Real>(values, ones, SummationMethod::kahan) == exactSum);
+
+        // Alternating large and small values, which defeat pairwise summation.
+        Vector alternating(4096);
+        for (std::size_t i = 0; i < alternating.size(); i += 2)
+        {
+            alternating[i] = 1.0e16;
+            alternating[i + 1] = 1.0;
+        }
+        Vector signs(alternating.size(), 1.0);
+        for (std::size_t i = 0; i < alternating.size(); i += 4)
+        {
+            signs[i] = -1.0;
+        }
+        REQUIRE(dot<Real>(alternating, signs, SummationMethod::kahan) == 2048.0);
+    }
+
+    SECTION("Test default summation method")
+    {
+        REQUIRE(dot<Real>(values, ones) == dot<Real>(values, ones, SummationMethod::pairwise));
+        REQUIRE(squaredNorm<Real>(values) == squaredNorm<Real>(values, SummationMethod::pairwise));
+        REQUIRE(norm<Real>(values, SummationMethod::kahan) == 1.0);
+
+        const Vector shortVector({1.234, -2.674, 10.812, -12.123});
+        REQUIRE(dot<Real>(shortVector, shortVector)
+                == dot<Real>(shortVector, shortVector, SummationMethod::sequential));
+    }
+
+    SECTION("Test that result does not depend on execution policy")
+    {
+        Vector randomValues(size);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            randomValues[i] = std::sin(static_cast<Real>(i));
+        }
+        const Real pairwiseReference = dot<Real>(randomValues, randomValues);
+        const Real kahanReference = sum<Real>(randomValues, SummationMethod::kahan);
+
+        ThreadPool threadPool(3);
+        const std::size_t chunkSizes[] = {0, 1000, 3000, 100000};
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            const ExecutionPolicy policy(ExecutionMode::parallel, &threadPool, chunkSizes[i]);
+            REQUIRE(dot<Real>(randomValues, randomValues, policy) == pairwiseReference);
+            REQUIRE(sum<Real>(randomValues, SummationMethod::kahan, policy) == kahanReference);
+        }
+        REQUIRE(norm<Real>(randomValues, ExecutionMode::parallelVectorized)
+                == std::sqrt(pairwiseReference));
+    }
+
+    SECTION("Test summation of vectors that are not a multiple of the number of lanes")
+    {
+        for (std::size_t length = 1; length < 40; length++)
+        {
+            const Vector integers(length, 3.0);
+            REQUIRE(dot<Real>(integers, integers, SummationMethod::pairwise) == 9.0 * length);
+            REQUIRE(dot<Real>(integers, integers, SummationMethod::kahan) == 9.0 * length);
+        }
+    }
+}
+
+TEST_CASE("Test single-precision reductions", "[reduction]")
+{
+    // Sum of 2^20 values of 0.1f, which are summed in single precision without promotion.
+    const std::size_t size = 1048576;
+    const std::vector<float> values(size, 0.1f);
+    const double exactSum = static_cast<double>(size) * static_cast<double>(0.1f);
+
+    SECTION("Test that single-precision lanes are twice as many as double-precision lanes")
+    {
+        REQUIRE(detail::reductionLaneCount<float> == 2 * detail::reductionLaneCount<double>);
+    }
+
+    SECTION("Test sum of elements")
+    {
+        const float sequential = sum<float>(values, SummationMethod::sequential);
+        const float pairwise = sum<float>(values, SummationMethod::pairwise);
+        const float kahan = sum<float>(values, SummationMethod::kahan);
+        REQUIRE(std::fabs(sequential - exactSum) > 1.0e-3 * exactSum);
+        REQUIRE(std::fabs(pairwise - exactSum) <= 1.0e-6 * exactSum);
+        REQUIRE(kahan == static_cast<float>(exactSum));
+        REQUIRE(sum<float>(values) == pairwise);
+    }
+
+    SECTION("Test dot-product")
+    {
+        const std::vector<float> ones(size, 1.0f);
+        REQUIRE(dot<float>(values, ones, SummationMethod::kahan) == static_cast<float>(exactSum));
+        REQUIRE(std::fabs(dot<float>(values, ones) - exactSum) <= 1.0e-6 * exactSum);
+    }
+
+    SECTION("Test summation of vectors that are not a multiple of the number of lanes")
+    {
+        for (std::size_t length = 1; length < 72; length++)
+        {
+            const std::vector<float> integers(length, 3.0f);
+            const float expected = 3.0f * static_cast<float>(length);
+            REQUIRE(sum<float>(integers, SummationMethod::sequential) == expected);
+            REQUIRE(sum<float>(integers, SummationMethod::pairwise) == expected);
+            REQUIRE(sum<float>(integers, SummationMethod::kahan) == expected);
+        }
+    }
+}
+
+} // namespace tests
+} // namespace sml
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/simd.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+TEST_CASE("Test runtime instruction set selection", "[simd]")
+{
+    const InstructionSet detected = getInstructionSet();
+
+    SECTION("Test that generic instruction set is always supported")
+    {
+        REQUIRE(setInstructionSet(InstructionSet::generic));
+        REQUIRE(getInstructionSet() == InstructionSet::generic);
+    }
+
+    SECTION("Test that detected instruction set can be restored")
+    {
+        REQUIRE(setInstructionSet(InstructionSet::generic));
+        REQUIRE(setInstructionSet(detected));
+        REQUIRE(getInstructionSet() == detected);
+    }
+
+    SECTION("Test that unsupported instruction sets are rejected")
+    {
+        if (detected != InstructionSet::avx512)
+        {
+            REQUIRE_FALSE(setInstructionSet(InstructionSet::avx512));
+            REQUIRE(getInstructionSet() == detected);
+        }
+    }
+
+    setInstructionSet(detected);
+}
+
+} // namespace tests
+} // namespace sml
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/tableSearch.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Test find interval function", "[table-search]")
+{
+    const Vector xData = {0.0, 1.0, 2.5, 4.0, 7.0, 7.5};
+
+    SECTION("Test x-values inside table")
+    {
+        REQUIRE(findInterval(xData, 0.0) == 0);
+        REQUIRE(findInterval(xData, 0.5) == 0);
+        REQUIRE(findInterval(xData, 1.0) == 1);
+        REQUIRE(findInterval(xData, 3.9) == 2);
+        REQUIRE(findInterval(xData, 7.2) == 4);
+    }
+
+    SECTION("Test x-values outside table are clamped to first and last interval")
+    {
+        REQUIRE(findInterval(xData, -10.0) == 0);
+        REQUIRE(findInterval(xData, 7.5) == 4);
+        REQUIRE(findInterval(xData, 100.0) == 4);
+    }
+
+    SECTION("Test table with two entries")
+    {
+        const Vector twoEntries = {1.0, 2.0};
+        REQUIRE(findInterval(twoEntries, 1.5) == 0);
+        REQUIRE(findInterval(twoEntries, 3.0) == 0);
+    }
+}
+
+TEST_CASE("Test hunt interval function", "[table-search]")
+{
+    Vector xData(100);
+    for (std::size_t i = 0; i < xData.size(); i++)
+    {
+        xData[i] = 0.5 * static_cast<Real>(i * i);
+    }
+
+    SECTION("Test that hunting from any guess yields same result as binary search")
+    {
+        const Vector queries = {-1.0, 0.0, 0.3, 12.5, 13.0, 2000.0, 4900.5, 4901.0, 6000.0};
+        for (std::size_t guess = 0; guess < xData.size() + 5; guess += 7)
+        {
+            for (const Real x : queries)
+            {
+                REQUIRE(huntInterval(xData, x, guess) == findInterval(xData, x));
+            }
+        }
+    }
+
+    SECTION("Test hunting with cursor for ascending queries")
+    {
+        std::size_t cursor = 0;
+        for (Real x = -1.0; x < 5000.0; x += 3.7)
+        {
+            cursor = huntInterval(xData, x, cursor);
+            REQUIRE(cursor == findInterval(xData, x));
+        }
+    }
+}
+
+TEST_CASE("Test stencil start function", "[table-search]")
+{
+    SECTION("Test stencil centred on interval")
+    {
+        REQUIRE(getStencilStart(5, 4, 20) == 4);
+        REQUIRE(getStencilStart(5, 5, 20) == 3);
+        REQUIRE(getStencilStart(5, 2, 20) == 5);
+    }
+
+    SECTION("Test stencil shifted at start and end of table")
+    {
+        REQUIRE(getStencilStart(0, 4, 20) == 0);
+        REQUIRE(getStencilStart(1, 6, 20) == 0);
+        REQUIRE(getStencilStart(18, 4, 20) == 16);
+        REQUIRE(getStencilStart(17, 4, 20) == 16);
+        REQUIRE(getStencilStart(3, 4, 4) == 0);
+    }
+}
+
+} // namespace tests
+} // namespace sml
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/arrayView.hpp"
+#include "sml/trigonometry.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+//! Compute error of result in units in the last place (ULP) of reference.
+/*!
+ * Errors smaller than the absolute tolerance, e.g., close to zeros of the sine, are returned as
+ * zero.
+ */
+template <typename Real>
+long double computeError(const Real result, const long double reference, const long double margin)
+{
+    const long double error = std::fabs(static_cast<long double>(result) - reference);
+    if (error <= margin)
+    {
+        return 0.0L;
+    }
+    const Real rounded = static_cast<Real>(reference);
+    const long double unit = std::nextafter(std::fabs(rounded), std::numeric_limits<Real>::max())
+                             - std::fabs(rounded);
+    return error / unit;
+}
+
+//! Check maximum error of batch trigonometric functions for given Real type.
+/*!
+ * The sine and cosine are checked against the documented maximum error (in ULP) over the whole
+ * reduction range, since the error of the reduction grows with the magnitude of the angles.
+ */
+template <typename Real>
+void checkTrigonometricErrors(const long double margin, const long double maximumSineError)
+{
+    typedef std::vector<Real> Vector;
+
+    // Angles spanning several revolutions, including multiples of pi/2 and an odd size.
+    const std::size_t size = 40001;
+    const std::size_t denseSize = 20001;
+    Vector angles(size);
+    for (std::size_t i = 0; i < denseSize; i++)
+    {
+        angles[i] = static_cast<Real>(-100.0 + 200.0 * static_cast<double>(i) / (denseSize - 1));
+    }
+    // Angles up to the reduction range, with logarithmically spaced magnitudes of both signs.
+    const long double limit = detail::TrigonometricCoefficients<Real>::reductionLimit;
+    for (std::size_t i = denseSize; i < size; i++)
+    {
+        const long double fraction
+            = static_cast<long double>(i - denseSize) / static_cast<long double>(size - denseSize);
+        const long double magnitude = 100.0L * std::pow(limit / 100.0L, fraction);
+        angles[i] = static_cast<Real>(i % 2 == 0 ? magnitude : -magnitude);
+    }
+    for (std::size_t i = 0; i < 64; i++)
+    {
+        angles[i] = static_cast<Real>(1.57079632679489661923L * (static_cast<long double>(i) - 32));
+    }
+
+    Vector sines(size);
+    Vector cosines(size);
+    Vector coarseSines(size);
+    Vector coarseCosines(size);
+    computeSineAndCosine<Real>(angles, sines, cosines);
+    computeSineAndCosine<Real>(angles, coarseSines, coarseCosines, TrigonometricAccuracy::coarse);
+
+    long double maximumError = 0.0L;
+    long double maximumCoarseError = 0.0L;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const long double sine = std::sin(static_cast<long double>(angles[i]));
+        const long double cosine = std::cos(static_cast<long double>(angles[i]));
+        maximumError = std::fmax(maximumError, computeError(sines[i], sine, margin));
+        maximumError = std::fmax(maximumError, computeError(cosines[i], cosine, margin));
+        maximumCoarseError = std::fmax(maximumCoarseError, std::fabs(coarseSines[i] - sine));
+        maximumCoarseError = std::fmax(maximumCoarseError, std::fabs(coarseCosines[i] - cosine));
+    }
+    REQUIRE(maximumError <= maximumSineError);
+    REQUIRE(maximumCoarseError <= 2.0e-6L);
+
+    Vector y(size);
+    Vector x(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        y[i] = std::sin(angles[i]) * static_cast<Real>(1 + i % 7);
+        x[i] = std::cos(angles[i]) * static_cast<Real>(1 + i % 7);
+    }
+    Vector results(size);
+    Vector coarseResults(size);
+    computeArcTangent2<Real>(y, x, results);
+    computeArcTangent2<Real>(y, x, coarseResults, TrigonometricAccuracy::coarse);
+
+    maximumError = 0.0L;
+    maximumCoarseError = 0.0L;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const long double angle
+            = std::atan2(static_cast<long double>(y[i]), static_cast<long double>(x[i]));
+        maximumError = std::fmax(maximumError, computeError(results[i], angle, 0.0L));
+        maximumCoarseError = std::fmax(maximumCoarseError,
+                                       std::fabs(coarseResults[i] - angle) / std::fabs(angle));
+    }
+    REQUIRE(maximumError <= 3.0L);
+    REQUIRE(maximumCoarseError <= 2.0e-6L);
+}
+
+TEST_CASE("Test batch trigonometric functions", "[trigonometry]")
+{
+    typedef double Real;
+    typedef std::vector<Real> Vector;
+
+    SECTION("Test maximum error for double and float")
+    {
+        checkTrigonometricErrors<double>(0.0L, 2.5L);
+        checkTrigonometricErrors<float>(1.0e-11L, 3.0L);
+    }
+
+    SECTION("Test single functions and in-place computation")
+    {
+        const Vector angles = {0.0, 0.5, -1.0, 2.0, 10.0, -30.0, 1000.0};
+        Vector sines(angles.size());
+        Vector cosines(angles.size());
+        computeSine<Real>(angles, sines);
+        computeCosine<Real>(angles, cosines);
+
+        Vector results = angles;
+        computeSine<Real>(results, results);
+        REQUIRE(results == sines);
+        results = angles;
+        ArrayView<Real> view(results.data(), results.size());
+        computeCosine<Real>(view, view);
+        REQUIRE(results == cosines);
+
+        for (std::size_t i = 0; i < angles.size(); i++)
+        {
+            REQUIRE(std::fabs(sines[i] - std::sin(angles[i])) <= 4.0e-16);
+            REQUIRE(std::fabs(cosines[i] - std::cos(angles[i])) <= 4.0e-16);
+        }
+    }
+
+    SECTION("Test signed zeros and special coordinates of arctangent")
+    {
+        const Real infinity = std::numeric_limits<Real>::infinity();
+        const Vector y = {0.0, -0.0, 0.0, -0.0, 1.0, -1.0, 0.0, 3.0};
+        const Vector x = {0.0, 0.0, -0.0, -0.0, 0.0, -0.0, -2.0, 3.0};
+        Vector angles(y.size());
+        computeArcTangent2<Real>(y, x, angles);
+        for (std::size_t i = 0; i < y.size(); i++)
+        {
+            REQUIRE(angles[i] == std::atan2(y[i], x[i]));
+            REQUIRE(std::signbit(angles[i]) == std::signbit(std::atan2(y[i], x[i])));
+        }
+
+        // Infinite coordinates fall back to std::atan2().
+        const Vector infiniteY = {1.0, infinity};
+        const Vector infiniteX = {-infinity, infinity};
+        Vector infiniteAngles(2);
+        computeArcTangent2<Real>(infiniteY, infiniteX, infiniteAngles);
+        REQUIRE(infiniteAngles[0] == std::atan2(1.0, -infinity));
+        REQUIRE(infiniteAngles[1] == std::atan2(infinity, infinity));
+    }
+
+    SECTION("Test fallback for angles outside reduction range")
+    {
+        const Vector angles = {0.5, 1.0e7, std::numeric_limits<Real>::quiet_NaN()};
+        Vector sines(angles.size());
+        Vector cosines(angles.size());
+        computeSineAndCosine<Real>(angles, sines, cosines);
+        REQUIRE(sines[1] == std::sin(1.0e7));
+        REQUIRE(cosines[1] == std::cos(1.0e7));
+        REQUIRE(std::isnan(sines[2]));
+        REQUIRE(std::isnan(cosines[2]));
+    }
+}
+
+} // namespace tests
+} // namespace sml
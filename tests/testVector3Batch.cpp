@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "sml/linearAlgebra.hpp"
+#include "sml/vector3Batch.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 3> Vector3;
+typedef Vector3Batch<Real> Batch;
+
+//! Create arbitrary collection of 3-vectors, with size that is not a multiple of SIMD width.
+std::vector<Vector3> createVectors(const std::size_t size, const Real offset)
+{
+    std::vector<Vector3> vectors(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const Real angle = offset + 0.1 * static_cast<Real>(i);
+        vectors[i] = {{std::cos(angle) * (1.0 + angle), std::sin(angle) - 2.0, angle * 0.3 + 1.0}};
+    }
+    return vectors;
+}
+
+//! Check if two 3-vectors are equal up to rounding.
+bool isApproximatelyEqual(const Vector3& vector1, const Vector3& vector2)
+{
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        if (vector1[i] != Catch::Approx(vector2[i]).epsilon(1.0e-14).margin(1.0e-14))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Test batch of 3-vectors", "[vector3-batch]")
+{
+    const std::vector<Vector3> vectors = createVectors(37, 0.0);
+
+    SECTION("Test conversion between array-of-structures and structure-of-arrays")
+    {
+        const Batch batch = convertToStructureOfArrays<Real>(vectors);
+        REQUIRE(batch.size() == vectors.size());
+        REQUIRE(batch.getX()[5] == vectors[5][0]);
+        REQUIRE(batch.getY()[5] == vectors[5][1]);
+        REQUIRE(batch.getZ()[5] == vectors[5][2]);
+        REQUIRE(batch.get<Vector3>(10) == vectors[10]);
+        REQUIRE(convertToArrayOfStructures<Vector3>(batch) == vectors);
+        REQUIRE(convertToArrayOfStructures<Vector>(batch)[3] == Vector(vectors[3].begin(),
+                                                                        vectors[3].end()));
+    }
+
+    SECTION("Test setting and resizing")
+    {
+        Batch batch(2);
+        batch.set(1, Vector3({{1.0, 2.0, 3.0}}));
+        REQUIRE(batch.get<Vector3>(0) == Vector3({{0.0, 0.0, 0.0}}));
+        REQUIRE(batch.get<Vector3>(1) == Vector3({{1.0, 2.0, 3.0}}));
+        batch.resize(5);
+        REQUIRE(batch.size() == 5);
+    }
+}
+
+TEST_CASE("Test batch linear algebra functions", "[vector3-batch]")
+{
+    const std::vector<Vector3> vectors1 = createVectors(37, 0.0);
+    const std::vector<Vector3> vectors2 = createVectors(37, 1.3);
+    const Batch batch1 = convertToStructureOfArrays<Real>(vectors1);
+    const Batch batch2 = convertToStructureOfArrays<Real>(vectors2);
+
+    // Run batch functions for all instruction sets supported by CPU, which must all yield the same
+    // results as the functions for single 3-vectors, up to rounding (e.g., due to fused
+    // multiply-add instructions).
+    const InstructionSet detected = getInstructionSet();
+    const InstructionSet instructionSets[3]
+        = {InstructionSet::generic, InstructionSet::avx2, InstructionSet::avx512};
+    for (const InstructionSet instructionSet : instructionSets)
+    {
+        if (!setInstructionSet(instructionSet))
+        {
+            continue;
+        }
+
+        Batch batchResult;
+        Vector results(batch1.size());
+
+        cross(batch1, batch2, batchResult);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(isApproximatelyEqual(batchResult.get<Vector3>(i), cross(vectors1[i], vectors2[i])));
+        }
+
+        dot(batch1, batch2, results);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(results[i] == Catch::Approx(dot<Real>(vectors1[i], vectors2[i])).epsilon(1.0e-14));
+        }
+
+        squaredNorm(batch1, results);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(results[i] == Catch::Approx(squaredNorm<Real>(vectors1[i])).epsilon(1.0e-14));
+        }
+
+        norm(batch1, results);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(results[i] == Catch::Approx(norm<Real>(vectors1[i])).epsilon(1.0e-14));
+        }
+
+        normalize(batch1, batchResult);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(isApproximatelyEqual(batchResult.get<Vector3>(i), normalize<Real>(vectors1[i])));
+        }
+
+        multiply(batch1, -2.5, batchResult);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(batchResult.get<Vector3>(i) == multiply(vectors1[i], -2.5));
+        }
+
+        add(batch1, 0.75, batchResult);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(batchResult.get<Vector3>(i) == add(vectors1[i], 0.75));
+        }
+
+        add(batch1, batch2, batchResult);
+        for (std::size_t i = 0; i < vectors1.size(); i++)
+        {
+            REQUIRE(batchResult.get<Vector3>(i) == add(vectors1[i], vectors2[i]));
+        }
+
+        // Results can overwrite input batch
+        Batch inPlace = batch1;
+        cross(inPlace, batch2, inPlace);
+        REQUIRE(convertToArrayOfStructures<Vector3>(inPlace)
+                == convertToArrayOfStructures<Vector3>((cross(batch1, batch2, batchResult),
+                                                        batchResult)));
+
+        const Batch xUnitVectors = getXUnitVectors<Real>(3);
+        const Batch yUnitVectors = getYUnitVectors<Real>(3);
+        const Batch zUnitVectors = getZUnitVectors<Real>(3);
+        REQUIRE(xUnitVectors.get<Vector3>(2) == getXUnitVector<Vector3>());
+        REQUIRE(yUnitVectors.get<Vector3>(2) == getYUnitVector<Vector3>());
+        REQUIRE(zUnitVectors.get<Vector3>(2) == getZUnitVector<Vector3>());
+    }
+    setInstructionSet(detected);
+}
+
+TEST_CASE("Test centroid of batch of 3-vectors", "[vector3-batch]")
+{
+    const std::vector<Vector3> vectors = createVectors(37, 0.0);
+    const Batch batch = convertToStructureOfArrays<Real>(vectors);
+    Vector3 expected = {{0.0, 0.0, 0.0}};
+    for (std::size_t i = 0; i < vectors.size(); i++)
+    {
+        expected = add(expected, vectors[i]);
+    }
+    expected = multiply(expected, 1.0 / static_cast<Real>(vectors.size()));
+    REQUIRE(isApproximatelyEqual(computeCentroid<Vector3>(batch), expected));
+    REQUIRE(isApproximatelyEqual(computeCentroid<Vector3>(batch, SummationMethod::kahan),
+                                 expected));
+
+    // Single-precision point cloud, offset far from the origin, with compensated summation.
+    const std::size_t size = 1000000;
+    Vector3Batch<float> cloud(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const float offset = 0.01f * static_cast<float>(i % 101) - 0.5f;
+        cloud.set(i, std::array<float, 3>({{7000.0f + offset, -offset, 42.0f}}));
+    }
+    const std::array<float, 3> centroid
+        = computeCentroid<std::array<float, 3> >(cloud, SummationMethod::kahan);
+    const std::array<float, 3> sequentialCentroid
+        = computeCentroid<std::array<float, 3> >(cloud, SummationMethod::sequential);
+    REQUIRE(centroid[0] == Catch::Approx(7000.0).epsilon(1.0e-7));
+    REQUIRE(std::fabs(centroid[1]) <= 1.0e-3f);
+    REQUIRE(centroid[2] == 42.0f);
+    REQUIRE(std::fabs(sequentialCentroid[0] - 7000.0f) > std::fabs(centroid[0] - 7000.0f));
+}
+
+} // namespace tests
+} // namespace sml
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/fixedVector.hpp"
+#include "sml/linearAlgebra.hpp"
+#include "sml/vectorExpression.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 3> Array3;
+typedef FixedVector<Real, 3> FixedVector3;
+
+TEST_CASE("Test vector expressions", "[vector-expression]")
+{
+    const Vector vector1({1.5, -2.25, 3.0, 0.125, -7.5});
+    const Vector vector2({-0.5, 4.0, 2.75, -1.0, 6.25});
+    const Real multiplier = 0.3;
+    const Real adder = -1.7;
+
+    SECTION("Test element-wise operations")
+    {
+        REQUIRE(evaluate<Vector>(expression::multiply<Real>(vector1, multiplier))
+                == multiply<Real>(vector1, multiplier));
+        REQUIRE(evaluate<Vector>(expression::add<Real>(vector1, adder))
+                == add<Real>(vector1, adder));
+        REQUIRE(evaluate<Vector>(expression::add(vector1, vector2)) == add(vector1, vector2));
+    }
+
+    SECTION("Test chained operations")
+    {
+        const Vector expected = add(add<Real>(multiply<Real>(vector1, multiplier), adder),
+                                    multiply<Real>(vector2, multiplier));
+        const Vector result = evaluate<Vector>(
+            expression::add(expression::add<Real>(expression::multiply<Real>(vector1, multiplier),
+                                                  adder),
+                            expression::multiply<Real>(vector2, multiplier)));
+
+        REQUIRE(result.size() == expected.size());
+        for (unsigned int i = 0; i < expected.size(); i++)
+        {
+            REQUIRE(result[i] == Catch::Approx(expected[i]).epsilon(1.0e-14));
+        }
+    }
+
+    SECTION("Test evaluation into destination that is an operand")
+    {
+        Vector position = vector1;
+        const Vector expected = add(multiply<Real>(vector2, multiplier), vector1);
+        evaluate(expression::add(expression::multiply<Real>(vector2, multiplier), position),
+                 position);
+
+        for (unsigned int i = 0; i < expected.size(); i++)
+        {
+            REQUIRE(position[i] == Catch::Approx(expected[i]).epsilon(1.0e-14));
+        }
+    }
+
+    SECTION("Test expressions of fixed-size vectors")
+    {
+        const Array3 array1 = {{1.0, 2.0, 3.0}};
+        const FixedVector3 fixedVector1 = {{1.0, 2.0, 3.0}};
+        const Array3 expectedArray = {{3.0, 5.0, 7.0}};
+        const FixedVector3 expectedFixedVector = {{3.0, 5.0, 7.0}};
+
+        REQUIRE(evaluate<Array3>(expression::add<Real>(expression::multiply<Real>(array1, 2.0),
+                                                       1.0))
+                == expectedArray);
+        REQUIRE(evaluate<FixedVector3>(
+                    expression::add<Real>(expression::multiply<Real>(fixedVector1, 2.0), 1.0))
+                == expectedFixedVector);
+    }
+
+    SECTION("Test expressions as arguments of linear algebra functions")
+    {
+        const Array3 array1 = {{1.0, 2.0, 2.0}};
+        REQUIRE(norm<Real>(expression::multiply<Real>(array1, 2.0)) == 6.0);
+        REQUIRE(squaredNorm<Real>(expression::add(array1, array1)) == 36.0);
+    }
+}
+
+} // namespace tests
+} // namespace sml
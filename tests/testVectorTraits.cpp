@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2014-2025 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "sml/vectorTraits.hpp"
+
+namespace sml
+{
+namespace tests
+{
+
+typedef double Real;
+
+TEST_CASE("Test vector traits", "[vector-traits]")
+{
+    SECTION("Test creation of dynamically-sized vector")
+    {
+        typedef std::vector<Real> Vector;
+        REQUIRE_FALSE(VectorTraits<Vector>::isFixedSize);
+        REQUIRE(VectorTraits<Vector>::create(5).size() == 5);
+        REQUIRE(VectorTraits<Vector>::create(1.0, 2.0, 3.0) == Vector({1.0, 2.0, 3.0}));
+    }
+
+    SECTION("Test creation of std::array")
+    {
+        typedef std::array<Real, 3> Vector3;
+        REQUIRE(VectorTraits<Vector3>::isFixedSize);
+        REQUIRE(VectorTraits<Vector3>::create(3) == Vector3({{0.0, 0.0, 0.0}}));
+        REQUIRE(VectorTraits<Vector3>::create(1.0, 2.0, 3.0) == Vector3({{1.0, 2.0, 3.0}}));
+    }
+
+    SECTION("Test creation of fixed-size vector")
+    {
+        typedef FixedVector<Real, 3> Vector3;
+        REQUIRE(VectorTraits<Vector3>::isFixedSize);
+        REQUIRE(VectorTraits<Vector3>::create(3) == Vector3({{0.0, 0.0, 0.0}}));
+
+        constexpr Vector3 vector = VectorTraits<Vector3>::create(1.0, 2.0, 3.0);
+        static_assert(vector[1] == 2.0, "Fixed-size vector must be created at compile time");
+        REQUIRE(vector == Vector3({{1.0, 2.0, 3.0}}));
+    }
+}
+
+} // namespace tests
+} // namespace sml